@@ -5,6 +5,7 @@
 
 #include "Macro.h"
 #include "Patch.h"
+#include "FluxRegister.h"
 
 #ifdef PARTICLE
 #  include "Particle.h"
@@ -56,6 +57,7 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //                BoxScale      : Simulation box scale
 //                WithFlux      : Whether of not to allocate the flux arrays at all coarse-fine boundaries
 //                WithElectric  : Whether of not to allocate the electric field arrays at all coarse-fine boundaries
+//                FluxReg       : Flux register storing the flux arrays of all coarse-fine faces at each level
 //                Par           : Particle data
 //                ParaVar       : Variables for parallelization
 //                LB            : Variables for load-balance
@@ -114,6 +116,7 @@ struct AMR_t
 #  ifdef MHD
    bool   WithElectric;
 #  endif
+   FluxReg_t FluxReg  [NLEVEL];
    long   NUpdateLv   [NLEVEL];
 
 #  if ( MODEL == ELBDM )
@@ -270,9 +273,9 @@ struct AMR_t
             Aux_Error( ERROR_INFO, "conflicting patch allocation (Lv %d, PID %d, FaPID %d) !!\n", lv, NewPID, FaPID );
 #        endif
 
-         patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
+         patch[0][lv][NewPID] = new patch_t( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv, 0,
                                              BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
-         patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
+         patch[1][lv][NewPID] = new patch_t(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv, 1,
                                              BoxScale, BoxEdgeL, dh[TOP_LEVEL] );
       }
 
@@ -293,9 +296,9 @@ struct AMR_t
 //       do NOT initialize field pointers as NULL since they may be allocated already
          const bool InitPtrAsNull_No = false;
 
-         patch[0][lv][NewPID]->Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv,
+         patch[0][lv][NewPID]->Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, FluData, lv, 0,
                                          BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
-         patch[1][lv][NewPID]->Activate(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv,
+         patch[1][lv][NewPID]->Activate(       0,       0,       0,    -1, FluData, MagData, PotData,   false, lv, 1,
                                          BoxScale, BoxEdgeL, dh[TOP_LEVEL], InitPtrAsNull_No );
       } // if ( patch[0][lv][NewPID] == NULL ) ... else ...
 
@@ -349,13 +352,14 @@ struct AMR_t
          patch[0][lv][PID]->Active = false;
          patch[1][lv][PID]->Active = false;
 
-//       always deallocate flux and electric field arrays due to the following reasons
+//       always detach flux arrays and deallocate electric field arrays due to the following reasons
 //       (1) we use them to determine which patches require the flux and electric field fix-up operations
 //           --> see Flu_FixUp_Flux() and MHD_FixUp_Electric()
 //       (2) flux and electric field arrays do not consume much memory
 //           --> at most 6/32 for flux, where 6 = 6 faces and 32 = patch group size*two sg
 //       (3) different patches may require flux and electric field arrays along different directions, and thus
 //           allocating memory pool for them can be inefficient and less useful
+//           --> flux arrays are owned by the level-wide flux register FluxReg[lv] instead
          patch[0][lv][PID]->fdelete();
 #        ifdef MHD
          patch[0][lv][PID]->edelete();
@@ -415,6 +419,8 @@ struct AMR_t
 
       for (int m=0; m<28; m++)   NPatchComma[lv][m] = 0;
 
+      FluxReg[lv].Reset();
+
 #     ifndef SERIAL
       if ( ParaVar != NULL )     ParaVar->Lvdelete( lv );
 #     endif
@@ -0,0 +1,158 @@
+#ifndef __DIAGNOSTICS_H__
+#define __DIAGNOSTICS_H__
+
+
+
+#include "Macro.h"
+#include "Typedef.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  DiagPatch_t
+// Description :  Data structure passed to the per-patch callback of a diagnostic consumer
+//
+// Data Member :  lv      : Target AMR level
+//                PID     : Target local patch index
+//                dh      : Cell size on lv
+//                dv      : Cell volume on lv
+//                FluSg   : Sandglass of the fluid data
+//                MagSg   : Sandglass of the magnetic field data
+//                PotSg   : Sandglass of the potential data
+//                ParDens : Particle density of the target patch (NULL if no consumer requires _PAR_DENS)
+//                TotDens : Total density of the target patch    (NULL if no consumer requires _TOTAL_DENS)
+//-------------------------------------------------------------------------------------------------------
+struct DiagPatch_t
+{
+
+   int    lv;
+   int    PID;
+   double dh;
+   double dv;
+   int    FluSg;
+   int    MagSg;
+   int    PotSg;
+
+   const real (*ParDens)[PS1][PS1];
+   const real (*TotDens)[PS1][PS1];
+
+}; // struct DiagPatch_t
+
+
+
+// per-patch callback: accumulate the contribution of one leaf patch to the thread-private buffer Out[]
+struct DiagConsumer_t;
+typedef void (*DiagPatchFunc_t)( double Out[], const DiagPatch_t &Patch, const DiagConsumer_t &Diag );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  DiagConsumer_t
+// Description :  Data structure of a diagnostic consumer evaluated by the single-pass diagnostics engine
+//
+// Data Member :  Name      : Consumer name (for error messages only)
+//                Field     : Target field(s)
+//                            --> _PAR_DENS and _TOTAL_DENS are prepared by the engine and passed through
+//                                DiagPatch_t. All other fields should be accessed directly from the patch data.
+//                Op        : Reduction operation (DIAG_OP_SUM/MIN/MAX/MINLOC/MAXLOC)
+//                            --> For DIAG_OP_MINLOC/MAXLOC, Data[0] is the key to be compared, Data[1] must be
+//                                the MPI rank for breaking ties, and all other elements are carried along
+//                NData     : Number of reduced values
+//                PatchFunc : Per-patch callback
+//                Arg       : Arbitrary pointer accessible in PatchFunc
+//
+//                Data      : Reduced values shared by all ranks after Aux_Diag_Execute()
+//                Step      : Step when this consumer was last evaluated
+//                Time      : Physical time when this consumer was last evaluated
+//
+// Method      :  DiagConsumer_t  : Constructor
+//               ~DiagConsumer_t  : Destructor
+//                IsCurrent       : Whether Data[] was evaluated at the current Step/Time
+//-------------------------------------------------------------------------------------------------------
+struct DiagConsumer_t
+{
+
+// data members
+// ===================================================================================
+// input parameters
+   const char     *Name;
+   long            Field;
+   DiagOp_t        Op;
+   int             NData;
+   DiagPatchFunc_t PatchFunc;
+   void           *Arg;
+
+// output parameters
+   double         *Data;
+   long            Step;
+   double          Time;
+
+
+   //===================================================================================
+   // Constructor :  DiagConsumer_t
+   // Description :  Constructor of the structure "DiagConsumer_t"
+   //
+   // Note        :  Initialize the data members
+   //
+   // Parameter   :  None
+   //===================================================================================
+   DiagConsumer_t()
+   {
+
+      Name      = NULL;
+      Field     = _NONE;
+      Op        = DIAG_OP_SUM;
+      NData     = 0;
+      PatchFunc = NULL;
+      Arg       = NULL;
+
+      Data      = NULL;
+      Step      = -1;
+      Time      = -__DBL_MAX__;
+
+   } // METHOD : DiagConsumer_t
+
+
+
+   //===================================================================================
+   // Destructor  :  ~DiagConsumer_t
+   // Description :  Destructor of the structure "DiagConsumer_t"
+   //
+   // Note        :  Free memory
+   //===================================================================================
+   ~DiagConsumer_t()
+   {
+
+      delete [] Data;
+
+   } // METHOD : ~DiagConsumer_t
+
+
+
+   //===================================================================================
+   // Method      :  IsCurrent
+   // Description :  Check whether Data[] has been evaluated at the given step and time
+   //
+   // Note        :  1. Used by the owners of consumers to reuse the results evaluated earlier in
+   //                   the same global step (e.g., by Aux_Diagnostics())
+   //
+   // Parameter   :  Step_Now : Current step
+   //                Time_Now : Current physical time
+   //
+   // Return      :  true/false
+   //===================================================================================
+   bool IsCurrent( const long Step_Now, const double Time_Now ) const
+   {
+
+      return ( Data != NULL  &&  Step == Step_Now  &&  Time == Time_Now );
+
+   } // METHOD : IsCurrent
+
+
+}; // struct DiagConsumer_t
+
+
+
+#endif // #ifndef __DIAGNOSTICS_H__
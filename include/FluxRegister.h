@@ -0,0 +1,280 @@
+#ifndef __FLUXREGISTER_H__
+#define __FLUXREGISTER_H__
+
+
+
+#include "Macro.h"
+#include "Patch.h"
+
+void Aux_Error( const char *File, const int Line, const char *Func, const char *Format, ... );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  FluxReg_t
+// Description :  Flux register storing the fluxes of all coarse-grid faces adjacent to the coarse-fine
+//                boundaries at one level
+//
+// Note        :  1. Flux arrays of all faces are stored in one contiguous buffer
+//                   --> patch_t::flux[], flux_tmp[], and flux_bitrep[] just point to this buffer
+//                   --> Avoid allocating and deallocating one small array per face on every regrid
+//                2. Faces of real patches must be added before those of buffer patches, and faces of the same
+//                   real patch must be added consecutively in the ascending order of patch indices
+//                   --> Faces [0 ... NFaceReal-1] belong to real patches and [NFaceReal ... NFace-1] to buffer patches
+//                   --> Fluxes of all buffer patches can be reset with a single memset()
+//                3. Rebuilt by Flu_AllocateFluxArray() and LB_AllocateFluxArray() after every regrid
+//                4. Flux[]/Flux_Tmp[] are swapped together with patch_t::flux[]/flux_tmp[] by SwapTmp()
+//                   --> Flux[f] is always the array pointed by amr->patch[0][lv][ Face[f][0] ]->flux[ Face[f][1] ]
+//
+// Data Member :  NFace        : Total number of faces
+//                NFaceReal    : Number of faces of real patches
+//                NPatchReal   : Number of real patches with at least one face
+//                Face         : [0/1] = patch index and sibling direction of each face
+//                PIDReal      : Indices of the real patches with at least one face
+//                Flux         : Flux       arrays of all faces ( == patch_t::flux       [] )
+//                Flux_Tmp     : Flux       arrays of all faces ( == patch_t::flux_tmp   [] ) --> for AUTO_REDUCE_DT
+//                Flux_BitRep  : Flux       arrays of all faces ( == patch_t::flux_bitrep[] ) --> for BIT_REP_FLUX
+//                FaceListSize : Size of Face[] and PIDReal[]
+//                DataSize     : Number of flux arrays allocated in Data[]
+//                Data         : Buffer storing Flux[], Flux_Tmp[], and Flux_BitRep[]
+//
+// Method      :  FluxReg_t : Constructor
+//               ~FluxReg_t : Destructor
+//                Reset     : Remove all faces
+//                AddFace   : Add one face
+//                Build     : Allocate the flux arrays of all faces and attach them to the patches
+//                SwapTmp   : Swap Flux[] and Flux_Tmp[]
+//-------------------------------------------------------------------------------------------------------
+struct FluxReg_t
+{
+
+// data members
+// ===================================================================================
+   int    NFace;
+   int    NFaceReal;
+   int    NPatchReal;
+   int  (*Face)[2];
+   int   *PIDReal;
+
+   real (*Flux       )[NFLUX_TOTAL][PS1][PS1];
+   real (*Flux_Tmp   )[NFLUX_TOTAL][PS1][PS1];
+   real (*Flux_BitRep)[NFLUX_TOTAL][PS1][PS1];
+
+   int    FaceListSize;
+   long   DataSize;
+   real (*Data       )[NFLUX_TOTAL][PS1][PS1];
+
+
+   //===================================================================================
+   // Constructor :  FluxReg_t
+   // Description :  Constructor of the structure "FluxReg_t"
+   //
+   // Note        :  Initialize the data members
+   //===================================================================================
+   FluxReg_t()
+   {
+
+      NFace        = 0;
+      NFaceReal    = 0;
+      NPatchReal   = 0;
+      Face         = NULL;
+      PIDReal      = NULL;
+      Flux         = NULL;
+      Flux_Tmp     = NULL;
+      Flux_BitRep  = NULL;
+      FaceListSize = 0;
+      DataSize     = 0;
+      Data         = NULL;
+
+   } // METHOD : FluxReg_t
+
+
+
+   //===================================================================================
+   // Destructor  :  ~FluxReg_t
+   // Description :  Destructor of the structure "FluxReg_t"
+   //
+   // Note        :  Deallocate all arrays
+   //                --> Flux arrays of all patches must be detached in advance by patch_t::fdelete()
+   //===================================================================================
+   ~FluxReg_t()
+   {
+
+      free( Face );
+      free( PIDReal );
+      delete [] Data;
+
+   } // METHOD : ~FluxReg_t
+
+
+
+   //===================================================================================
+   // Method      :  Reset
+   // Description :  Remove all faces
+   //
+   // Note        :  1. Memory is kept for the next Build()
+   //                2. Flux arrays of all patches must be detached by patch_t::fdelete() as well
+   //===================================================================================
+   void Reset()
+   {
+
+      NFace       = 0;
+      NFaceReal   = 0;
+      NPatchReal  = 0;
+      Flux        = NULL;
+      Flux_Tmp    = NULL;
+      Flux_BitRep = NULL;
+
+   } // METHOD : Reset
+
+
+
+   //===================================================================================
+   // Method      :  AddFace
+   // Description :  Add one face
+   //
+   // Note        :  1. NOT thread-safe
+   //                2. See the note 2 of FluxReg_t for the order of faces
+   //
+   // Parameter   :  PID   : Patch index
+   //                SibID : Sibling direction (0,1,2,3,4,5) <--> (-x,+x,-y,+y,-z,+z)
+   //===================================================================================
+   void AddFace( const int PID, const int SibID )
+   {
+
+      if ( NFace >= FaceListSize )
+      {
+         FaceListSize = ( FaceListSize == 0 ) ? 64 : 2*FaceListSize;
+         Face         = (int(*)[2])realloc( Face,    FaceListSize*sizeof(int)*2 );
+         PIDReal      = (int*     )realloc( PIDReal, FaceListSize*sizeof(int)   );
+      }
+
+      Face[NFace][0] = PID;
+      Face[NFace][1] = SibID;
+      NFace ++;
+
+   } // METHOD : AddFace
+
+
+
+   //===================================================================================
+   // Method      :  Build
+   // Description :  Allocate the flux arrays of all faces and attach them to the patches
+   //
+   // Note        :  1. Flux[] and Flux_BitRep[] are initialized as zero
+   //                2. Data[] is reallocated only when it is too small
+   //
+   // Parameter   :  Patch    : Patch pointers at the target level ( == amr->patch[0][lv] )
+   //                NReal    : Number of real patches at the target level
+   //                AllocTmp : Allocate the temporary flux arrays Flux_Tmp[]
+   //===================================================================================
+   void Build( patch_t *Patch[], const int NReal, const bool AllocTmp )
+   {
+
+//    1. count the faces and patches of real patches
+      NFaceReal  = 0;
+      NPatchReal = 0;
+
+      for (int f=0; f<NFace; f++)
+      {
+         const int PID = Face[f][0];
+
+         if ( PID >= NReal )  break;
+
+         if ( f == 0  ||  PID != Face[f-1][0] )    PIDReal[ NPatchReal ++ ] = PID;
+
+         NFaceReal ++;
+      }
+
+#     ifdef GAMER_DEBUG
+      for (int f=NFaceReal; f<NFace; f++)
+         if ( Face[f][0] < NReal )
+            Aux_Error( ERROR_INFO, "face %d of a real patch (PID %d) is added after the buffer patches !!\n",
+                       f, Face[f][0] );
+
+      for (int t=1; t<NPatchReal; t++)
+         if ( PIDReal[t] <= PIDReal[t-1] )
+            Aux_Error( ERROR_INFO, "faces of real patches are not sorted by PID (%d -> %d) !!\n",
+                       PIDReal[t-1], PIDReal[t] );
+#     endif
+
+
+//    2. allocate memory
+#     ifdef BIT_REP_FLUX
+      const int  NArray   = ( AllocTmp ) ? 3 : 2;
+#     else
+      const int  NArray   = ( AllocTmp ) ? 2 : 1;
+#     endif
+      const long NDataReq = (long)NArray*NFace;
+
+      if ( NDataReq > DataSize )
+      {
+         delete [] Data;
+
+         DataSize = NDataReq;
+         Data     = new real [DataSize][NFLUX_TOTAL][PS1][PS1];
+      }
+
+      Flux        = Data;
+      Flux_Tmp    = ( AllocTmp ) ? Data + NFace : NULL;
+#     ifdef BIT_REP_FLUX
+      Flux_BitRep = Data + (NArray-1)*NFace;
+#     else
+      Flux_BitRep = NULL;
+#     endif
+
+      if ( NFace > 0 )
+      {
+         memset( Flux, 0, (long)NFace*NFLUX_TOTAL*SQR(PS1)*sizeof(real) );
+#        ifdef BIT_REP_FLUX
+         memset( Flux_BitRep, 0, (long)NFace*NFLUX_TOTAL*SQR(PS1)*sizeof(real) );
+#        endif
+      }
+
+
+//    3. attach the flux arrays to the patches
+#     pragma omp parallel for schedule( static )
+      for (int f=0; f<NFace; f++)
+         Patch[ Face[f][0] ]->fnew( Face[f][1], Flux[f], (AllocTmp)?Flux_Tmp[f]:NULL, (Flux_BitRep!=NULL)?Flux_BitRep[f]:NULL );
+
+   } // METHOD : Build
+
+
+
+   //===================================================================================
+   // Method      :  SwapTmp
+   // Description :  Swap Flux[] and Flux_Tmp[] together with patch_t::flux[] and flux_tmp[]
+   //
+   // Note        :  1. Used by the option "AUTO_REDUCE_DT"
+   //                2. Do nothing if Flux_Tmp[] is not allocated
+   //
+   // Parameter   :  Patch : Patch pointers at the target level ( == amr->patch[0][lv] )
+   //===================================================================================
+   void SwapTmp( patch_t *Patch[] )
+   {
+
+      if ( Flux_Tmp == NULL )    return;
+
+      real (*Temp)[NFLUX_TOTAL][PS1][PS1] = Flux;
+      Flux     = Flux_Tmp;
+      Flux_Tmp = Temp;
+
+#     pragma omp parallel for schedule( static )
+      for (int f=0; f<NFace; f++)
+      {
+         patch_t *TPatch = Patch[ Face[f][0] ];
+         const int SibID = Face[f][1];
+
+         TPatch->flux    [SibID] = Flux    [f];
+         TPatch->flux_tmp[SibID] = Flux_Tmp[f];
+      }
+
+   } // METHOD : SwapTmp
+
+
+}; // struct FluxReg_t
+
+
+
+#endif // #ifndef __FLUXREGISTER_H__
@@ -72,6 +72,7 @@ extern "C" {
 #include "RandomNumber.h"
 #include "Profile.h"
 #include "Extrema.h"
+#include "Diagnostics.h"
 #include "SrcTerms.h"
 #include "EoS.h"
 #include "Microphysics.h"
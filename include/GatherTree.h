@@ -116,6 +116,7 @@ struct LB_GlobalTree : private NonCopyable
    const LB_GlobalPatch& GetPatch(const long GID) const;
    const LB_PatchCount&  GetLBPatchCount() const;
    long PID2GID(const int PID, const int lv) const;
+   long GetVersion() const;
 
    const LB_GlobalPatch& operator[](long) const;
 
@@ -123,6 +124,7 @@ private:
    LB_PatchCount   PatchCount;
    LB_GlobalPatch* Patches;
    long            NPatch;
+   long            Version;   // unique ID of each constructed tree for invalidating data derived from it
 }; // struct LB_GlobalTree
 
 
@@ -296,6 +296,7 @@ struct SymConst_t
 #  endif
 
    int    InterpMask;
+   int    InterpMaskLocal;
    int    FB_SepFluOut;
 
 
@@ -444,6 +445,7 @@ struct InputPara_t
    int    Par_GhostSizeTracer;
    int    Par_TracerVelCorr;
    int    Opt__ParInitCheck;
+   int    Par_ReorderStep;
    char  *ParAttFltLabel[PAR_NATT_FLT_TOTAL];
    char  *ParAttIntLabel[PAR_NATT_INT_TOTAL];
 #  endif
@@ -499,6 +501,7 @@ struct InputPara_t
 #  if ( MODEL == HYDRO )
    double AutoReduceMinModFactor;
    double AutoReduceMinModMin;
+   int    AutoReduceDtLocal;
 #  endif
    double AutoReduceIntMonoFactor;
    double AutoReduceIntMonoMin;
@@ -571,6 +574,8 @@ struct InputPara_t
 #  endif
    int    Opt__ReuseMemory;
    int    Opt__MemoryPool;
+   int    Opt__SingleSandglass;
+   int    Opt__PatchSlab;
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -684,6 +689,7 @@ struct InputPara_t
    double ExtPotTable_dh[3];
    double ExtPotTable_EdgeL[3];
    int    ExtPotTable_Float8;
+   int    ExtPotTable_Cache;
    int    Opt__GravityExtraMass;
 #  endif // #ifdef GRAVITY
 
@@ -749,6 +755,7 @@ struct InputPara_t
    double CR_Diffusion_ParaCoeff;
    double CR_Diffusion_PerpCoeff;
    double CR_Diffusion_MinB;
+   int    CR_Diffusion_RKL2;
 #  endif
 
 // initialization
@@ -763,6 +770,7 @@ struct InputPara_t
    int    Opt__UM_IC_Downgrade;
    int    Opt__UM_IC_Refine;
    int    Opt__UM_IC_LoadNRank;
+   int    Opt__UM_IC_MMap;
    int    UM_IC_RefineRegion[NLEVEL-1][6];
    int    Opt__InitRestrict;
    int    Opt__InitGridWithOMP;
@@ -773,6 +781,7 @@ struct InputPara_t
 #  endif
 #  ifdef SUPPORT_FFTW
    int    Opt__FFTW_Startup;
+   int    Opt__FFTW_Cache;
 #  endif
 
 // interpolation schemes
@@ -817,6 +826,7 @@ struct InputPara_t
 // data dump
    int    Opt__Output_Total;
    int    Opt__Output_Part;
+   int    Opt__Output_Part_Format;
    int    Opt__Output_User;
 #  ifdef PARTICLE
    int    Opt__Output_Par_Mode;
@@ -864,6 +874,7 @@ struct InputPara_t
    double Output_PartX;
    double Output_PartY;
    double Output_PartZ;
+   int    Output_PartProjLv;
    int    InitDumpID;
 
 // libyt jupyter interface
@@ -0,0 +1,64 @@
+#ifndef __INT_SPECIALIZED_H__
+#define __INT_SPECIALIZED_H__
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Compile-time specialized kernels of spatial interpolation
+//
+// Note  :  1. Each interpolation scheme (except spectral interpolation) is implemented as a function template
+//             Int_XXX_Kernel<CRX, CRY, CRZ, MONO>()
+//             --> CRX/Y/Z : Number of coarse-grid cells to be interpolated along x/y/z (i.e., CRange[])
+//                           --> 0 : determined by CRange[] at runtime
+//             --> MONO    : INT_SPEC_MONO_NO/YES/RUNTIME
+//                           --> Not used by MinMod-1D, MinMod-3D, and vanLeer
+//          2. The generic path Int_XXX() is Int_XXX_Kernel<0, 0, 0, INT_SPEC_MONO_RUNTIME>()
+//          3. Kernels with fixed CRange[] and monotonicity are instantiated for all shapes in INT_SPEC_SHAPE_LIST
+//             and stored in the table Int_XXX_Spec[INT_SPEC_NSHAPE][2]
+//             --> [1st dimension] : shape index in INT_SPEC_SHAPE_LIST
+//                 [2nd dimension] : (0/1) = (INT_SPEC_MONO_NO/YES)
+//             --> Temporary arrays of these kernels are allocated on the stack
+//          4. Interpolate() looks up this table and falls back to the generic path for other shapes
+//-------------------------------------------------------------------------------------------------------
+
+// monotonicity of the specialized kernels
+#define INT_SPEC_MONO_RUNTIME    -1    // determined by Monotonic[] at runtime (for the generic path only)
+#define INT_SPEC_MONO_NO          0    // all components are interpolated without the monotonicity constraint
+#define INT_SPEC_MONO_YES         1    // all components are interpolated with    the monotonicity constraint
+
+
+// coarse-grid shapes (CRX, CRY, CRZ) with specialized kernels
+// --> (PS1, PS1, PS1): grid refinement in Refine() and LB_Refine_AllocateNewPatch()
+// --> others         : ghost-zone interpolation in InterpolateGhostZone() with GhostSize <= 6,
+//                      for which CRange[] = (GhostSize+1)/2 along the directions normal to FSide and PS1 otherwise
+#define INT_SPEC_NSHAPE          22
+
+#define INT_SPEC_SHAPE_LIST( SHAPE, FUNC )  \
+   SHAPE( FUNC, PS1, PS1, PS1 )             \
+   INT_SPEC_SHAPE_GHOST( SHAPE, FUNC, 1 )   \
+   INT_SPEC_SHAPE_GHOST( SHAPE, FUNC, 2 )   \
+   INT_SPEC_SHAPE_GHOST( SHAPE, FUNC, 3 )
+
+#define INT_SPEC_SHAPE_GHOST( SHAPE, FUNC, G )                                                        \
+   SHAPE( FUNC,   G, PS1, PS1 )  SHAPE( FUNC, PS1,   G, PS1 )  SHAPE( FUNC, PS1, PS1,   G )           \
+   SHAPE( FUNC, PS1,   G,   G )  SHAPE( FUNC,   G, PS1,   G )  SHAPE( FUNC,   G,   G, PS1 )           \
+   SHAPE( FUNC,   G,   G,   G )
+
+
+// entries of the shape table and kernel tables generated by INT_SPEC_SHAPE_LIST
+#define INT_SPEC_SHAPE( FUNC, CRX, CRY, CRZ )           { CRX, CRY, CRZ },
+#define INT_SPEC_KERNEL( FUNC, CRX, CRY, CRZ )          { FUNC<CRX,CRY,CRZ,INT_SPEC_MONO_NO>, FUNC<CRX,CRY,CRZ,INT_SPEC_MONO_YES> },
+#define INT_SPEC_KERNEL_NOMONO( FUNC, CRX, CRY, CRZ )   { FUNC<CRX,CRY,CRZ>, FUNC<CRX,CRY,CRZ> },
+
+
+// size of the temporary arrays of the specialized kernels
+// --> return 1 for the generic path to avoid zero-length arrays
+#define INT_SPEC_FIX_SHAPE( CRX, CRY, CRZ )                  ( (CRX) > 0  &&  (CRY) > 0  &&  (CRZ) > 0 )
+#define INT_SPEC_TSIZE_X( CRX, CRY, CRZ, CGhost )                                                     \
+   (  INT_SPEC_FIX_SHAPE( CRX, CRY, CRZ ) ? 2*(CRX)*((CRY)+2*(CGhost))*((CRZ)+2*(CGhost)) : 1  )
+#define INT_SPEC_TSIZE_Y( CRX, CRY, CRZ, CGhost )                                                     \
+   (  INT_SPEC_FIX_SHAPE( CRX, CRY, CRZ ) ? 4*(CRX)*(CRY)*((CRZ)+2*(CGhost))         : 1  )
+
+
+
+#endif // #ifndef __INT_SPECIALIZED_H__
@@ -617,6 +617,14 @@
 #  define MASSIVE_PARTICLES
 # endif
 
+// maximum number of particles per rank processed at a time when loading PAR_IC and redistributing particles
+// --> to bound the size of the temporary buffers
+#  define PAR_CHUNK_SIZE            4194304L
+
+// number of particles processed at a time in the CIC/TSC mass assignment
+// --> weights of all particles in a batch are computed together in loops that can be vectorized by the compiler
+#  define PAR_MASS_ASSIGN_BATCH     64
+
 #else // #ifdef PARTICLE
 
 // total density equals gas density if there is no particle
@@ -845,6 +853,12 @@
 #endif
 
 
+// number of ghost zones for the RKL2 cosmic-ray diffusion solver
+#ifdef CR_DIFFUSION
+#        define CR_DIFF_GHOST_SIZE  1
+#endif
+
+
 
 // patch size (number of cells of a single patch in the x/y/z directions)
 #define PS1             ( 1*PATCH_SIZE )
@@ -882,6 +896,10 @@
 #ifdef FEEDBACK
 #  define FB_NXT        ( PS2 + 2*FB_GHOST_SIZE )                 // use patch group as the unit
 #endif
+#ifdef CR_DIFFUSION
+#  define CR_DIFF_NXT    ( PS2 + 2*CR_DIFF_GHOST_SIZE )           // use patch group as the unit
+#  define CR_DIFF_NXT_P1 ( CR_DIFF_NXT + 1 )
+#endif
 #if ( ELBDM_SCHEME == ELBDM_HYBRID )
 #  define HYB_NXT       ( PS2 + 2*HYB_GHOST_SIZE )
 #else
@@ -933,6 +951,13 @@
 // only apply iterations to broken cells in Interpolate_Iterate()
 #define INTERP_MASK
 
+// only recompute the coarse cells with broken fine cells in Interpolate_Iterate() (must work with INTERP_MASK)
+#define INTERP_MASK_LOCAL
+
+#if ( defined INTERP_MASK_LOCAL  &&  !defined INTERP_MASK )
+#  error : ERROR : INTERP_MASK_LOCAL must work with INTERP_MASK !!
+#endif
+
 // used by INTERP_MASK for now but can be applied to other places in the future
 #define MASKED                   true
 #define UNMASKED                 false
@@ -1041,6 +1066,12 @@
 #endif
 
 
+// marker indicating that the array "ext_pot_cache" has NOT been properly set
+#ifdef GRAVITY
+#  define EXT_POT_CACHE_NEED_INIT   __FLT_MAX__
+#endif
+
+
 // marker indicating that the array "rho_ext" has NOT been properly set
 #ifdef PARTICLE
 #  define RHO_EXT_NEED_INIT      __FLT_MAX__
@@ -1102,6 +1133,10 @@
 #define MAX_STRING         512
 
 
+// initial value of Aux_Hash() (i.e., the 64-bit FNV-1a offset basis)
+#define AUX_HASH_INIT      14695981039346656037UL
+
+
 // MPI floating-point data type
 #ifdef FLOAT8
 #  define MPI_GAMER_REAL MPI_DOUBLE
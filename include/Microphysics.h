@@ -18,6 +18,8 @@
 //                CR_diff_coeff_para : Cosmic-ray diffusion coefficients parallel/perpendicular to the
 //                CR_diff_coeff_perp   magnetic field (runtime parameters: CR_DIFF_PARA, CR_DIFF_PERP)
 //                CR_diff_min_b      : minimum magnetic field for enabling diffusion (runtime parameter: CR_DIFF_MIN_B)
+//                CR_diff_rkl2       : integrate diffusion by the RKL2 super-time-stepping solver instead of the fluid solver
+//                                     (runtime parameter: CR_DIFF_RKL2)
 //
 // Method      :  None --> It seems that CUDA does not support functions in a struct
 //-------------------------------------------------------------------------------------------------------
@@ -29,6 +31,7 @@ struct MicroPhy_t
    real CR_diff_coeff_para;
    real CR_diff_coeff_perp;
    real CR_diff_min_b;
+   bool CR_diff_rkl2;
 #  endif
 
 // somehow the structure itself cannot be empty, so we declare a useless bool variable to avoid the issue
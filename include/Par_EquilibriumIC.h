@@ -40,6 +40,8 @@ class Par_EquilibriumIC
 //    main construction process functions to be called
       void   constructDistribution();
       void   constructParticles( real_par *Mass_AllRank, real_par *Pos_AllRank[3], real_par *Vel_AllRank[3], const long Par_Idx );
+      void   constructParticlesInRange( real_par *Mass_ThisRank, real_par *Pos_ThisRank[3], real_par *Vel_ThisRank[3],
+                                        const long Par_Idx0, const long Cloud_ParIdx_Start, const long Cloud_ParIdx_End );
 
 //    results to be returned
       double TotCloudMass                    = -1;
@@ -67,9 +69,15 @@ class Par_EquilibriumIC
       double getDensity                       ( const double r );
       double getAnalEnclosedMass              ( const double r );
       double getExternalPotential             ( const double r );
-      double getRandomSampleVelocity          ( const double r );
       double getIntegratedDistributionFunction( const double E );
-      void   getRandomVector_GivenLength      ( const double Length, double RandomVector[3] );
+      template <typename RNG_t>
+      double getRandomSampleVelocity          ( const double r, RNG_t *RNG, const int TID, double *CumulProbaDistr );
+      template <typename RNG_t>
+      void   getRandomVector_GivenLength      ( const double Length, double RandomVector[3], RNG_t *RNG, const int TID );
+      template <typename RNG_t>
+      void   getRandomParticle                ( double RandomVectorR[3], double RandomVectorV[3], RNG_t *RNG, const int TID,
+                                                double *CumulProbaDistr );
+      void   setParticleMass();
 
 //    input table of density profile
       void    loadInputDensProfTable();
@@ -113,7 +121,7 @@ class Par_EquilibriumIC
       double *CumulProbaDistr_GivenRadius = NULL;
 
 //    random number generator
-      RandomNumber_t *Random_Num_Gen;
+      RandomNumber_t *Random_Num_Gen = NULL;
 
 //    flags to record the action status of function calls
       bool    hasSetCenterAndBulkVel      = false;
@@ -107,6 +107,7 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 //               ~Particle_t        : Destructor
 //                InitRepo          : Initialize particle repository
 //                AddOneParticle    : Add one new particle into the particle list
+//                AddParticles      : Add multiple new particles into the particle list at once
 //                RemoveOneParticle : Remove one particle from the particle list
 //-------------------------------------------------------------------------------------------------------
 struct Particle_t
@@ -526,6 +527,104 @@ struct Particle_t
 
 
 
+   //===================================================================================
+   // Method      :  AddParticles
+   // Description :  Add multiple new particles into the particle list at once
+   //
+   // Note        :  1. Same as calling AddOneParticle() for each new particle in order, except that
+   //                   the particle attribute arrays are reallocated at most once
+   //                   --> Particle IDs only depend on the order of particles in NewAttFlt[] and NewAttInt[]
+   //                2. NOT thread-safe --> must be invoked outside OpenMP parallel regions
+   //                3. Inactive particle IDs are reassigned to the first new particles
+   //                4. Note that the global variable "AveDensity_Init" will NOT be recalculated
+   //                   automatically here
+   //
+   // Parameter   :  NNew      : Number of new particles to be added
+   //                NewAttFlt : Array storing the floating-point attributes of new particles
+   //                NewAttInt : Array storing the integer        attributes of new particles
+   //                NewParID  : Array to store the indices of new particles (ParID)
+   //
+   // Return      :  NewParID[]
+   //===================================================================================
+   void AddParticles( const long NNew, const real_par (*NewAttFlt)[PAR_NATT_FLT_TOTAL],
+                      const long_par (*NewAttInt)[PAR_NATT_INT_TOTAL], long *NewParID )
+   {
+
+//    check
+#     ifdef DEBUG_PARTICLE
+      if ( NNew < 0 )   Aux_Error( ERROR_INFO, "NNew (%ld) < 0 !!\n", NNew );
+
+      if ( NNew > 0  &&  ( NewAttFlt == NULL || NewAttInt == NULL || NewParID == NULL ) )
+         Aux_Error( ERROR_INFO, "NewAttFlt/NewAttInt/NewParID == NULL !!\n" );
+
+      for (long p=0; p<NNew; p++)
+      {
+         if ( NewAttFlt[p][PAR_MASS] < (real_par)0.0 )
+            Aux_Error( ERROR_INFO, "Adding an inactive particle (mass = %21.14e) !!\n", NewAttFlt[p][PAR_MASS] );
+
+         if ( NewAttInt[p][PAR_TYPE] < (long_par)0  ||  NewAttInt[p][PAR_TYPE] >= (long_par)PAR_NTYPE )
+            Aux_Error( ERROR_INFO, "Incorrect particle type (%ld) !!\n", (long)NewAttInt[p][PAR_TYPE] );
+      }
+#     endif
+
+
+//    1. determine the target particle IDs
+//    1-1. reuse inactive particle IDs in the same order as AddOneParticle()
+      const long NReuse = MIN( NNew, NPar_Inactive );
+
+      for (long p=0; p<NReuse; p++)    NewParID[p] = InactiveParList[ NPar_Inactive-1-p ];
+
+      NPar_Inactive -= NReuse;
+
+//    1-2. add new particle IDs
+      const long NAppend = NNew - NReuse;
+
+      if ( NPar_AcPlusInac + NAppend > ParListSize )
+      {
+         ParListSize = (long)ceil( PARLIST_GROWTH_FACTOR*(NPar_AcPlusInac+NAppend) );
+
+         for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)   AttributeFlt[v] = (real_par*)realloc( AttributeFlt[v], ParListSize*sizeof(real_par) );
+         for (int v=0; v<PAR_NATT_INT_TOTAL; v++)   AttributeInt[v] = (long_par*)realloc( AttributeInt[v], ParListSize*sizeof(long_par) );
+
+         Mass = AttributeFlt[PAR_MASS];
+         PosX = AttributeFlt[PAR_POSX];
+         PosY = AttributeFlt[PAR_POSY];
+         PosZ = AttributeFlt[PAR_POSZ];
+         VelX = AttributeFlt[PAR_VELX];
+         VelY = AttributeFlt[PAR_VELY];
+         VelZ = AttributeFlt[PAR_VELZ];
+         Time = AttributeFlt[PAR_TIME];
+#        ifdef STORE_PAR_ACC
+         AccX = AttributeFlt[PAR_ACCX];
+         AccY = AttributeFlt[PAR_ACCY];
+         AccZ = AttributeFlt[PAR_ACCZ];
+#        endif
+         Type = AttributeInt[PAR_TYPE];
+      }
+
+      for (long p=0; p<NAppend; p++)   NewParID[ NReuse + p ] = NPar_AcPlusInac + p;
+
+      NPar_AcPlusInac += NAppend;
+
+
+//    2. record the data of new particles
+#     pragma omp parallel for schedule( static )
+      for (long p=0; p<NNew; p++)
+      {
+         const long ParID = NewParID[p];
+
+         for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)   AttributeFlt[v][ParID] = NewAttFlt[p][v];
+         for (int v=0; v<PAR_NATT_INT_TOTAL; v++)   AttributeInt[v][ParID] = NewAttInt[p][v];
+      }
+
+
+//    3. update the total number of active particles (assuming all new particles are active)
+      NPar_Active += NNew;
+
+   } // METHOD : AddParticles
+
+
+
    //===================================================================================
    // Method      :  RemoveOneParticle
    // Description :  Remove ONE particle from the particle list
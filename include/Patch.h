@@ -16,6 +16,8 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 void Aux_Message( FILE *Type, const char *Format, ... );
 ulong Mis_Idx3D2Idx1D( const int Size[], const int Idx3D[] );
 long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
+real *Mis_PatchSlab_New( const PatchSlab_t Type, const int lv, const int Sg );
+bool  Mis_PatchSlab_Delete( void *Ptr );
 
 
 
@@ -34,6 +36,11 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                          (not from exchanging potential between sibling patches)
 //                                      --> Currently it is used for Par->ImproveAcc and SF_CreateStar_AGORA() only
 //                                      --> Currently it's useless for buffer patches
+//                ext_pot_cache       : External potential evaluated from the tabulated external potential (EXT_POT_TABLE)
+//                                      --> Allocated and filled by Poi_UpdateExtPotCache() only if EXT_POT_TABLE_CACHE is on
+//                                      --> Only allocated for Sg=0 since the tabulated potential is time-independent
+//                                      --> ext_pot_cache[0][0][0] == EXT_POT_CACHE_NEED_INIT indicates that it must be
+//                                          recomputed (e.g., after the patch is reactivated at a different position)
 //                de_status           : Assigned to (DE_UPDATED_BY_ETOT / DE_UPDATED_BY_DUAL / DE_UPDATED_BY_MIN_PRES /
 //                                                   DE_UPDATED_BY_ETOT_GRA)
 //                                      to indicate whether each cell is updated by the total energy, dual energy variable,
@@ -51,6 +58,8 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                          still allocate rho_ext as (PS1+RHOEXT_GHOST_SIZE)^3
 //                flux[6]             : Fluid flux (for the flux-correction operation)
 //                                      --> Including passively advected flux (for the flux-correction operation)
+//                                      --> flux, flux_tmp, and flux_bitrep point to the level-wide flux register
+//                                          amr->FluxReg[lv] and are NOT owned by this patch (see FluxRegister.h)
 //                flux_tmp[6]         : Temporary fluid flux for the option "AUTO_REDUCE_DT"
 //                flux_bitrep[6]      : Fluid flux for achieving bitwise reproducibility (i.e., ensuring that the round-off errors are
 //                                      exactly the same in different parallelization parameters/strategies)
@@ -122,6 +131,8 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 //                                          3D corner coordinates
 //                                      --> This number is independent of periodicity (because of the padded patches)
 //                LB_Idx              : Space-filling-curve index for load balance
+//                slab_lv/sg          : Refinement level and sandglass of this patch
+//                                      --> Used by OPT__PATCH_SLAB to select the slab blocks of fluid[], magnetic[], and pot[]
 //                NPar                : Number of particles belonging to this leaf patch
 //                NParType            : Number of different types of particles belonging to this leaf patch
 //                ParListSize         : Size of the array ParList (ParListSize can be >= NPar)
@@ -166,8 +177,8 @@ long  LB_Corner2Index( const int lv, const int Corner[], const Check_t Check );
 // Method      :  patch_t        : Constructor
 //               ~patch_t        : Destructor
 //                Activate       : Activate patch
-//                fnew           : Allocate flux[]
-//                fdelete        : Deallocate flux[]
+//                fnew           : Attach flux[]
+//                fdelete        : Detach flux[]
 //                enew           : Allocate electric[]
 //                edelete        : Deallocate electric[]
 //                hnew           : Allocate fluid[]
@@ -199,6 +210,7 @@ struct patch_t
 #  ifdef STORE_POT_GHOST
    real (*pot_ext)[GRA_NXT][GRA_NXT];
 #  endif
+   real (*ext_pot_cache)[PS1][PS1];
 #  endif // GRAVITY
 
 #  ifdef DUAL_ENERGY
@@ -236,6 +248,9 @@ struct patch_t
    ulong  PaddedCr1D;
    long   LB_Idx;
 
+   int    slab_lv;
+   int    slab_sg;
+
 #  ifdef PARTICLE
    int    NPar;
    int    NParType[PAR_NTYPE];
@@ -276,18 +291,19 @@ struct patch_t
    //                DE_Status   : true --> Allocate the dual-energy status array de_status[]
    //                                       --> Useless if "DUAL_ENERGY" is turned off
    //                lv          : Refinement level of the newly created patch
+   //                Sg          : Sandglass of the newly created patch
    //                BoxScale    : Simulation box scale
    //                BoxEdgeL    : Simulation box left edge
    //                dh_min      : Cell size at the maximum level
    //===================================================================================
    patch_t( const int scale_x, const int scale_y, const int scale_z, const int FaPID, const bool FluData,
-            const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int BoxScale[],
-            const double BoxEdgeL[], const double dh_min )
+            const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int Sg,
+            const int BoxScale[], const double BoxEdgeL[], const double dh_min )
    {
 
 //    always initialize field pointers (e.g., fluid, pot, ...) as NULL if they are not allocated here
       const bool InitPtrAsNull_Yes = true;
-      Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, DE_Status, lv, BoxScale,
+      Activate( scale_x, scale_y, scale_z, FaPID, FluData, MagData, PotData, DE_Status, lv, Sg, BoxScale,
                 BoxEdgeL, dh_min, InitPtrAsNull_Yes );
 
    } // METHOD : patch_t
@@ -311,6 +327,7 @@ struct patch_t
    //                DE_Status     : true --> Allocate the dual-energy status array de_status[]
    //                                         --> Useless if "DUAL_ENERGY" is turned off
    //                lv            : Refinement level of the newly created patch
+   //                Sg            : Sandglass of the newly created patch
    //                BoxScale      : Simulation box scale
    //                BoxEdgeL      : Simulation box left edge
    //                dh_min        : Cell size at the maximum level
@@ -328,8 +345,8 @@ struct patch_t
    //                                --> Does not apply to any particle variable (except rho_ext)
    //===================================================================================
    void Activate( const int scale_x, const int scale_y, const int scale_z, const int FaPID, const bool FluData,
-                  const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int BoxScale[],
-                  const double BoxEdgeL[], const double dh_min, const bool InitPtrAsNull )
+                  const bool MagData, const bool PotData, const bool DE_Status, const int lv, const int Sg,
+                  const int BoxScale[], const double BoxEdgeL[], const double dh_min, const bool InitPtrAsNull )
    {
 
       corner[0] = scale_x;
@@ -339,6 +356,8 @@ struct patch_t
       son       = -1;
       flag      = false;
       Active    = true;
+      slab_lv   = lv;
+      slab_sg   = Sg;
 
 #     if ( ELBDM_SCHEME == ELBDM_HYBRID )
 //    do not switch to fluid scheme by default
@@ -400,6 +419,7 @@ struct patch_t
 #        ifdef STORE_POT_GHOST
          pot_ext   = NULL;
 #        endif
+         ext_pot_cache = NULL;
 #        endif // #ifdef GRAVITY
 
 #        ifdef DUAL_ENERGY
@@ -437,6 +457,9 @@ struct patch_t
 #     endif
 #     ifdef GRAVITY
       if ( PotData )    gnew();
+
+//    ext_pot_cache[] of a reused patch was evaluated at its previous position
+      if ( ext_pot_cache != NULL )  ext_pot_cache[0][0][0] = EXT_POT_CACHE_NEED_INIT;
 #     endif
 #     ifdef DUAL_ENERGY
       if ( DE_Status )  snew();
@@ -524,14 +547,17 @@ struct patch_t
 
    //===================================================================================
    // Method      :  fnew
-   // Description :  Allocate flux[] in the given direction
+   // Description :  Attach flux[] in the given direction to the input arrays
    //
-   // Note        :  flux[] will be initialized as zero
+   // Note        :  1. Input arrays are allocated and initialized by the flux register FluxReg_t::Build()
+   //                2. Flux_Tmp and Flux_BitRep can be NULL
    //
-   // Parameter   :  SibID    : Targeted sibling direction (0,1,2,3,4,5) <--> (-x,+x,-y,+y,-z,+z)
-   //                AllocTmp : Allocate the temporary flux array flux_tmp[]
+   // Parameter   :  SibID       : Targeted sibling direction (0,1,2,3,4,5) <--> (-x,+x,-y,+y,-z,+z)
+   //                Flux        : Array to be attached to flux       [SibID]
+   //                Flux_Tmp    : Array to be attached to flux_tmp   [SibID]
+   //                Flux_BitRep : Array to be attached to flux_bitrep[SibID] --> useless if BIT_REP_FLUX is off
    //===================================================================================
-   void fnew( const int SibID, const bool AllocTmp )
+   void fnew( const int SibID, real (*Flux)[PS1][PS1], real (*Flux_Tmp)[PS1][PS1], real (*Flux_BitRep)[PS1][PS1] )
    {
 
 #     ifdef GAMER_DEBUG
@@ -541,58 +567,42 @@ struct patch_t
       if ( flux[SibID] != NULL )
          Aux_Error( ERROR_INFO, "flux[%d] already exists !!\n", SibID );
 
-      if ( AllocTmp  &&  flux_tmp[SibID] != NULL )
+      if ( flux_tmp[SibID] != NULL )
          Aux_Error( ERROR_INFO, "flux_tmp[%d] already exists !!\n", SibID );
 
 #     ifdef BIT_REP_FLUX
       if ( flux_bitrep[SibID] != NULL )
          Aux_Error( ERROR_INFO, "flux_bitrep[%d] already exists !!\n", SibID );
+
+      if ( Flux_BitRep == NULL )
+         Aux_Error( ERROR_INFO, "Flux_BitRep == NULL !!\n" );
 #     endif
 #     endif
 
-      flux      [SibID]  = new real [NFLUX_TOTAL][PS1][PS1];
-      if ( AllocTmp )
-      flux_tmp  [SibID]  = new real [NFLUX_TOTAL][PS1][PS1];
+      flux       [SibID] = Flux;
+      flux_tmp   [SibID] = Flux_Tmp;
 #     ifdef BIT_REP_FLUX
-      flux_bitrep[SibID] = new real [NFLUX_TOTAL][PS1][PS1];
+      flux_bitrep[SibID] = Flux_BitRep;
 #     endif
 
-      for(int v=0; v<NFLUX_TOTAL; v++)
-      for(int m=0; m<PS1; m++)
-      for(int n=0; n<PS1; n++)
-      {
-         flux       [SibID][v][m][n] = 0.0;
-         /*
-//       no need to initialize flux_tmp[]
-         if ( AllocTmp )
-         flux_tmp   [SibID][v][m][n] = 0.0;
-         */
-#        ifdef BIT_REP_FLUX
-         flux_bitrep[SibID][v][m][n] = 0.0;
-#        endif
-      }
-
    } // METHOD : fnew
 
 
 
    //===================================================================================
    // Method      :  fdelete
-   // Description :  Deallocate flux[] along all directions
+   // Description :  Detach flux[] along all directions
+   //
+   // Note        :  Flux arrays are deallocated by the flux register FluxReg_t
    //===================================================================================
    void fdelete()
    {
 
       for (int s=0; s<6; s++)
       {
-         delete [] flux[s];
-         flux[s] = NULL;
-
-         delete [] flux_tmp[s];
-         flux_tmp[s] = NULL;
-
+         flux       [s] = NULL;
+         flux_tmp   [s] = NULL;
 #        ifdef BIT_REP_FLUX
-         delete [] flux_bitrep[s];
          flux_bitrep[s] = NULL;
 #        endif
       }
@@ -686,14 +696,16 @@ struct patch_t
    // Method      :  hnew
    // Description :  Allocate fluid[]
    //
-   // Note        :  Do nothing if fluid[] has been allocated
+   // Note        :  1. Do nothing if fluid[] has been allocated
+   //                2. Allocate it from the slab blocks of slab_lv and slab_sg when OPT__PATCH_SLAB is on
    //===================================================================================
    void hnew()
    {
 
       if ( fluid == NULL )
       {
-         fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
+         fluid = ( real (*)[PS1][PS1][PS1] )Mis_PatchSlab_New( SLAB_FLU, slab_lv, slab_sg );
+         if ( fluid == NULL )    fluid = new real [NCOMP_TOTAL][PS1][PS1][PS1];
          fluid[0][0][0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -708,7 +720,7 @@ struct patch_t
    void hdelete()
    {
 
-      delete [] fluid;
+      if ( !Mis_PatchSlab_Delete( fluid ) )   delete [] fluid;
       fluid = NULL;
 
 #     ifdef MASSIVE_PARTICLES
@@ -725,14 +737,16 @@ struct patch_t
    // Method      :  mnew
    // Description :  Allocate magnetic[]
    //
-   // Note        :  Do nothing if magnetic[] has been allocated
+   // Note        :  1. Do nothing if magnetic[] has been allocated
+   //                2. Allocate it from the slab blocks of slab_lv and slab_sg when OPT__PATCH_SLAB is on
    //===================================================================================
    void mnew()
    {
 
       if ( magnetic == NULL )
       {
-         magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
+         magnetic = ( real (*)[ PS1P1*SQR(PS1) ] )Mis_PatchSlab_New( SLAB_MAG, slab_lv, slab_sg );
+         if ( magnetic == NULL ) magnetic = new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
          magnetic[0][0] = (real)-1.0;  // arbitrarily initialized
       }
 
@@ -747,7 +761,7 @@ struct patch_t
    void mdelete()
    {
 
-      delete [] magnetic;
+      if ( !Mis_PatchSlab_Delete( magnetic ) )   delete [] magnetic;
       magnetic = NULL;
 
    } // METHOD : mdelete
@@ -760,12 +774,17 @@ struct patch_t
    // Method      :  gnew
    // Description :  Allocate pot[] (and pot_ext[] for STORE_POT_GHOST)
    //
-   // Note        :  Do nothing if pot[] (and pot_ext[] for STORE_POT_GHOST) has been allocated
+   // Note        :  1. Do nothing if pot[] (and pot_ext[] for STORE_POT_GHOST) has been allocated
+   //                2. Allocate pot[] from the slab blocks of slab_lv and slab_sg when OPT__PATCH_SLAB is on
    //===================================================================================
    void gnew()
    {
 
-      if ( pot == NULL )      pot     = new real [PS1][PS1][PS1];
+      if ( pot == NULL )
+      {
+         pot = ( real (*)[PS1][PS1] )Mis_PatchSlab_New( SLAB_POT, slab_lv, slab_sg );
+         if ( pot == NULL )      pot = new real [PS1][PS1][PS1];
+      }
 
 #     ifdef STORE_POT_GHOST
       if ( pot_ext == NULL )  pot_ext = new real [GRA_NXT][GRA_NXT][GRA_NXT];
@@ -781,12 +800,12 @@ struct patch_t
 
    //===================================================================================
    // Method      :  gdelete
-   // Description :  Deallocate pot[] (and pot_ext[] for STORE_POT_GHOST)
+   // Description :  Deallocate pot[] (and pot_ext[] for STORE_POT_GHOST) and ext_pot_cache[]
    //===================================================================================
    void gdelete()
    {
 
-      delete [] pot;
+      if ( !Mis_PatchSlab_Delete( pot ) )    delete [] pot;
       pot = NULL;
 
 #     ifdef STORE_POT_GHOST
@@ -794,6 +813,9 @@ struct patch_t
       pot_ext = NULL;
 #     endif
 
+      delete [] ext_pot_cache;
+      ext_pot_cache = NULL;
+
    } // METHOD : gdelete
 #  endif // #ifdef GRAVITY
 
@@ -11,6 +11,7 @@
 // Auxiliary
 void Aux_Check_MemFree( const double MinMemFree_Total, const char *comment );
 void Aux_Check_Conservation( const char *comment );
+void Aux_Check_Conservation_AddDiag();
 void Aux_Check_NormalizePassive( const int lv, const char *comment );
 void Aux_Check();
 void Aux_Check_Finite( const int lv, const char *comment );
@@ -24,6 +25,7 @@ void Aux_Error( const char *File, const int Line, const char *Func, const char *
 bool Aux_CheckFileExist( const char *FileName );
 bool Aux_CheckFolderExist( const char *FolderName );
 bool Aux_CheckPermission( const char *FileName, const int perms );
+ulong Aux_Hash( const void *Data, const long NByte, const ulong Seed );
 void Aux_GetCPUInfo( const char *FileName );
 void Aux_GetMemInfo();
 void Aux_Message( FILE *Type, const char *Format, ... );
@@ -37,6 +39,7 @@ void Aux_Record_PatchCount();
 void Aux_Record_Performance( const double ElapsedTime );
 void Aux_Record_CorrUnphy();
 void Aux_Record_Center();
+void Aux_Record_Center_AddDiag();
 int  Aux_CountRow( const char *FileName );
 void Aux_ComputeProfile( Profile_t *Prof[], const double Center[], const double r_max_input, const double dr_min,
                          const bool LogBin, const double LogBinRatio, const bool RemoveEmpty, const long TVarBitIdx[],
@@ -46,6 +49,13 @@ void Aux_FindExtrema( Extrema_t *Extrema, const ExtremaMode_t Mode, const int Mi
                       const PatchType_t PatchType );
 void Aux_FindWeightedAverageCenter( double WeightedAverageCenter[], const double Center_ref[], const double MaxR, const double MinWD,
                                     const long WeightingDensityField, const double TolErrR, const int MaxIter, double *FinaldR, int *FinalNIter );
+void Aux_Diagnostics();
+void Aux_Diag_Add( DiagConsumer_t *Diag );
+void Aux_Diag_Execute();
+void Aux_Diag_SetExtrema( DiagConsumer_t *Diag, Extrema_t *Extrema, const ExtremaMode_t Mode );
+void Aux_Diag_GetExtrema( const DiagConsumer_t *Diag, Extrema_t *Extrema );
+void Aux_Diag_SetWeightedCenter( DiagConsumer_t *Diag, const long Field );
+void Aux_Diag_GetWeightedCenter( const DiagConsumer_t *Diag, double WeightedAverageCenter[] );
 #ifndef SERIAL
 void Aux_Record_BoundaryPatch( const int lv, int *NList, int **IDList, int **PosList );
 #endif
@@ -174,7 +184,9 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 const int NPG, const int *PID0_List,
                 const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                 const real h_Mag_Array_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
-                const double dt );
+                const double h_Corner_Array_F[][3],
+                const real h_Pot_Array_USG_F[][ CUBE(USG_NXT_F) ],
+                const double TimeOld, const double dt );
 void Flu_Prepare( const int lv, const double PrepTime,
                   real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                   real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
@@ -261,6 +273,7 @@ void Init_ByRestart_HDF5( const char *FileName );
 #ifdef SUPPORT_FFTW
 void End_FFTW();
 void Init_FFTW();
+void FFTW_GetCacheFileName( char *FileName, const char *Prefix, const ulong Key, const int Rank );
 void Patch2Slab( real *VarS, real *SendBuf_Var, real *RecvBuf_Var, long *SendBuf_SIdx, long *RecvBuf_SIdx,
                  int **List_PID, int **List_k, long *List_NSend_Var, long *List_NRecv_Var,
                  const int *List_z_start, const int local_nz, const int FFT_Size[], const int NRecvSlice,
@@ -271,6 +284,21 @@ void Slab2Patch( const real *VarS, real *SendBuf, real *RecvBuf, const int SaveS
 #endif // #ifdef SUPPORT_FFTW
 void Microphysics_Init();
 void Microphysics_End();
+#ifdef CR_DIFFUSION
+void Init_MemAllocate_CR_Diff( const int CR_Diff_NPG );
+void End_MemFree_CR_Diff();
+void CR_Diff_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                        const int SaveSg_Flu, const int SaveSg_Mag );
+void CR_Diff_Prepare( const int lv, const double PrepTime,
+                      real h_CR_Diff_Array_In[][ CUBE(CR_DIFF_NXT) ],
+                      real h_CR_Diff_Mag_In[][NCOMP_MAG][ CR_DIFF_NXT_P1*SQR(CR_DIFF_NXT) ],
+                      const int NPG, const int *PID0_List );
+void CR_Diff_Close( const int lv, const real h_CR_Diff_Array_Out[][ CUBE(PS2) ], const int NPG, const int *PID0_List );
+void CPU_CR_DiffusionSolver( const real g_CRay_In[][ CUBE(CR_DIFF_NXT) ],
+                             const real g_Mag_In[][NCOMP_MAG][ CR_DIFF_NXT_P1*SQR(CR_DIFF_NXT) ],
+                                   real g_LCRay_Out[][ CUBE(PS2) ],
+                             const int NPatchGroup, const real dh, const MicroPhy_t MicroPhy );
+#endif
 
 
 // Interpolation
@@ -312,6 +340,10 @@ template <typename U, typename T> U Mis_Matching_int( const U N, const T Array[]
 template <typename T> bool  Mis_CompareRealValue( const T Input1, const T Input2, const char *comment, const bool Verbose );
 template <typename T> void Mis_SortByRows( T const* const* Array, long *IdxTable, const long NSort, const int *SortOrder, const int NOrder );
 ulong  Mis_Idx3D2Idx1D( const int Size[], const int Idx3D[] );
+void   Mis_PatchSlab_Repack( const int lv );
+void   Mis_AdjustMemoryPool();
+void   Mis_RecordMemoryPool();
+void   Mis_PatchSlab_Free();
 double Mis_GetTimeStep( const int lv, const double dTime_SyncFaLv, const double AutoReduceDtCoeff );
 double Mis_dTime2dt( const double Time_In, const double dTime_In );
 void   Mis_GetTotalPatchNumber( const int lv );
@@ -350,6 +382,8 @@ template <typename T> void MPI_Alltoallv_GAMER( T * SendBuf, long *Send_NCount,
 void Output_DumpData( const int Stage );
 void Output_DumpData_Part( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
                            const double z, const char *FileName );
+void Output_DumpData_Part_Binary( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
+                                  const double z, const int ProjLv, const char *FileName );
 void Output_DumpData_Total( const char *FileName );
 #ifdef SUPPORT_HDF5
 void Output_DumpData_Total_HDF5( const char *FileName );
@@ -470,6 +504,7 @@ void Poi_Prepare_Rho( const int lv, const double PrepTime, real h_Rho_Array_P[][
 #ifdef STORE_POT_GHOST
 void Poi_StorePotWithGhostZone( const int lv, const int PotSg, const bool AllPatch );
 #endif
+bool Poi_UpdateExtPotCache( const int lv );
 #endif // #ifdef GRAVITY
 
 
@@ -616,6 +651,11 @@ double ELBDM_GetTimeStep_Phase( const int lv );
 double ELBDM_GetTimeStep_Hybrid_CFL( const int lv );
 double ELBDM_GetTimeStep_Hybrid_Velocity( const int lv );
 bool   ELBDM_HasWaveCounterpart( const int I, const int J, const int K, const long GID0, const long GID, const LB_GlobalTree& GlobalTree);
+void   ELBDM_UpdateWaveCounterpartCache( const int lv, LB_GlobalTree *GlobalTree );
+void   ELBDM_PrepareWaveCounterpart( const int lv, bool h_IsCompletelyRefined[], bool h_HasWaveCounterpart[][ CUBE(HYB_NXT) ],
+                                     const int NPG, const int *PID0_List, LB_GlobalTree *GlobalTree );
+bool   ELBDM_GetCachedWaveCounterpart( const int lv, const int PID0, const int I, const int J, const int K );
+void   ELBDM_FreeWaveCounterpartCache();
 void   ELBDM_Aux_Record_Hybrid();
 #endif
 
@@ -728,6 +768,12 @@ void Par_PassParticle2Son_SinglePatch( const int FaLv, const int FaPID );
 void Par_PassParticle2Son_MultiPatch( const int FaLv, const ParPass2Son_t Mode, const bool TimingSendPar,
                                       const int NFaPatch, const int *FaPIDList );
 void Par_PassParticle2Father( const int FaLv, const int FaPID );
+void Par_SortParList( const int lv, const int PID );
+void Par_ReorderRepository();
+void Par_AddNewParticleToPatch( const int lv, const int *NNewPar_EachPatch,
+                                const real_par (*NewParAttFlt)[PAR_NATT_FLT_TOTAL],
+                                const long_par (*NewParAttInt)[PAR_NATT_INT_TOTAL] );
+void Par_AddParticleToPatch( const int lv, const int *NNewPar_EachPatch, const long *NewParID );
 void Par_Aux_Check_Particle( const char *comment );
 void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t IntScheme, real *Rho,
                          const int RhoSize, const double *EdgeL, const double dh, const bool PredictPos,
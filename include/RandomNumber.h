@@ -176,4 +176,173 @@ struct RandomNumber_t
 
 
 
+
+//-------------------------------------------------------------------------------------------------------
+// Structure   :  CounterRandomNumber_t
+// Description :  Data structure of the counter-based random number generator
+//
+// Note        :  1. The n-th random number of a stream is a hash of ( Key, n ), where Key is a hash of
+//                   ( Seed, Stream ) set by SetSeed()
+//                   --> Random numbers of a stream do not depend on which RNG and how many other streams
+//                       are used before
+//                   --> Useful for generating random numbers per item (e.g., per particle) that are independent
+//                       of the numbers of OpenMP threads and MPI ranks
+//                2. Adopt the SplitMix64 mixing function
+//                   --> Ref: G. L. Steele, D. Lea, and C. H. Flood, 2014, OOPSLA '14, 453
+//                3. Same interface as RandomNumber_t except that SetSeed() takes an additional stream index
+//                4. Thread-safe as long as different threads use different RNG IDs
+//
+// Data Member :  Key     : Key of the current stream of each RNG
+//                Counter : Number of random numbers drawn from the current stream of each RNG
+//                N_RNG   : Total number of RNG
+//
+// Method      :  CounterRandomNumber_t : Constructor
+//               ~CounterRandomNumber_t : Destructor
+//                GetValue              : Return random number
+//                SetSeed               : Set random seed and stream index
+//                Mix                   : SplitMix64 mixing function
+//-------------------------------------------------------------------------------------------------------
+struct CounterRandomNumber_t
+{
+
+// data members
+// ===================================================================================
+   unsigned long *Key;
+   unsigned long *Counter;
+
+   int N_RNG;
+
+
+   //===================================================================================
+   // Constructor :  CounterRandomNumber_t
+   // Description :  Constructor of the structure "CounterRandomNumber_t"
+   //
+   // Note        :  1. Allocate RNG
+   //                2. Call SetSeed() to set the random seed and stream index for each RNG
+   //
+   // Parameter   :  N : Number of RNG to be initialized
+   //                    --> Usually set equal to the number of OpenMP threads
+   //===================================================================================
+   CounterRandomNumber_t( const int N )
+   {
+
+//    check
+      if ( N <= 0 )  Aux_Error( ERROR_INFO, "N (%d) <= 0 !!\n", N );
+
+      N_RNG   = N;
+      Key     = new unsigned long [N];
+      Counter = new unsigned long [N];
+
+      for (int t=0; t<N; t++)
+      {
+         Key    [t] = 0UL;
+         Counter[t] = 0UL;
+      }
+
+   } // METHOD : CounterRandomNumber_t
+
+
+
+   //===================================================================================
+   // Destructor  :  ~CounterRandomNumber_t
+   // Description :  Destructor of the structure "CounterRandomNumber_t"
+   //
+   // Note        :  Free memory
+   //===================================================================================
+   ~CounterRandomNumber_t()
+   {
+
+      delete [] Key;
+      delete [] Counter;
+
+   } // METHOD : ~CounterRandomNumber_t
+
+
+
+   //===================================================================================
+   // Method      :  GetValue
+   // Description :  Return a uniformly distributed random number in the specified range
+   //
+   // Note        :  1. Only return a single random number
+   //                   --> Must specify the ID of the target RNG
+   //
+   // Parameter   :  ID  : Target RNG (0 <= ID < N_RNG)
+   //                Min : Lower limit of the random number
+   //                Max : Upper limit of the random number
+   //
+   // Return      :  Random number
+   //===================================================================================
+   double GetValue( const int ID, const double Min, const double Max )
+   {
+
+//    check
+#     ifdef GAMER_DEBUG
+      if ( ID < 0  ||  ID >= N_RNG )
+         Aux_Error( ERROR_INFO, "incorrect RNG ID = %d (total number of RNG = %d) !!\n", ID, N_RNG );
+#     endif
+
+//    get a uniformly distributed random number in the range [0.0, 1.0) from the upper 53 bits
+      Counter[ID] ++;
+
+      const unsigned long Bits   = Mix( Key[ID] + Counter[ID]*0x9E3779B97F4A7C15UL );
+      const double        Random = (double)( Bits >> 11 ) / 9007199254740992.0;
+
+//    convert the range to [Min, Max) and return
+      return Random*(Max-Min) + Min;
+
+   } // METHOD : GetValue
+
+
+
+   //===================================================================================
+   // Method      :  SetSeed
+   // Description :  Set random seed and stream index for the target RNG
+   //
+   // Note        :  1. Only set random seed for a single RNG
+   //                   --> Must specify the ID of the target RNG
+   //                2. Reset the counter
+   //
+   // Parameter   :  ID     : Target RNG (0 <= ID < N_RNG)
+   //                Seed   : Random seed
+   //                Stream : Stream index (e.g., particle index)
+   //===================================================================================
+   void SetSeed( const int ID, const long Seed, const long Stream )
+   {
+
+//    check
+#     ifdef GAMER_DEBUG
+      if ( ID < 0  ||  ID >= N_RNG )
+         Aux_Error( ERROR_INFO, "incorrect RNG ID = %d (total number of RNG = %d) !!\n", ID, N_RNG );
+#     endif
+
+      Key    [ID] = Mix(  Mix( (unsigned long)Seed ) ^ (unsigned long)Stream  );
+      Counter[ID] = 0UL;
+
+   } // METHOD : SetSeed
+
+
+
+   //===================================================================================
+   // Method      :  Mix
+   // Description :  SplitMix64 mixing function
+   //
+   // Parameter   :  z : Input 64-bit integer
+   //
+   // Return      :  Hashed 64-bit integer
+   //===================================================================================
+   static unsigned long Mix( unsigned long z )
+   {
+
+      z = ( z ^ (z >> 30) )*0xBF58476D1CE4E5B9UL;
+      z = ( z ^ (z >> 27) )*0x94D049BB133111EBUL;
+
+      return z ^ (z >> 31);
+
+   } // METHOD : Mix
+
+
+}; // struct CounterRandomNumber_t
+
+
+
 #endif // #ifndef __RANDOM_NUMBER_H__
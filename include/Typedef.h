@@ -220,7 +220,17 @@ const OptOutputPart_t
    OUTPUT_Y         = 5,
    OUTPUT_Z         = 6,
    OUTPUT_DIAG      = 7,
-   OUTPUT_BOX       = 8;
+   OUTPUT_BOX       = 8,
+   OUTPUT_PROJ_XY   = 9,
+   OUTPUT_PROJ_YZ   = 10,
+   OUTPUT_PROJ_XZ   = 11;
+
+
+// OPT__OUTPUT_PART_FORMAT options
+typedef int OptOutputPartFormat_t;
+const OptOutputPartFormat_t
+   OUTPUT_PART_TEXT    = 1,
+   OUTPUT_PART_CBINARY = 2;
 
 
 // OPT_OUTPUT_PAR_MODE options
@@ -258,6 +268,22 @@ const Check_t
    CHECK_ON  = 1;
 
 
+// OPT__MEMORY_POOL options
+typedef int OptMemPool_t;
+const OptMemPool_t
+   MEMORY_POOL_NONE  = 0,
+   MEMORY_POOL_TABLE = 1,
+   MEMORY_POOL_AUTO  = 2;
+
+
+// field arrays allocated by the patch slab allocator (OPT__PATCH_SLAB)
+typedef int PatchSlab_t;
+const PatchSlab_t
+   SLAB_FLU = 0,
+   SLAB_MAG = 1,
+   SLAB_POT = 2;
+
+
 // modes of Hydro_IsUnphysical()
 typedef int IsUnphyMode_t;
 const IsUnphyMode_t
@@ -297,7 +323,7 @@ const IntPrim_t
 // target solver in InvokeSolver()
 // --> must start from 0 because of the current TIMING_SOLVER implementation
 // --> when adding new solvers, please modify the NSOLVER constant accordingly
-const int NSOLVER = 7;
+const int NSOLVER = 9;
 
 typedef int Solver_t;
 const Solver_t
@@ -315,6 +341,9 @@ const Solver_t
   ,DT_GRA_SOLVER              = 6
 #endif
   ,SRC_SOLVER                 = 7
+#ifdef CR_DIFFUSION
+  ,CR_DIFF_SOLVER             = 8
+#endif
   ;
 
 
@@ -571,6 +600,16 @@ const ExtremaMode_t
    EXTREMA_MAX = 2;
 
 
+// reduction operations of the single-pass diagnostics engine
+typedef int DiagOp_t;
+const DiagOp_t
+   DIAG_OP_SUM    = 1,
+   DIAG_OP_MIN    = 2,
+   DIAG_OP_MAX    = 3,
+   DIAG_OP_MINLOC = 4,
+   DIAG_OP_MAXLOC = 5;
+
+
 // options in LoadInputTestProb()
 typedef int LoadParaMode_t;
 const LoadParaMode_t
@@ -8,6 +8,60 @@ extern double ELBDM_Vcm[3];
 extern double ELBDM_MassPsi;
 #endif
 
+// grid-based reductions evaluated by the single-pass diagnostics engine
+// --> gas quantities (HYDRO only) and the center of mass of fluid
+static DiagConsumer_t Diag_CoM_Flu;
+
+#if ( MODEL == HYDRO )
+// number of gas quantities excluding passive scalars
+// --> mass, momentum (x/y/z), angular momentum (x/y/z), kinetic/internal/potential/[magnetic]/total energies
+#  ifdef MHD
+static const int NVar_Gas = 12;
+#  else
+static const int NVar_Gas = 11;
+#  endif
+
+static DiagConsumer_t Diag_Gas;
+
+static void Diag_Gas_Patch( double Out[], const DiagPatch_t &Patch, const DiagConsumer_t &Diag );
+#endif
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Check_Conservation_AddDiag
+// Description :  Add the grid-based reductions required by Aux_Check_Conservation() to the single-pass
+//                diagnostics engine
+//
+// Note        :  1. Invoked by Aux_Diagnostics() and Aux_Check_Conservation()
+//                2. Results are evaluated by Aux_Diag_Execute()
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Check_Conservation_AddDiag()
+{
+
+#  if ( MODEL == HYDRO )
+   Diag_Gas.Name      = "Conservation_Gas";
+   Diag_Gas.Field     = _NONE;
+   Diag_Gas.Op        = DIAG_OP_SUM;
+   Diag_Gas.NData     = NVar_Gas + NCOMP_PASSIVE;
+   Diag_Gas.PatchFunc = Diag_Gas_Patch;
+   Diag_Gas.Arg       = NULL;
+
+   Aux_Diag_Add( &Diag_Gas );
+#  endif
+
+#  if ( MODEL == HYDRO  ||  MODEL == ELBDM )
+   Aux_Diag_SetWeightedCenter( &Diag_CoM_Flu, _DENS );
+   Aux_Diag_Add( &Diag_CoM_Flu );
+#  endif
+
+} // FUNCTION : Aux_Check_Conservation_AddDiag
+
 
 
 
@@ -21,6 +75,9 @@ extern double ELBDM_MassPsi;
 //                   to estimate errors
 //                3. For simulations with particles (i.e., when PARTICLE is on), the total conserved variables
 //                   (e.g., total energy of gas and particles) will also be recorded
+//                4. Gas quantities (HYDRO only) and the center of mass of fluid are evaluated by the single-pass
+//                   diagnostics engine
+//                   --> Reuse the results evaluated by Aux_Diagnostics() at the current step if available
 //
 // Parameter   :  comment : You can put the location where this function is invoked in this string
 //                          (not used currently)
@@ -57,7 +114,7 @@ void Aux_Check_Conservation( const char *comment )
 
 #  if   ( MODEL == HYDRO )
 #  ifdef MHD
-   const int    NVar_NoPassive    = 12;   // 12: mass, momentum (x/y/z), angular momentum (x/y/z), kinetic/internal/potential/magnetic/total energies
+   const int    NVar_NoPassive    = NVar_Gas;   // 12: mass, momentum (x/y/z), angular momentum (x/y/z), kinetic/internal/potential/magnetic/total energies
                                           // --> note that **total energy** is put in the last element
    const char   FluLabel[NVar_NoPassive][MAX_STRING] = { "Mass_Gas", "MomX_Gas", "MomY_Gas", "MomZ_Gas",
                                                          "AngMomX_Gas", "AngMomY_Gas", "AngMomZ_Gas",
@@ -65,7 +122,7 @@ void Aux_Check_Conservation( const char *comment )
                                                          "Etot_Gas"
                                                        };
 #  else
-   const int    NVar_NoPassive    = 11;   // 11: mass, momentum (x/y/z), angular momentum (x/y/z), kinetic/internal/potential/total energies
+   const int    NVar_NoPassive    = NVar_Gas;   // 11: mass, momentum (x/y/z), angular momentum (x/y/z), kinetic/internal/potential/total energies
                                           // --> note that **total energy** is put in the last element
    const char   FluLabel[NVar_NoPassive][MAX_STRING] = { "Mass_Gas", "MomX_Gas", "MomY_Gas", "MomZ_Gas",
                                                          "AngMomX_Gas", "AngMomY_Gas", "AngMomZ_Gas",
@@ -74,7 +131,6 @@ void Aux_Check_Conservation( const char *comment )
 #  endif
    const char   FluCoMLabel[3][MAX_STRING] = { "CoMX_Gas", "CoMY_Gas", "CoMZ_Gas" };
    const int    idx_etot_flu      = NVar_NoPassive - 1;
-   const bool   CheckMinEint_No   = false;
 
 #  elif ( MODEL == ELBDM )
    const int    NVar_NoPassive    = 11;   // 11: mass, momentum (x/y/z), angular momentum (x/y/z), kinetic/gravitational/self-interaction/total energies
@@ -109,16 +165,49 @@ void Aux_Check_Conservation( const char *comment )
    int NStoredConRef_noTime = 0;
    NStoredConRef_noTime += NVar_Flu + 3; // +3: center-of-mass position
 
-   double dh, dv, Fluid_ThisRank[NVar_Flu], Fluid_AllRank[NVar_Flu], Fluid_lv[NVar_Flu];   // dv : cell volume at each level
+   double Fluid_AllRank[NVar_Flu], CoM_Flu[3];
+   FILE  *File = NULL;
+
+
+// evaluate the grid-based reductions in a single pass unless they have been evaluated at the current step
+// --> see Aux_Diagnostics()
+   if ( ! Diag_CoM_Flu.IsCurrent( Step, Time[0] ) )
+   {
+      Aux_Check_Conservation_AddDiag();
+      Aux_Diag_Execute();
+   }
+
+
+#  if   ( MODEL == HYDRO )
+// get the gas quantities
+   for (int v=0; v<NVar_NoPassive+NCOMP_PASSIVE; v++)    Fluid_AllRank[v] = Diag_Gas.Data[v];
+
+// get the total energy
+#  ifdef MHD
+   Fluid_AllRank[idx_etot_flu] = Fluid_AllRank[7] + Fluid_AllRank[8] + Fluid_AllRank[9] + Fluid_AllRank[10];
+#  else
+   Fluid_AllRank[idx_etot_flu] = Fluid_AllRank[7] + Fluid_AllRank[8] + Fluid_AllRank[9];
+#  endif
+
+// sum of passive scalars to be normalized
+   if ( GetPassiveSum )
+   {
+      Fluid_AllRank[ NVar_Flu - 1 ] = 0.0;
+
+#     if ( NCOMP_PASSIVE > 0 )
+      for (int v=0; v<PassiveNorm_NVar; v++)
+         Fluid_AllRank[ NVar_Flu - 1 ] += Fluid_AllRank[ NVar_NoPassive + PassiveNorm_VarIdx[v] ];
+#     endif
+   }
+
+
+#  elif ( MODEL == ELBDM )
+// ELBDM requires ghost zones for computing the gradient of wave function and thus is not evaluated by the diagnostics engine
+   double dh, dv, Fluid_ThisRank[NVar_Flu], Fluid_lv[NVar_Flu];   // dv : cell volume at each level
    int    FluSg;
 #  ifdef GRAVITY
    int    PotSg;
 #  endif
-#  ifdef MHD
-   int    MagSg;
-#  endif
-   FILE  *File = NULL;
-
 
 // initialize accumulative variables as zero
    for (int v=0; v<NVar_Flu; v++)    Fluid_ThisRank[v] = 0.0;
@@ -135,17 +224,11 @@ void Aux_Check_Conservation( const char *comment )
 #     ifdef GRAVITY
       PotSg = amr->PotSg[lv];
 #     endif
-#     ifdef MHD
-      MagSg = amr->MagSg[lv];
-#     endif
-#     if ( MODEL == ELBDM )
       const real _dh2  = 0.5/amr->dh[lv];
-#     endif
 
 
       for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
       {
-#        if ( MODEL == ELBDM )
          const real MinDens_No = -1.0;
          const real MinPres_No = -1.0;
          const real MinTemp_No = -1.0;
@@ -165,7 +248,6 @@ void Aux_Check_Conservation( const char *comment )
          Prepare_PatchData( lv, Time[lv], Flu_ELBDM[0][0][0][0], NULL, NGhost, NPG, &PID0, TVar, _NONE,
                             IntScheme, INT_NONE, UNIT_PATCH, NSIDE_06, IntPhase_No, OPT__BC_FLU, BC_POT_NONE,
                             MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
-#        endif // #if ( MODEL == ELBDM )
 
          for (int PID=PID0; PID<PID0+8; PID++)
          {
@@ -175,108 +257,6 @@ void Aux_Check_Conservation( const char *comment )
             const double y0  = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh;
             const double z0  = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh;
 
-#           if   ( MODEL == HYDRO )
-            for (int k=0; k<PATCH_SIZE; k++)
-            for (int j=0; j<PATCH_SIZE; j++)
-            for (int i=0; i<PATCH_SIZE; i++)
-            {
-               double Dens, MomX, MomY, MomZ, AngMomX, AngMomY, AngMomZ, Etot, Ekin, Eint;
-#              ifdef GRAVITY
-               double Epot;
-#              endif
-               double Emag = NULL_REAL;
-
-               Dens = amr->patch[FluSg][lv][PID]->fluid[DENS][k][j][i];
-               MomX = amr->patch[FluSg][lv][PID]->fluid[MOMX][k][j][i];
-               MomY = amr->patch[FluSg][lv][PID]->fluid[MOMY][k][j][i];
-               MomZ = amr->patch[FluSg][lv][PID]->fluid[MOMZ][k][j][i];
-               Etot = amr->patch[FluSg][lv][PID]->fluid[ENGY][k][j][i];
-
-//             calculate the angular momentum
-               const double x  = x0 + i*dh;
-               const double y  = y0 + j*dh;
-               const double z  = z0 + k*dh;
-
-               const double dX = x - ANGMOM_ORIGIN_X;
-               const double dY = y - ANGMOM_ORIGIN_Y;
-               const double dZ = z - ANGMOM_ORIGIN_Z;
-
-               AngMomX = dY*MomZ - dZ*MomY;
-               AngMomY = dZ*MomX - dX*MomZ;
-               AngMomZ = dX*MomY - dY*MomX;
-
-#              ifdef SRHD
-//             total energy density also includes rest mass energy density in relativistic hydro
-               Etot += Dens;
-#              endif
-
-               Fluid_lv[0] += Dens;
-               Fluid_lv[1] += MomX;
-               Fluid_lv[2] += MomY;
-               Fluid_lv[3] += MomZ;
-
-               Fluid_lv[4] += AngMomX;
-               Fluid_lv[5] += AngMomY;
-               Fluid_lv[6] += AngMomZ;
-
-#              ifdef MHD
-               Emag          = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg );
-               Fluid_lv[10] += Emag;
-#              endif
-
-#              ifdef GRAVITY
-//             set potential energy to zero when enabling both OPT__SELF_GRAVITY and OPT__EXT_POT
-//             since the potential energy obtained here would be wrong anyway
-//             --> to avoid possible misinterpretation
-               if      (  OPT__SELF_GRAVITY  &&  !OPT__EXT_POT )  Epot = 0.5*Dens*amr->patch[PotSg][lv][PID]->pot[k][j][i];
-               else if ( !OPT__SELF_GRAVITY  &&   OPT__EXT_POT )  Epot =     Dens*amr->patch[PotSg][lv][PID]->pot[k][j][i];
-               else                                               Epot = 0.0;
-               Fluid_lv[9] += Epot;
-#              endif
-#              ifndef SRHD
-//             Hydro_Con2Eint() calculates Eint for both HD and SRHD but we disable SRHD for now
-               Eint         = Hydro_Con2Eint( Dens, MomX, MomY, MomZ, Etot, CheckMinEint_No, NULL_REAL, PassiveFloorMask, Emag,
-                                              EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr, EoS_AuxArray_Flt,
-                                              EoS_AuxArray_Int, h_EoS_Table );
-#              else
-               Eint = 0.0;
-#              endif
-               Fluid_lv[8] += Eint;
-
-#              ifdef SRHD
-//             For now we disable the calculation of Ekin for SRHD
-//             Also, note that the following is equivalent to "Etot - Dens - Lrtz*Eint"
-               /*
-               real HTilde, Prim[NCOMP_TOTAL], Cons[NCOMP_TOTAL], Lrtz, Lrtz_m1;
-               Cons[0]      = Dens;
-               Cons[1]      = MomX;
-               Cons[2]      = MomY;
-               Cons[3]      = MomZ;
-               Cons[4]      = Etot;
-               for ( int v = NCOMP_FLUID; v < NCOMP_TOTAL; v++ ) Cons[v] = 0.0;
-               Hydro_Con2Pri( Cons, Prim, (real)-HUGE_NUMBER, PassiveFloorMask, NULL_BOOL, NULL_INT, NULL,
-                              NULL_BOOL, NULL_REAL, EoS_DensEint2Pres_CPUPtr, EoS_DensPres2Eint_CPUPtr,
-                              EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL, &Lrtz );
-               HTilde       = Hydro_Con2HTilde( Cons, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
-                                                EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
-
-//             Compute gamma - 1 this way to avoid catastrophic cancellation
-               Lrtz_m1      = ( SQR(Prim[1]) + SQR(Prim[2]) + SQR(Prim[3]) ) / ( Lrtz + 1.0 );
-               Ekin         = Lrtz_m1*( Dens*(HTilde+1.0) + Prim[4] );
-               */
-               Ekin = 0.0;
-#              else
-//###NOTE: assuming Etot = Eint + Ekin + Emag
-               Ekin         = Etot - Eint;
-#              ifdef MHD
-               Ekin        -= Emag;
-#              endif
-#              endif
-               Fluid_lv[7] += Ekin;
-            } // i,j,k
-
-
-#           elif ( MODEL == ELBDM )
             for (int k=0; k<PATCH_SIZE; k++)
             for (int j=0; j<PATCH_SIZE; j++)
             for (int i=0; i<PATCH_SIZE; i++)
@@ -395,11 +375,6 @@ void Aux_Check_Conservation( const char *comment )
 
             }}} // i,j,k
 
-#           else
-#           error : ERROR : unsupported MODEL !!
-
-#           endif // MODEL
-
 
 //          individual passive scalars
             for (int v=0; v<NCOMP_PASSIVE; v++)
@@ -416,17 +391,7 @@ void Aux_Check_Conservation( const char *comment )
       } // for (int PID0=0; PID0<amr->NPatchComma[lv][1]; PID0+=8)
 
 //    get the total energy
-#     if   ( MODEL == HYDRO )
-#     ifdef MHD
-      Fluid_lv[idx_etot_flu] = Fluid_lv[7] + Fluid_lv[8] + Fluid_lv[9] + Fluid_lv[10];
-#     else
       Fluid_lv[idx_etot_flu] = Fluid_lv[7] + Fluid_lv[8] + Fluid_lv[9];
-#     endif
-#     elif ( MODEL == ELBDM )
-      Fluid_lv[idx_etot_flu] = Fluid_lv[7] + Fluid_lv[8] + Fluid_lv[9];
-#     else
-#     error : ERROR : unsupported MODEL !!
-#     endif
 
 //    sum of passive scalars to be normalized
 #     if ( NCOMP_PASSIVE > 0 )
@@ -442,12 +407,13 @@ void Aux_Check_Conservation( const char *comment )
 // sum over all ranks
    MPI_Reduce( Fluid_ThisRank, Fluid_AllRank, NVar_Flu, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
 
+#  else
+#  error : ERROR : unsupported MODEL !!
+#  endif // MODEL
 
-// compute the center of mass
-   double CoM_Flu[3];
-   double FinaldR_Flu;
-   int    FinalNIter_Flu;
-   Aux_FindWeightedAverageCenter( CoM_Flu, amr->BoxCenter, __FLT_MAX__, 0.0, _DENS, __FLT_MAX__, 1, &FinaldR_Flu, &FinalNIter_Flu );
+
+// get the center of mass
+   Aux_Diag_GetWeightedCenter( &Diag_CoM_Flu, CoM_Flu );
 
 
 // calculate conserved quantities for particles
@@ -797,3 +763,158 @@ void Aux_Check_Conservation( const char *comment )
 #  endif
 
 } // FUNCTION : Aux_Check_Conservation
+
+
+#if ( MODEL == HYDRO )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_Gas_Patch
+// Description :  Per-patch callback of the diagnostics engine for accumulating the gas quantities
+//
+// Note        :  1. Data layout is the same as Fluid_AllRank[] in Aux_Check_Conservation() except that
+//                   the total energy and the sum of passive scalars to be normalized are computed afterward
+//
+// Parameter   :  Out   : Thread-private reduction buffer
+//                Patch : Target patch
+//                Diag  : This consumer
+//-------------------------------------------------------------------------------------------------------
+void Diag_Gas_Patch( double Out[], const DiagPatch_t &Patch, const DiagConsumer_t &Diag )
+{
+
+   const bool   CheckMinEint_No = false;
+   const int    lv              = Patch.lv;
+   const int    PID             = Patch.PID;
+   const double dh              = Patch.dh;
+   const int    FluSg           = Patch.FluSg;
+#  ifdef GRAVITY
+   const int    PotSg           = Patch.PotSg;
+#  endif
+#  ifdef MHD
+   const int    MagSg           = Patch.MagSg;
+#  endif
+   const double x0              = amr->patch[0][lv][PID]->EdgeL[0] + 0.5*dh;
+   const double y0              = amr->patch[0][lv][PID]->EdgeL[1] + 0.5*dh;
+   const double z0              = amr->patch[0][lv][PID]->EdgeL[2] + 0.5*dh;
+
+   double Fluid_PID[NVar_Gas+NCOMP_PASSIVE];
+
+   for (int v=0; v<NVar_Gas+NCOMP_PASSIVE; v++)   Fluid_PID[v] = 0.0;
+
+
+   for (int k=0; k<PS1; k++)
+   for (int j=0; j<PS1; j++)
+   for (int i=0; i<PS1; i++)
+   {
+      double Dens, MomX, MomY, MomZ, AngMomX, AngMomY, AngMomZ, Etot, Ekin, Eint;
+#     ifdef GRAVITY
+      double Epot;
+#     endif
+      double Emag = NULL_REAL;
+
+      Dens = amr->patch[FluSg][lv][PID]->fluid[DENS][k][j][i];
+      MomX = amr->patch[FluSg][lv][PID]->fluid[MOMX][k][j][i];
+      MomY = amr->patch[FluSg][lv][PID]->fluid[MOMY][k][j][i];
+      MomZ = amr->patch[FluSg][lv][PID]->fluid[MOMZ][k][j][i];
+      Etot = amr->patch[FluSg][lv][PID]->fluid[ENGY][k][j][i];
+
+//    calculate the angular momentum
+      const double x  = x0 + i*dh;
+      const double y  = y0 + j*dh;
+      const double z  = z0 + k*dh;
+
+      const double dX = x - ANGMOM_ORIGIN_X;
+      const double dY = y - ANGMOM_ORIGIN_Y;
+      const double dZ = z - ANGMOM_ORIGIN_Z;
+
+      AngMomX = dY*MomZ - dZ*MomY;
+      AngMomY = dZ*MomX - dX*MomZ;
+      AngMomZ = dX*MomY - dY*MomX;
+
+#     ifdef SRHD
+//    total energy density also includes rest mass energy density in relativistic hydro
+      Etot += Dens;
+#     endif
+
+      Fluid_PID[0] += Dens;
+      Fluid_PID[1] += MomX;
+      Fluid_PID[2] += MomY;
+      Fluid_PID[3] += MomZ;
+
+      Fluid_PID[4] += AngMomX;
+      Fluid_PID[5] += AngMomY;
+      Fluid_PID[6] += AngMomZ;
+
+#     ifdef MHD
+      Emag           = MHD_GetCellCenteredBEnergyInPatch( lv, PID, i, j, k, MagSg );
+      Fluid_PID[10] += Emag;
+#     endif
+
+#     ifdef GRAVITY
+//    set potential energy to zero when enabling both OPT__SELF_GRAVITY and OPT__EXT_POT
+//    since the potential energy obtained here would be wrong anyway
+//    --> to avoid possible misinterpretation
+      if      (  OPT__SELF_GRAVITY  &&  !OPT__EXT_POT )  Epot = 0.5*Dens*amr->patch[PotSg][lv][PID]->pot[k][j][i];
+      else if ( !OPT__SELF_GRAVITY  &&   OPT__EXT_POT )  Epot =     Dens*amr->patch[PotSg][lv][PID]->pot[k][j][i];
+      else                                               Epot = 0.0;
+      Fluid_PID[9] += Epot;
+#     endif
+#     ifndef SRHD
+//    Hydro_Con2Eint() calculates Eint for both HD and SRHD but we disable SRHD for now
+      Eint          = Hydro_Con2Eint( Dens, MomX, MomY, MomZ, Etot, CheckMinEint_No, NULL_REAL, PassiveFloorMask, Emag,
+                                      EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr, EoS_AuxArray_Flt,
+                                      EoS_AuxArray_Int, h_EoS_Table );
+#     else
+      Eint = 0.0;
+#     endif
+      Fluid_PID[8] += Eint;
+
+#     ifdef SRHD
+//    For now we disable the calculation of Ekin for SRHD
+//    Also, note that the following is equivalent to "Etot - Dens - Lrtz*Eint"
+      /*
+      real HTilde, Prim[NCOMP_TOTAL], Cons[NCOMP_TOTAL], Lrtz, Lrtz_m1;
+      Cons[0]      = Dens;
+      Cons[1]      = MomX;
+      Cons[2]      = MomY;
+      Cons[3]      = MomZ;
+      Cons[4]      = Etot;
+      for ( int v = NCOMP_FLUID; v < NCOMP_TOTAL; v++ ) Cons[v] = 0.0;
+      Hydro_Con2Pri( Cons, Prim, (real)-HUGE_NUMBER, PassiveFloorMask, NULL_BOOL, NULL_INT, NULL,
+                     NULL_BOOL, NULL_REAL, EoS_DensEint2Pres_CPUPtr, EoS_DensPres2Eint_CPUPtr,
+                     EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr, EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table, NULL, &Lrtz );
+      HTilde       = Hydro_Con2HTilde( Cons, EoS_GuessHTilde_CPUPtr, EoS_HTilde2Temp_CPUPtr,
+                                       EoS_AuxArray_Flt, EoS_AuxArray_Int, h_EoS_Table );
+
+//    Compute gamma - 1 this way to avoid catastrophic cancellation
+      Lrtz_m1      = ( SQR(Prim[1]) + SQR(Prim[2]) + SQR(Prim[3]) ) / ( Lrtz + 1.0 );
+      Ekin         = Lrtz_m1*( Dens*(HTilde+1.0) + Prim[4] );
+      */
+      Ekin = 0.0;
+#     else
+//###NOTE: assuming Etot = Eint + Ekin + Emag
+      Ekin          = Etot - Eint;
+#     ifdef MHD
+      Ekin         -= Emag;
+#     endif
+#     endif
+      Fluid_PID[7] += Ekin;
+   } // i,j,k
+
+
+// individual passive scalars
+   for (int v=0; v<NCOMP_PASSIVE; v++)
+   {
+      const int v1 = NVar_Gas    + v;
+      const int v2 = NCOMP_FLUID + v;
+
+      for (int k=0; k<PS1; k++)
+      for (int j=0; j<PS1; j++)
+      for (int i=0; i<PS1; i++)
+         Fluid_PID[v1] += amr->patch[FluSg][lv][PID]->fluid[v2][k][j][i];
+   }
+
+
+// multiply by the cell volume
+   for (int v=0; v<NVar_Gas+NCOMP_PASSIVE; v++)   Out[v] += Fluid_PID[v]*Patch.dv;
+
+} // FUNCTION : Diag_Gas_Patch
+#endif // #if ( MODEL == HYDRO )
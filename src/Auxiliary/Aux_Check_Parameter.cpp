@@ -128,6 +128,11 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "\"%s\" only works with CUBIC domain !!\n",
                  "OPT__OUTPUT_PART == 7 (OUTPUT_DIAG)" );
 
+   if (  ( OPT__OUTPUT_PART == OUTPUT_PROJ_XY || OPT__OUTPUT_PART == OUTPUT_PROJ_YZ || OPT__OUTPUT_PART == OUTPUT_PROJ_XZ )  &&
+         OPT__OUTPUT_PART_FORMAT != OUTPUT_PART_CBINARY  )
+      Aux_Error( ERROR_INFO, "OPT__OUTPUT_PART = %d (projection) only supports OPT__OUTPUT_PART_FORMAT = %d (C-binary) !!\n",
+                 OPT__OUTPUT_PART, OUTPUT_PART_CBINARY );
+
    if (  OPT__OUTPUT_BASEPS  &&  ( NX0_TOT[0] != NX0_TOT[1] || NX0_TOT[0] != NX0_TOT[2] )  )
       Aux_Error( ERROR_INFO, "\"%s\" only works with CUBIC domain !!\n", "OPT__OUTPUT_BASEPS" );
 
@@ -240,9 +245,35 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "INT_MONO_COEFF_B (%14.7e) is not within the correct range [1.0, 4.0] !!\n", INT_MONO_COEFF_B );
 #  endif
 
-   if ( OPT__MEMORY_POOL  &&  !OPT__REUSE_MEMORY )
+   if ( OPT__MEMORY_POOL != MEMORY_POOL_NONE  &&  OPT__MEMORY_POOL != MEMORY_POOL_TABLE  &&  OPT__MEMORY_POOL != MEMORY_POOL_AUTO )
+      Aux_Error( ERROR_INFO, "incorrect option \"OPT__MEMORY_POOL = %d\" [0/1/2] !!\n", OPT__MEMORY_POOL );
+
+   if ( OPT__MEMORY_POOL != MEMORY_POOL_NONE  &&  !OPT__REUSE_MEMORY )
       Aux_Error( ERROR_INFO, "please turn on OPT__REUSE_MEMORY for OPT__MEMORY_POOL !!\n" );
 
+   if ( OPT__SINGLE_SANDGLASS )
+   {
+#     if ( MODEL != HYDRO )
+      Aux_Error( ERROR_INFO, "OPT__SINGLE_SANDGLASS only supports MODEL == HYDRO !!\n" );
+#     endif
+
+      if ( FLU_GHOST_SIZE > PS1 )
+         Aux_Error( ERROR_INFO, "OPT__SINGLE_SANDGLASS does not support FLU_GHOST_SIZE (%d) > PATCH_SIZE (%d) !!\n",
+                    FLU_GHOST_SIZE, PS1 );
+
+      if ( MPI_Rank == 0 ) {
+      if ( AUTO_REDUCE_DT )
+         Aux_Message( stderr, "WARNING : OPT__SINGLE_SANDGLASS has no effect when AUTO_REDUCE_DT is on !!\n" );
+
+#     if ( defined GRAVITY  &&  defined UNSPLIT_GRAVITY )
+         Aux_Message( stderr, "WARNING : OPT__SINGLE_SANDGLASS has no effect when GRAVITY and UNSPLIT_GRAVITY are on !!\n" );
+#     endif
+      } // if ( MPI_Rank == 0 )
+   } // if ( OPT__SINGLE_SANDGLASS )
+
+   if ( OPT__PATCH_SLAB  &&  !OPT__REUSE_MEMORY )
+      Aux_Error( ERROR_INFO, "please turn on OPT__REUSE_MEMORY for OPT__PATCH_SLAB !!\n" );
+
 #  ifdef __APPLE__
    if ( OPT__RECORD_MEMORY )
       Aux_Message( stderr, "WARNING : memory reporting is not currently supported on macOS !!\n" );
@@ -938,6 +969,27 @@ void Aux_Check_Parameter()
       Aux_Error( ERROR_INFO, "RTVD does not support \"JEANS_MIN_PRES\" !!\n" );
 #  endif
 
+   if ( AUTO_REDUCE_DT_LOCAL )
+   {
+      if ( ! AUTO_REDUCE_DT )
+         Aux_Error( ERROR_INFO, "\"%s\" must work with \"%s\" !!\n", "AUTO_REDUCE_DT_LOCAL", "AUTO_REDUCE_DT" );
+
+      if ( AUTO_REDUCE_DT_FACTOR >= 1.0 )
+         Aux_Error( ERROR_INFO, "\"%s\" requires \"%s < 1.0\" !!\n", "AUTO_REDUCE_DT_LOCAL", "AUTO_REDUCE_DT_FACTOR" );
+
+#     ifdef GPU
+      Aux_Error( ERROR_INFO, "\"%s\" does not support GPU yet !!\n", "AUTO_REDUCE_DT_LOCAL" );
+#     endif
+
+#     if ( defined MHD  ||  defined SRHD )
+      Aux_Error( ERROR_INFO, "\"%s\" does not support MHD and SRHD yet !!\n", "AUTO_REDUCE_DT_LOCAL" );
+#     endif
+
+#     if ( FLU_SCHEME == RTVD )
+      Aux_Error( ERROR_INFO, "RTVD does not support \"AUTO_REDUCE_DT_LOCAL\" !!\n" );
+#     endif
+   }
+
    if ( MU_NORM <= 0.0 )
       Aux_Error( ERROR_INFO, "MU_NORM (%14.7e) <= 0.0 !!\n", MU_NORM );
 
@@ -1963,6 +2015,9 @@ void Aux_Check_Parameter()
 #     error : ERROR : must enable MHD for CR_DIFFUSION !!
 #  endif
 
+   if ( CR_DIFF_RKL2  &&  DT__CR_DIFFUSION <= 0.0 )
+      Aux_Error( ERROR_INFO, "DT__CR_DIFFUSION (%14.7e) <= 0.0 for CR_DIFF_RKL2 !!\n", DT__CR_DIFFUSION );
+
 // warning
 // ------------------------------
    if ( MPI_Rank == 0 ) {
@@ -0,0 +1,783 @@
+#include "GAMER.h"
+
+
+// maximum number of consumers evaluated in a single pass
+static const int DIAG_NCONSUMER_MAX = 32;
+
+// consumers to be evaluated by the next call to Aux_Diag_Execute()
+// --> Diag_Offset[c] is the offset of the c-th consumer in the packed reduction buffer
+//     and Diag_Offset[Diag_NConsumer] is the total number of reduced values
+static int             Diag_NConsumer = 0;
+static DiagConsumer_t *Diag_Consumer[DIAG_NCONSUMER_MAX];
+static int             Diag_Offset  [DIAG_NCONSUMER_MAX+1] = { 0 };
+
+static void Diag_InitBuffer( double *Buf );
+static void Diag_Combine( const double *In, double *InOut );
+#ifndef SERIAL
+static void Diag_MPI_Combine( void *In, void *InOut, int *Len, MPI_Datatype *Type );
+#endif
+static const real (*Diag_GetPatchField( const long Field, const DiagPatch_t &Patch ))[PS1][PS1];
+static void Diag_Extrema( double Out[], const DiagPatch_t &Patch, const DiagConsumer_t &Diag );
+static void Diag_WeightedCenter( double Out[], const DiagPatch_t &Patch, const DiagConsumer_t &Diag );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Diagnostics
+// Description :  Evaluate the grid-based reductions of all enabled in-situ diagnostics in a single pass
+//
+// Note        :  1. Invoked by main() right before Aux_Record_Center() and Aux_Check()
+//                2. Register the consumers of Aux_Record_Center() and Aux_Check_Conservation() and evaluate
+//                   them with a single traversal of all leaf patches and a single MPI_Allreduce()
+//                   --> These functions reuse the results as long as they are invoked at the same Step and Time[0]
+//                       (see DiagConsumer_t::IsCurrent())
+//                   --> They still work standalone by evaluating their own consumers when no current results are found
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Diagnostics()
+{
+
+   if ( OPT__RECORD_CENTER )                             Aux_Record_Center_AddDiag();
+
+// must be consistent with the condition for invoking Aux_Check_Conservation() in Aux_Check()
+   if ( OPT__CK_CONSERVATION  ||  !ConRefInitialized )   Aux_Check_Conservation_AddDiag();
+
+   Aux_Diag_Execute();
+
+} // FUNCTION : Aux_Diagnostics
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Diag_Add
+// Description :  Add a consumer to be evaluated by the next call to Aux_Diag_Execute()
+//
+// Note        :  1. Must set "Name, Field, Op, NData, PatchFunc" (and optionally "Arg") in the input consumer in advance
+//                   --> "DiagConsumer_t" structure is defined in "include/Diagnostics.h"
+//                   --> Aux_Diag_SetExtrema() and Aux_Diag_SetWeightedCenter() set up the built-in consumers
+//                2. All ranks must add the same consumers in the same order since their results are packed
+//                   into a single MPI reduction buffer
+//                3. The consumer object must remain valid until Aux_Diag_Execute() returns
+//
+// Parameter   :  Diag : Target consumer
+//
+// Return      :  Diag->Data (allocated)
+//-------------------------------------------------------------------------------------------------------
+void Aux_Diag_Add( DiagConsumer_t *Diag )
+{
+
+// check
+   if ( Diag == NULL )
+      Aux_Error( ERROR_INFO, "Diag == NULL !!\n" );
+
+   if ( Diag->PatchFunc == NULL )
+      Aux_Error( ERROR_INFO, "PatchFunc == NULL for the consumer \"%s\" !!\n", Diag->Name );
+
+   if ( Diag->NData <= 0 )
+      Aux_Error( ERROR_INFO, "NData (%d) <= 0 for the consumer \"%s\" !!\n", Diag->NData, Diag->Name );
+
+   if (  ( Diag->Op == DIAG_OP_MINLOC || Diag->Op == DIAG_OP_MAXLOC )  &&  Diag->NData < 2  )
+      Aux_Error( ERROR_INFO, "NData (%d) < 2 for the MINLOC/MAXLOC consumer \"%s\" !!\n", Diag->NData, Diag->Name );
+
+   if ( Diag->Op != DIAG_OP_SUM  &&  Diag->Op != DIAG_OP_MIN  &&  Diag->Op != DIAG_OP_MAX  &&
+        Diag->Op != DIAG_OP_MINLOC  &&  Diag->Op != DIAG_OP_MAXLOC )
+      Aux_Error( ERROR_INFO, "incorrect Op (%d) for the consumer \"%s\" !!\n", Diag->Op, Diag->Name );
+
+   if ( Diag_NConsumer >= DIAG_NCONSUMER_MAX )
+      Aux_Error( ERROR_INFO, "number of diagnostic consumers exceeds DIAG_NCONSUMER_MAX (%d) !!\n", DIAG_NCONSUMER_MAX );
+
+   for (int c=0; c<Diag_NConsumer; c++)
+      if ( Diag_Consumer[c] == Diag )
+         Aux_Error( ERROR_INFO, "consumer \"%s\" has been added already !!\n", Diag->Name );
+
+
+// (re)allocate the output array
+   delete [] Diag->Data;
+   Diag->Data = new double [Diag->NData];
+   Diag->Step = -1;
+   Diag->Time = -__DBL_MAX__;
+
+   Diag_Consumer[Diag_NConsumer]   = Diag;
+   Diag_Offset  [Diag_NConsumer+1] = Diag_Offset[Diag_NConsumer] + Diag->NData;
+   Diag_NConsumer ++;
+
+} // FUNCTION : Aux_Diag_Add
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Diag_Execute
+// Description :  Evaluate all consumers added by Aux_Diag_Add() in a single pass
+//
+// Note        :  1. Loop over all leaf patches on all levels only once and invoke the per-patch callbacks
+//                   of all consumers for each patch
+//                2. _PAR_DENS and _TOTAL_DENS are prepared at most once per patch group for all consumers
+//                   --> _TOTAL_DENS is computed as fluid density + _PAR_DENS, which may differ from
+//                       Prepare_PatchData( _TOTAL_DENS ) by round-off errors
+//                3. Each OpenMP thread accumulates into a private buffer with the "static" schedule, and the
+//                   thread buffers are combined in the order of thread IDs for reproducibility
+//                4. Results of all consumers are combined among all ranks with a single MPI_Allreduce()
+//                   --> All ranks will share the same results in DiagConsumer_t::Data[]
+//                   --> Ties of DIAG_OP_MINLOC/MAXLOC are broken by the smaller MPI rank stored in Data[1]
+//                5. Only check the most recent data on each level (i.e., data associated with FluSg[lv]/PotSg[lv]/MagSg[lv])
+//                6. The list of consumers is cleared after evaluation
+//
+// Parameter   :  None
+//
+// Return      :  DiagConsumer_t::Data/Step/Time of all added consumers
+//-------------------------------------------------------------------------------------------------------
+void Aux_Diag_Execute()
+{
+
+   if ( Diag_NConsumer == 0 )    return;
+
+
+   const int NData = Diag_Offset[Diag_NConsumer];
+#  ifdef OPENMP
+   const int NT    = OMP_NTHREAD;
+#  else
+   const int NT    = 1;
+#  endif
+
+// fields to be prepared
+   long PrepField = _NONE;
+   for (int c=0; c<Diag_NConsumer; c++)   PrepField |= Diag_Consumer[c]->Field;
+
+#  ifdef PARTICLE
+   const bool PrepParDens = ( PrepField & _PAR_DENS  ||  PrepField & _TOTAL_DENS );
+   const bool PrepTotDens = ( PrepField & _TOTAL_DENS );
+#  else
+   const bool PrepParDens = false;
+   const bool PrepTotDens = false;
+#  endif
+
+   const int  NPG_Max           = FLU_GPU_NPGROUP;
+#  ifdef MASSIVE_PARTICLES
+   const bool IntPhase_No       = false;
+   const real MinDens_No        = -1.0;
+   const real MinPres_No        = -1.0;
+   const real MinTemp_No        = -1.0;
+   const real MinEntr_No        = -1.0;
+   const bool DE_Consistency_No = false;
+   const bool TimingSendPar_No  = false;
+   const bool JustCountNPar_No  = false;
+#  ifdef LOAD_BALANCE
+   const bool PredictPos        = amr->Par->PredictPos;
+   const bool SibBufPatch       = true;
+   const bool FaSibBufPatch     = true;
+#  else
+   const bool PredictPos        = false;
+   const bool SibBufPatch       = NULL_BOOL;
+   const bool FaSibBufPatch     = NULL_BOOL;
+#  endif
+#  endif // #ifdef MASSIVE_PARTICLES
+
+
+// allocate memory
+   double *OMP_Data = new double [ (long)NT*NData ];
+   real (*ParDens)[PS1][PS1][PS1] = ( PrepParDens ) ? new real [8*NPG_Max][PS1][PS1][PS1] : NULL;
+   real (*TotDens)[PS1][PS1][PS1] = ( PrepTotDens ) ? new real [8*NPG_Max][PS1][PS1][PS1] : NULL;
+
+   for (int TID=0; TID<NT; TID++)   Diag_InitBuffer( OMP_Data + (long)TID*NData );
+
+
+// loop over all levels
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int NTotal = amr->NPatchComma[lv][1] / 8;
+      int *PID0_List   = new int [NTotal];
+      for (int t=0; t<NTotal; t++)  PID0_List[t] = 8*t;
+
+//    initialize the particle density array (rho_ext) and collect particles to the target level
+#     ifdef MASSIVE_PARTICLES
+      if ( PrepParDens )
+      {
+         Par_CollectParticle2OneLevel( lv, _PAR_MASS|_PAR_POSX|_PAR_POSY|_PAR_POSZ, _PAR_TYPE, PredictPos,
+                                       amr->FluSgTime[lv][ amr->FluSg[lv] ],
+                                       SibBufPatch, FaSibBufPatch, JustCountNPar_No, TimingSendPar_No );
+
+         Prepare_PatchData_InitParticleDensityArray( lv, amr->FluSgTime[lv][ amr->FluSg[lv] ] );
+      }
+#     endif
+
+      for (int Disp=0; Disp<NTotal; Disp+=NPG_Max)
+      {
+         const int NPG = ( NPG_Max < NTotal-Disp ) ? NPG_Max : NTotal-Disp;
+
+//       prepare the particle density shared by all consumers
+         if ( PrepParDens )
+         {
+#           ifdef MASSIVE_PARTICLES
+            Prepare_PatchData( lv, amr->FluSgTime[lv][ amr->FluSg[lv] ], ParDens[0][0][0], NULL, 0, NPG, PID0_List+Disp, _PAR_DENS, _NONE,
+                               INT_NONE, INT_NONE, UNIT_PATCH, NSIDE_00, IntPhase_No, OPT__BC_FLU, BC_POT_NONE,
+                               MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
+#           else
+//          tracer particles do not contribute to the density
+            for (int t=0; t<8*NPG; t++)
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+               ParDens[t][k][j][i] = (real)0.0;
+#           endif
+         }
+
+#        pragma omp parallel
+         {
+#           ifdef OPENMP
+            const int TID = omp_get_thread_num();
+#           else
+            const int TID = 0;
+#           endif
+
+            double *Out = OMP_Data + (long)TID*NData;
+
+            DiagPatch_t Patch;
+            Patch.lv    = lv;
+            Patch.dh    = amr->dh[lv];
+            Patch.dv    = CUBE( amr->dh[lv] );
+            Patch.FluSg = amr->FluSg[lv];
+#           ifdef MHD
+            Patch.MagSg = amr->MagSg[lv];
+#           else
+            Patch.MagSg = -1;
+#           endif
+#           ifdef GRAVITY
+            Patch.PotSg = amr->PotSg[lv];
+#           else
+            Patch.PotSg = -1;
+#           endif
+
+//          use the "static" schedule for reproducibility
+#           pragma omp for schedule( static )
+            for (int t=0; t<8*NPG; t++)
+            {
+               const int PID = 8*Disp + t;
+
+//             skip non-leaf patches
+               if ( amr->patch[0][lv][PID]->son != -1 )  continue;
+
+               Patch.PID     = PID;
+               Patch.ParDens = ( PrepParDens ) ? ParDens[t] : NULL;
+               Patch.TotDens = ( PrepTotDens ) ? TotDens[t] : NULL;
+
+#              ifdef PARTICLE
+               if ( PrepTotDens )
+               {
+                  const real (*Dens)[PS1][PS1] = amr->patch[ Patch.FluSg ][lv][PID]->fluid[DENS];
+
+                  for (int k=0; k<PS1; k++)
+                  for (int j=0; j<PS1; j++)
+                  for (int i=0; i<PS1; i++)
+                     TotDens[t][k][j][i] = Dens[k][j][i] + ParDens[t][k][j][i];
+               }
+#              endif
+
+               for (int c=0; c<Diag_NConsumer; c++)
+                  Diag_Consumer[c]->PatchFunc( Out+Diag_Offset[c], Patch, *Diag_Consumer[c] );
+            } // for (int t=0; t<8*NPG; t++)
+         } // OpenMP parallel region
+      } // for (int Disp=0; Disp<NTotal; Disp+=NPG_Max)
+
+//    free memory for collecting particles from other ranks and levels, and free density arrays with ghost zones (rho_ext)
+#     ifdef MASSIVE_PARTICLES
+      if ( PrepParDens )
+      {
+         Par_CollectParticle2OneLevel_FreeMemory( lv, SibBufPatch, FaSibBufPatch );
+
+         Prepare_PatchData_FreeParticleDensityArray( lv );
+      }
+#     endif
+
+      delete [] PID0_List;
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+
+// combine the results of all OpenMP threads in the order of thread IDs
+   for (int TID=1; TID<NT; TID++)   Diag_Combine( OMP_Data + (long)TID*NData, OMP_Data );
+
+
+// combine the results of all ranks with a single reduction
+// --> use a contiguous datatype covering the entire buffer so that MPI never splits a consumer across
+//     different invocations of the reduction function
+   double *AllRank_Data = new double [NData];
+
+#  ifdef SERIAL
+   memcpy( AllRank_Data, OMP_Data, NData*sizeof(double) );
+#  else
+   MPI_Datatype MPI_Diag_t;
+   MPI_Op       MPI_Diag_Op;
+
+   MPI_Type_contiguous( NData, MPI_DOUBLE, &MPI_Diag_t );
+   MPI_Type_commit( &MPI_Diag_t );
+   MPI_Op_create( Diag_MPI_Combine, true, &MPI_Diag_Op );
+
+   MPI_Allreduce( OMP_Data, AllRank_Data, 1, MPI_Diag_t, MPI_Diag_Op, MPI_COMM_WORLD );
+
+   MPI_Op_free( &MPI_Diag_Op );
+   MPI_Type_free( &MPI_Diag_t );
+#  endif
+
+
+// store the results
+   for (int c=0; c<Diag_NConsumer; c++)
+   {
+      DiagConsumer_t *Diag = Diag_Consumer[c];
+
+      memcpy( Diag->Data, AllRank_Data+Diag_Offset[c], Diag->NData*sizeof(double) );
+      Diag->Step = Step;
+      Diag->Time = Time[0];
+   }
+
+
+// reset the list of consumers
+   Diag_NConsumer = 0;
+
+
+// free memory
+   delete [] OMP_Data;
+   delete [] AllRank_Data;
+   delete [] ParDens;
+   delete [] TotDens;
+
+} // FUNCTION : Aux_Diag_Execute
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Diag_SetExtrema
+// Description :  Set up a consumer for finding the value and location of the extreme value of a given field
+//                within a target spherical region
+//
+// Note        :  1. Same as Aux_FindExtrema() with MinLv=0, MaxLv=TOP_LEVEL, PatchType=PATCH_LEAF, except that
+//                   it can be evaluated together with other consumers by Aux_Diag_Execute()
+//                2. Must set "Field, Radius, Center" in the input "Extrema" object in advance
+//                   --> "Extrema" must remain valid until Aux_Diag_Execute() returns
+//                3. Only support the intrinsic fluid fields, _POTE, _PAR_DENS, and _TOTAL_DENS
+//                4. Call Aux_Diag_GetExtrema() to retrieve the results after Aux_Diag_Execute()
+//
+// Parameter   :  Diag    : Consumer to be set up
+//                Extrema : Extrema_t object storing the input information of the extrema
+//                Mode    : EXTREMA_MIN/MAX --> find the minimum/maximum value
+//
+// Return      :  Diag
+//-------------------------------------------------------------------------------------------------------
+void Aux_Diag_SetExtrema( DiagConsumer_t *Diag, Extrema_t *Extrema, const ExtremaMode_t Mode )
+{
+
+// check
+   if ( Extrema->Field == _NONE  ||  Extrema->Field & (Extrema->Field-1) )
+      Aux_Error( ERROR_INFO, "incorrect Field (%ld) !!\n", Extrema->Field );
+
+   if ( Extrema->Radius <= 0.0 )
+      Aux_Error( ERROR_INFO, "Radius (%14.7e) <= 0.0 !!\n", Extrema->Radius );
+
+   if ( Mode != EXTREMA_MIN  &&  Mode != EXTREMA_MAX )
+      Aux_Error( ERROR_INFO, "incorrect Mode (%d) !!\n", Mode );
+
+
+   Diag->Name      = "Extrema";
+   Diag->Field     = Extrema->Field;
+   Diag->Op        = ( Mode == EXTREMA_MIN ) ? DIAG_OP_MINLOC : DIAG_OP_MAXLOC;
+   Diag->NData     = 10;   // 10: value, rank, coordinates (x/y/z), level, PID, cell indices (i/j/k)
+   Diag->PatchFunc = Diag_Extrema;
+   Diag->Arg       = Extrema;
+
+} // FUNCTION : Aux_Diag_SetExtrema
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Diag_GetExtrema
+// Description :  Retrieve the results of a consumer set up by Aux_Diag_SetExtrema()
+//
+// Parameter   :  Diag    : Evaluated consumer
+//                Extrema : Extrema_t object to store the output information of the extrema
+//
+// Return      :  Extrema->Value/Coord/Rank/Level/PID/Cell
+//-------------------------------------------------------------------------------------------------------
+void Aux_Diag_GetExtrema( const DiagConsumer_t *Diag, Extrema_t *Extrema )
+{
+
+   if ( Diag->Data == NULL  ||  Diag->PatchFunc != Diag_Extrema )
+      Aux_Error( ERROR_INFO, "consumer \"%s\" is not an evaluated extrema consumer !!\n", Diag->Name );
+
+   Extrema->Value    = (real)Diag->Data[0];
+   Extrema->Rank     = (int )Diag->Data[1];
+   Extrema->Coord[0] =       Diag->Data[2];
+   Extrema->Coord[1] =       Diag->Data[3];
+   Extrema->Coord[2] =       Diag->Data[4];
+   Extrema->Level    = (int )Diag->Data[5];
+   Extrema->PID      = (int )Diag->Data[6];
+   Extrema->Cell[0]  = (int )Diag->Data[7];
+   Extrema->Cell[1]  = (int )Diag->Data[8];
+   Extrema->Cell[2]  = (int )Diag->Data[9];
+
+} // FUNCTION : Aux_Diag_GetExtrema
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Diag_SetWeightedCenter
+// Description :  Set up a consumer for finding the weighted-by-field average center of the entire domain
+//
+// Note        :  1. Same as Aux_FindWeightedAverageCenter() with MaxR=__FLT_MAX__, MinWD=0.0, and MaxIter=1,
+//                   except that it can be evaluated together with other consumers by Aux_Diag_Execute()
+//                   --> Use Aux_FindWeightedAverageCenter() for a finite target region, which requires iterations
+//                2. Only support the intrinsic fluid fields, _POTE, _PAR_DENS, and _TOTAL_DENS
+//                3. Call Aux_Diag_GetWeightedCenter() to retrieve the results after Aux_Diag_Execute()
+//
+// Parameter   :  Diag  : Consumer to be set up
+//                Field : Weighting density field
+//
+// Return      :  Diag
+//-------------------------------------------------------------------------------------------------------
+void Aux_Diag_SetWeightedCenter( DiagConsumer_t *Diag, const long Field )
+{
+
+   if ( Field == _NONE  ||  Field & (Field-1) )
+      Aux_Error( ERROR_INFO, "incorrect Field (%ld) !!\n", Field );
+
+   Diag->Name      = "WeightedCenter";
+   Diag->Field     = Field;
+   Diag->Op        = DIAG_OP_SUM;
+   Diag->NData     = 4;    // 4: weighting, weighted coordinates (x/y/z)
+   Diag->PatchFunc = Diag_WeightedCenter;
+   Diag->Arg       = NULL;
+
+} // FUNCTION : Aux_Diag_SetWeightedCenter
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Diag_GetWeightedCenter
+// Description :  Retrieve the results of a consumer set up by Aux_Diag_SetWeightedCenter()
+//
+// Note        :  1. Return HUGE_NUMBER if the total weighting is zero
+//
+// Parameter   :  Diag                  : Evaluated consumer
+//                WeightedAverageCenter : Coordinate of the weighted average center to be returned
+//
+// Return      :  WeightedAverageCenter[]
+//-------------------------------------------------------------------------------------------------------
+void Aux_Diag_GetWeightedCenter( const DiagConsumer_t *Diag, double WeightedAverageCenter[] )
+{
+
+   if ( Diag->Data == NULL  ||  Diag->PatchFunc != Diag_WeightedCenter )
+      Aux_Error( ERROR_INFO, "consumer \"%s\" is not an evaluated weighted-center consumer !!\n", Diag->Name );
+
+   const double W = Diag->Data[0];
+
+   if ( W == 0.0 )
+   {
+      if ( MPI_Rank == 0 )
+         Aux_Message( stderr, "WARNING : Weighted average center cannot be found because the total weighting (W_AllRank) = %14.7e !!\n", W );
+
+      for (int d=0; d<3; d++) WeightedAverageCenter[d] = HUGE_NUMBER;
+
+      return;
+   }
+
+   for (int d=0; d<3; d++)
+   {
+      WeightedAverageCenter[d] = Diag->Data[1+d] / W;
+
+//    map the center back to the simulation domain in case of round-off errors
+      if ( OPT__BC_FLU[2*d] == BC_FLU_PERIODIC )
+      {
+         if      ( WeightedAverageCenter[d] >= amr->BoxEdgeR[d] ) WeightedAverageCenter[d] -= amr->BoxSize[d];
+         else if ( WeightedAverageCenter[d] <  amr->BoxEdgeL[d] ) WeightedAverageCenter[d] += amr->BoxSize[d];
+      }
+   }
+
+} // FUNCTION : Aux_Diag_GetWeightedCenter
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_InitBuffer
+// Description :  Initialize a packed reduction buffer with the identity of each reduction operation
+//
+// Note        :  1. The rank slot (i.e., Data[1]) of DIAG_OP_MINLOC/MAXLOC is set to the current MPI rank
+//
+// Parameter   :  Buf : Buffer to be initialized
+//-------------------------------------------------------------------------------------------------------
+void Diag_InitBuffer( double *Buf )
+{
+
+   for (int c=0; c<Diag_NConsumer; c++)
+   {
+      const DiagConsumer_t *Diag = Diag_Consumer[c];
+      double *Data = Buf + Diag_Offset[c];
+
+      switch ( Diag->Op )
+      {
+         case DIAG_OP_SUM :
+            for (int v=0; v<Diag->NData; v++)   Data[v] = 0.0;
+         break;
+
+         case DIAG_OP_MIN :
+            for (int v=0; v<Diag->NData; v++)   Data[v] = +HUGE_NUMBER;
+         break;
+
+         case DIAG_OP_MAX :
+            for (int v=0; v<Diag->NData; v++)   Data[v] = -HUGE_NUMBER;
+         break;
+
+         case DIAG_OP_MINLOC : case DIAG_OP_MAXLOC :
+            Data[0] = ( Diag->Op == DIAG_OP_MINLOC ) ? +HUGE_NUMBER : -HUGE_NUMBER;
+            Data[1] = MPI_Rank;
+            for (int v=2; v<Diag->NData; v++)   Data[v] = -1.0;
+         break;
+      }
+   }
+
+} // FUNCTION : Diag_InitBuffer
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_Combine
+// Description :  Combine two packed reduction buffers
+//
+// Note        :  1. InOut = In (op) InOut for each consumer
+//                2. Ties of DIAG_OP_MINLOC/MAXLOC are broken by the smaller rank slot (i.e., Data[1]),
+//                   and InOut is kept when the rank slots are also identical
+//
+// Parameter   :  In    : Input buffer
+//                InOut : Input and output buffer
+//-------------------------------------------------------------------------------------------------------
+void Diag_Combine( const double *In, double *InOut )
+{
+
+   for (int c=0; c<Diag_NConsumer; c++)
+   {
+      const DiagConsumer_t *Diag = Diag_Consumer[c];
+      const double *DataIn    = In    + Diag_Offset[c];
+            double *DataInOut = InOut + Diag_Offset[c];
+
+      switch ( Diag->Op )
+      {
+         case DIAG_OP_SUM :
+            for (int v=0; v<Diag->NData; v++)   DataInOut[v] += DataIn[v];
+         break;
+
+         case DIAG_OP_MIN :
+            for (int v=0; v<Diag->NData; v++)   DataInOut[v] = MIN( DataIn[v], DataInOut[v] );
+         break;
+
+         case DIAG_OP_MAX :
+            for (int v=0; v<Diag->NData; v++)   DataInOut[v] = MAX( DataIn[v], DataInOut[v] );
+         break;
+
+         case DIAG_OP_MINLOC : case DIAG_OP_MAXLOC :
+         {
+            const bool Better = ( Diag->Op == DIAG_OP_MINLOC ) ? ( DataIn[0] < DataInOut[0] ) : ( DataIn[0] > DataInOut[0] );
+            const bool Tie    = ( DataIn[0] == DataInOut[0]  &&  DataIn[1] < DataInOut[1] );
+
+            if ( Better || Tie )    memcpy( DataInOut, DataIn, Diag->NData*sizeof(double) );
+         }
+         break;
+      }
+   }
+
+} // FUNCTION : Diag_Combine
+
+
+
+#ifndef SERIAL
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_MPI_Combine
+// Description :  User-defined MPI reduction operation for the packed reduction buffer
+//
+// Note        :  1. Invoked by MPI_Allreduce() in Aux_Diag_Execute()
+//                2. Each element of the MPI datatype is an entire packed reduction buffer
+//
+// Parameter   :  In    : Input buffer
+//                InOut : Input and output buffer
+//                Len   : Number of packed reduction buffers
+//                Type  : MPI datatype (not used)
+//-------------------------------------------------------------------------------------------------------
+void Diag_MPI_Combine( void *In, void *InOut, int *Len, MPI_Datatype *Type )
+{
+
+   const int NData = Diag_Offset[Diag_NConsumer];
+
+   for (int t=0; t<*Len; t++)
+      Diag_Combine( (const double*)In + (long)t*NData, (double*)InOut + (long)t*NData );
+
+} // FUNCTION : Diag_MPI_Combine
+#endif // #ifndef SERIAL
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_GetPatchField
+// Description :  Return the pointer to the data of a given field in the target patch
+//
+// Note        :  1. Only support the intrinsic fluid fields, _POTE, _PAR_DENS, and _TOTAL_DENS
+//
+// Parameter   :  Field : Target field
+//                Patch : Target patch
+//
+// Return      :  Pointer to a [PS1][PS1][PS1] array
+//-------------------------------------------------------------------------------------------------------
+const real (*Diag_GetPatchField( const long Field, const DiagPatch_t &Patch ))[PS1][PS1]
+{
+
+   for (int v=0; v<NCOMP_TOTAL; v++)
+      if ( Field == BIDX(v) )    return amr->patch[ Patch.FluSg ][ Patch.lv ][ Patch.PID ]->fluid[v];
+
+#  ifdef GRAVITY
+   if ( Field == _POTE )         return amr->patch[ Patch.PotSg ][ Patch.lv ][ Patch.PID ]->pot;
+#  endif
+
+#  ifdef PARTICLE
+   if ( Field == _PAR_DENS )     return Patch.ParDens;
+   if ( Field == _TOTAL_DENS )   return Patch.TotDens;
+#  endif
+
+   Aux_Error( ERROR_INFO, "unsupported field (%ld) !!\n", Field );
+
+   return NULL;
+
+} // FUNCTION : Diag_GetPatchField
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_Extrema
+// Description :  Per-patch callback of the consumers set up by Aux_Diag_SetExtrema()
+//
+// Note        :  1. Data layout: [0] value, [1] rank, [2-4] coordinates, [5] level, [6] PID, [7-9] cell indices
+//                2. Support periodic BC
+//
+// Parameter   :  Out   : Thread-private reduction buffer of this consumer
+//                Patch : Target patch
+//                Diag  : This consumer
+//-------------------------------------------------------------------------------------------------------
+void Diag_Extrema( double Out[], const DiagPatch_t &Patch, const DiagConsumer_t &Diag )
+{
+
+   const Extrema_t *Extrema     = (const Extrema_t*)Diag.Arg;
+   const bool       FindMax     = ( Diag.Op == DIAG_OP_MAXLOC );
+   const double     MaxR        = Extrema->Radius;
+   const double     MaxR2       = SQR( MaxR );
+   const double    *Center      = Extrema->Center;
+   const double     dh          = Patch.dh;
+   const double     HalfBox[3]  = { 0.5*amr->BoxSize[0], 0.5*amr->BoxSize[1], 0.5*amr->BoxSize[2] };
+   const bool       Periodic[3] = { OPT__BC_FLU[0] == BC_FLU_PERIODIC,
+                                    OPT__BC_FLU[2] == BC_FLU_PERIODIC,
+                                    OPT__BC_FLU[4] == BC_FLU_PERIODIC };
+   const double    *EdgeL       = amr->patch[0][ Patch.lv ][ Patch.PID ]->EdgeL;
+   const double    *EdgeR       = amr->patch[0][ Patch.lv ][ Patch.PID ]->EdgeR;
+
+
+// skip distant patches
+   for (int d=0; d<3; d++)
+   {
+      double Center_Img = Center[d];
+      if ( Periodic[d] )   Center_Img = ( Center[d] > amr->BoxCenter[d] ) ? Center[d]-amr->BoxSize[d] : Center[d]+amr->BoxSize[d];
+
+      if (  ( EdgeL[d] > Center    [d]+MaxR || EdgeR[d] < Center    [d]-MaxR )  &&
+            ( EdgeL[d] > Center_Img   +MaxR || EdgeR[d] < Center_Img   -MaxR )  )
+         return;
+   }
+
+
+// loop over all cells
+   const real (*Field)[PS1][PS1] = Diag_GetPatchField( Diag.Field, Patch );
+
+   const double x0 = EdgeL[0] + 0.5*dh;
+   const double y0 = EdgeL[1] + 0.5*dh;
+   const double z0 = EdgeL[2] + 0.5*dh;
+
+   for (int k=0; k<PS1; k++)  {  const double z = z0 + k*dh;
+                                 double dz = z - Center[2];
+                                 if ( Periodic[2] ) {
+                                    if      ( dz > +HalfBox[2] )  {  dz -= amr->BoxSize[2];  }
+                                    else if ( dz < -HalfBox[2] )  {  dz += amr->BoxSize[2];  }
+                                 }
+   for (int j=0; j<PS1; j++)  {  const double y = y0 + j*dh;
+                                 double dy = y - Center[1];
+                                 if ( Periodic[1] ) {
+                                    if      ( dy > +HalfBox[1] )  {  dy -= amr->BoxSize[1];  }
+                                    else if ( dy < -HalfBox[1] )  {  dy += amr->BoxSize[1];  }
+                                 }
+   for (int i=0; i<PS1; i++)  {  const double x = x0 + i*dh;
+                                 double dx = x - Center[0];
+                                 if ( Periodic[0] ) {
+                                    if      ( dx > +HalfBox[0] )  {  dx -= amr->BoxSize[0];  }
+                                    else if ( dx < -HalfBox[0] )  {  dx += amr->BoxSize[0];  }
+                                 }
+
+      const double r2 = SQR(dx) + SQR(dy) + SQR(dz);
+
+//    only include cells within the target sphere
+      if ( r2 < MaxR2 )
+      {
+         const double Value = Field[k][j][i];
+
+         if (  ( FindMax && Value > Out[0] )  ||  ( !FindMax && Value < Out[0] )  )
+         {
+            Out[0] = Value;
+            Out[1] = MPI_Rank;
+            Out[2] = x;
+            Out[3] = y;
+            Out[4] = z;
+            Out[5] = Patch.lv;
+            Out[6] = Patch.PID;
+            Out[7] = i;
+            Out[8] = j;
+            Out[9] = k;
+         }
+      }
+   }}} // i,j,k
+
+} // FUNCTION : Diag_Extrema
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Diag_WeightedCenter
+// Description :  Per-patch callback of the consumers set up by Aux_Diag_SetWeightedCenter()
+//
+// Note        :  1. Data layout: [0] weighting, [1-3] weighted coordinates
+//                2. Only include cells with the weighting density > 0.0
+//
+// Parameter   :  Out   : Thread-private reduction buffer of this consumer
+//                Patch : Target patch
+//                Diag  : This consumer
+//-------------------------------------------------------------------------------------------------------
+void Diag_WeightedCenter( double Out[], const DiagPatch_t &Patch, const DiagConsumer_t &Diag )
+{
+
+   const real (*Field)[PS1][PS1] = Diag_GetPatchField( Diag.Field, Patch );
+
+   const double dh = Patch.dh;
+   const double dv = Patch.dv;
+   const double x0 = amr->patch[0][ Patch.lv ][ Patch.PID ]->EdgeL[0] + 0.5*dh;
+   const double y0 = amr->patch[0][ Patch.lv ][ Patch.PID ]->EdgeL[1] + 0.5*dh;
+   const double z0 = amr->patch[0][ Patch.lv ][ Patch.PID ]->EdgeL[2] + 0.5*dh;
+
+   for (int k=0; k<PS1; k++)  {  const double z = z0 + k*dh;
+   for (int j=0; j<PS1; j++)  {  const double y = y0 + j*dh;
+   for (int i=0; i<PS1; i++)  {  const double x = x0 + i*dh;
+
+      const double WD = Field[k][j][i];
+
+      if ( WD > 0.0 )
+      {
+         const double dw = WD*dv; // weighting
+
+         Out[0] += dw;
+         Out[1] += dw*x;
+         Out[2] += dw*y;
+         Out[3] += dw*z;
+      }
+   }}} // i,j,k
+
+} // FUNCTION : Diag_WeightedCenter
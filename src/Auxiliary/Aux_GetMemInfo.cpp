@@ -11,6 +11,8 @@
 //                   (1) VmSize/Peak : current/peak virtual  memory size
 //                   (2) VmRSS/HWM   : current/peak physical memory size
 //                2. Only the maximum values among all MPI ranks will be recorded
+//                3. Also record the statistics of the adaptive memory pool for OPT__MEMORY_POOL == MEMORY_POOL_AUTO
+//                   --> See Mis_RecordMemoryPool()
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -133,6 +135,10 @@ void Aux_GetMemInfo()
 
    } // if ( MPI_Rank == 0 )
 
+
+// 4. record the statistics of the adaptive memory pool
+   if ( OPT__MEMORY_POOL == MEMORY_POOL_AUTO )  Mis_RecordMemoryPool();
+
 } // FUNCTION : Aux_GetMemInfo
 
 
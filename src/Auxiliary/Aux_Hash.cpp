@@ -0,0 +1,37 @@
+#include "GAMER.h"
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Hash
+// Description :  Compute the 64-bit FNV-1a hash of an arbitrary byte array
+//
+// Note        :  1. Used for validating on-disk caches against the parameters they depend on
+//                   --> Not a cryptographic hash
+//                2. Multiple arrays can be hashed together by passing the previous hash as "Seed"
+//                   --> Use Seed = AUX_HASH_INIT for the first array
+//
+// Parameter   :  Data  : Target byte array
+//                NByte : Number of bytes in Data[]
+//                Seed  : Initial hash value
+//
+// Return      :  Hash value
+//-------------------------------------------------------------------------------------------------------
+ulong Aux_Hash( const void *Data, const long NByte, const ulong Seed )
+{
+
+   const ulong          Prime = 1099511628211UL;
+   const unsigned char *Byte  = (const unsigned char*)Data;
+
+   ulong Hash = Seed;
+
+   for (long t=0; t<NByte; t++)
+   {
+      Hash ^= (ulong)Byte[t];
+      Hash *= Prime;
+   }
+
+   return Hash;
+
+} // FUNCTION : Aux_Hash
@@ -3,73 +3,125 @@
 
 
 
+// extrema recorded by Aux_Record_Center() and the associated diagnostic consumers
+static Extrema_t      Max_Dens;
+static DiagConsumer_t Diag_MaxDens;
+#ifdef PARTICLE
+static Extrema_t      Max_ParDens, Max_TotDens;
+static DiagConsumer_t Diag_MaxParDens, Diag_MaxTotDens;
+#endif
+#ifdef GRAVITY
+static Extrema_t      Min_Pote;
+static DiagConsumer_t Diag_MinPote;
+#endif
+
+
+
+
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Aux_Record_Center
-// Description :  Record various center coordinates
+// Function    :  Aux_Record_Center_AddDiag
+// Description :  Add the extrema required by Aux_Record_Center() to the single-pass diagnostics engine
 //
-// Note        :  1. Invoked by main()
-//                2. Enabled by the runtime option "OPT__RECORD_CENTER"
-//                3. This function will be called both during the program initialization and after each global step
-//                4. It will record the position of maximum density, minimum potential, and center of mass
-//                5. Output filename is fixed to "Record__Center"
+// Note        :  1. Invoked by Aux_Diagnostics() and Aux_Record_Center()
+//                2. Results are evaluated by Aux_Diag_Execute()
 //
 // Parameter   :  None
 //
 // Return      :  None
 //-------------------------------------------------------------------------------------------------------
-void Aux_Record_Center()
+void Aux_Record_Center_AddDiag()
 {
 
-   static bool FirstTime = true;
-   char FileName[2*MAX_STRING];
-   sprintf( FileName, "%s/Record__Center", OUTPUT_DIR );
-
-
 // 1. Maximum fluid density in HYDRO/ELBDM
-   Extrema_t Max_Dens;
    Max_Dens.Field     = _DENS;
    Max_Dens.Radius    = __FLT_MAX__; // entire domain
    Max_Dens.Center[0] = amr->BoxCenter[0];
    Max_Dens.Center[1] = amr->BoxCenter[1];
    Max_Dens.Center[2] = amr->BoxCenter[2];
 
-   Aux_FindExtrema( &Max_Dens, EXTREMA_MAX, 0, TOP_LEVEL, PATCH_LEAF );
+   Aux_Diag_SetExtrema( &Diag_MaxDens, &Max_Dens, EXTREMA_MAX );
+   Aux_Diag_Add( &Diag_MaxDens );
 
 
 #  ifdef PARTICLE
 // 2. Maximum particle density
-   Extrema_t Max_ParDens;
    Max_ParDens.Field     = _PAR_DENS;
    Max_ParDens.Radius    = __FLT_MAX__; // entire domain
    Max_ParDens.Center[0] = amr->BoxCenter[0];
    Max_ParDens.Center[1] = amr->BoxCenter[1];
    Max_ParDens.Center[2] = amr->BoxCenter[2];
 
-   Aux_FindExtrema( &Max_ParDens, EXTREMA_MAX, 0, TOP_LEVEL, PATCH_LEAF );
+   Aux_Diag_SetExtrema( &Diag_MaxParDens, &Max_ParDens, EXTREMA_MAX );
+   Aux_Diag_Add( &Diag_MaxParDens );
 
 
 // 3. Maximum total density including fluid density and particle density
-   Extrema_t Max_TotDens;
    Max_TotDens.Field     = _TOTAL_DENS;
    Max_TotDens.Radius    = __FLT_MAX__; // entire domain
    Max_TotDens.Center[0] = amr->BoxCenter[0];
    Max_TotDens.Center[1] = amr->BoxCenter[1];
    Max_TotDens.Center[2] = amr->BoxCenter[2];
 
-   Aux_FindExtrema( &Max_TotDens, EXTREMA_MAX, 0, TOP_LEVEL, PATCH_LEAF );
+   Aux_Diag_SetExtrema( &Diag_MaxTotDens, &Max_TotDens, EXTREMA_MAX );
+   Aux_Diag_Add( &Diag_MaxTotDens );
 #  endif
 
 
 #  ifdef GRAVITY
 // 4. Minimum gravitational potential
-   Extrema_t Min_Pote;
    Min_Pote.Field     = _POTE;
    Min_Pote.Radius    = __FLT_MAX__; // entire domain
    Min_Pote.Center[0] = amr->BoxCenter[0];
    Min_Pote.Center[1] = amr->BoxCenter[1];
    Min_Pote.Center[2] = amr->BoxCenter[2];
 
-   Aux_FindExtrema( &Min_Pote, EXTREMA_MIN, 0, TOP_LEVEL, PATCH_LEAF );
+   Aux_Diag_SetExtrema( &Diag_MinPote, &Min_Pote, EXTREMA_MIN );
+   Aux_Diag_Add( &Diag_MinPote );
+#  endif
+
+} // FUNCTION : Aux_Record_Center_AddDiag
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Aux_Record_Center
+// Description :  Record various center coordinates
+//
+// Note        :  1. Invoked by main()
+//                2. Enabled by the runtime option "OPT__RECORD_CENTER"
+//                3. This function will be called both during the program initialization and after each global step
+//                4. It will record the position of maximum density, minimum potential, and center of mass
+//                5. Output filename is fixed to "Record__Center"
+//                6. All extrema are found in a single pass by the diagnostics engine
+//                   --> Reuse the results evaluated by Aux_Diagnostics() at the current step if available
+//                   --> The center of mass still requires separate passes since it is found iteratively
+//
+// Parameter   :  None
+//
+// Return      :  None
+//-------------------------------------------------------------------------------------------------------
+void Aux_Record_Center()
+{
+
+   static bool FirstTime = true;
+   char FileName[2*MAX_STRING];
+   sprintf( FileName, "%s/Record__Center", OUTPUT_DIR );
+
+
+// 1-4. find all extrema in a single pass unless they have been found at the current step
+   if ( ! Diag_MaxDens.IsCurrent( Step, Time[0] ) )
+   {
+      Aux_Record_Center_AddDiag();
+      Aux_Diag_Execute();
+   }
+
+   Aux_Diag_GetExtrema( &Diag_MaxDens,    &Max_Dens    );
+#  ifdef PARTICLE
+   Aux_Diag_GetExtrema( &Diag_MaxParDens, &Max_ParDens );
+   Aux_Diag_GetExtrema( &Diag_MaxTotDens, &Max_TotDens );
+#  endif
+#  ifdef GRAVITY
+   Aux_Diag_GetExtrema( &Diag_MinPote,    &Min_Pote    );
 #  endif
 
 
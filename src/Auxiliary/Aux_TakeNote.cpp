@@ -524,6 +524,12 @@ void Aux_TakeNote()
       fprintf( Note, "INTERP_MASK                     OFF\n" );
 #     endif
 
+#     ifdef INTERP_MASK_LOCAL
+      fprintf( Note, "INTERP_MASK_LOCAL               ON\n" );
+#     else
+      fprintf( Note, "INTERP_MASK_LOCAL               OFF\n" );
+#     endif
+
 #     ifdef FB_SEP_FLUOUT
       fprintf( Note, "FB_SEP_FLUOUT                   ON\n" );
 #     else
@@ -936,6 +942,7 @@ void Aux_TakeNote()
       fprintf( Note, "Par->TracerVelCorr             % d\n",      amr->Par->TracerVelCorr       );
       fprintf( Note, "OPT__FREEZE_PAR                % d\n",      OPT__FREEZE_PAR               );
       fprintf( Note, "OPT__PAR_INIT_CHECK            % d\n",      OPT__PAR_INIT_CHECK           );
+      fprintf( Note, "PAR_REORDER_STEP               % d\n",      PAR_REORDER_STEP              );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n" );
 #     endif // #ifdef PARTICLE
@@ -998,6 +1005,7 @@ void Aux_TakeNote()
 #     if ( MODEL == HYDRO )
       fprintf( Note, "AUTO_REDUCE_MINMOD_FACTOR      % 14.7e\n",  AUTO_REDUCE_MINMOD_FACTOR   );
       fprintf( Note, "AUTO_REDUCE_MINMOD_MIN         % 14.7e\n",  AUTO_REDUCE_MINMOD_MIN      );
+      fprintf( Note, "AUTO_REDUCE_DT_LOCAL           % d\n",      AUTO_REDUCE_DT_LOCAL        );
 #     endif
       fprintf( Note, "AUTO_REDUCE_INT_MONO_FACTOR    % 14.7e\n",  AUTO_REDUCE_INT_MONO_FACTOR );
       fprintf( Note, "AUTO_REDUCE_INT_MONO_MIN       % 14.7e\n",  AUTO_REDUCE_INT_MONO_MIN    );
@@ -1086,6 +1094,8 @@ void Aux_TakeNote()
 #     endif
       fprintf( Note, "OPT__REUSE_MEMORY              % d\n",      OPT__REUSE_MEMORY         );
       fprintf( Note, "OPT__MEMORY_POOL               % d\n",      OPT__MEMORY_POOL          );
+      fprintf( Note, "OPT__SINGLE_SANDGLASS          % d\n",      OPT__SINGLE_SANDGLASS     );
+      fprintf( Note, "OPT__PATCH_SLAB                % d\n",      OPT__PATCH_SLAB           );
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n" );
 
@@ -1202,6 +1212,7 @@ void Aux_TakeNote()
       fprintf( Note, "CR_DIFF_PARA                   % 14.7e\n",  CR_DIFF_PARA            );
       fprintf( Note, "CR_DIFF_PERP                   % 14.7e\n",  CR_DIFF_PERP            );
       fprintf( Note, "CR_DIFF_MIN_B                  % 14.7e\n",  CR_DIFF_MIN_B           );
+      fprintf( Note, "CR_DIFF_RKL2                   %d\n",       CR_DIFF_RKL2            );
 #     endif // #ifdef CR_DIFFUSION
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "\n\n");
@@ -1434,7 +1445,8 @@ void Aux_TakeNote()
       fprintf( Note, "EXT_POT_TABLE_EDGEL_X          % 14.7e\n",  EXT_POT_TABLE_EDGEL[0]  );
       fprintf( Note, "EXT_POT_TABLE_EDGEL_Y          % 14.7e\n",  EXT_POT_TABLE_EDGEL[1]  );
       fprintf( Note, "EXT_POT_TABLE_EDGEL_Z          % 14.7e\n",  EXT_POT_TABLE_EDGEL[2]  );
-      fprintf( Note, "EXT_POT_TABLE_FLOAT8           % d\n",      EXT_POT_TABLE_FLOAT8    ); }
+      fprintf( Note, "EXT_POT_TABLE_FLOAT8           % d\n",      EXT_POT_TABLE_FLOAT8    );
+      fprintf( Note, "EXT_POT_TABLE_CACHE            % d\n",      EXT_POT_TABLE_CACHE     ); }
       fprintf( Note, "OPT__GRAVITY_EXTRA_MASS        % d\n",      OPT__GRAVITY_EXTRA_MASS );
       fprintf( Note, "AveDensity_Init                % 14.7e\n",  AveDensity_Init         );
       fprintf( Note, "***********************************************************************************\n" );
@@ -1456,6 +1468,7 @@ void Aux_TakeNote()
       fprintf( Note, "OPT__UM_IC_DOWNGRADE           % d\n",      OPT__UM_IC_DOWNGRADE      );
       fprintf( Note, "OPT__UM_IC_REFINE              % d\n",      OPT__UM_IC_REFINE         );
       fprintf( Note, "OPT__UM_IC_LOAD_NRANK          % d\n",      OPT__UM_IC_LOAD_NRANK     );
+      fprintf( Note, "OPT__UM_IC_MMAP                % d\n",      OPT__UM_IC_MMAP           );
       fprintf( Note, "OPT__INIT_RESTRICT             % d\n",      OPT__INIT_RESTRICT        );
       fprintf( Note, "OPT__INIT_GRID_WITH_OMP        % d\n",      OPT__INIT_GRID_WITH_OMP   );
       fprintf( Note, "OPT__GPUID_SELECT              % d\n",      OPT__GPUID_SELECT         );
@@ -1473,6 +1486,7 @@ void Aux_TakeNote()
 
          default:                       fprintf( Note, "UNKNOWN\n" );
       } // switch ( OPT__FFTW_STARTUP )
+      fprintf( Note, "OPT__FFTW_CACHE                % d\n",      OPT__FFTW_CACHE           );
 #     endif // # ifdef SUPPORT_FFTW
 
 //    refinement region for OPT__UM_IC_NLEVEL>1
@@ -1611,6 +1625,7 @@ void Aux_TakeNote()
       fprintf( Note, "***********************************************************************************\n" );
       fprintf( Note, "OPT__OUTPUT_TOTAL              % d\n",      OPT__OUTPUT_TOTAL           );
       fprintf( Note, "OPT__OUTPUT_PART               % d\n",      OPT__OUTPUT_PART            );
+      fprintf( Note, "OPT__OUTPUT_PART_FORMAT        % d\n",      OPT__OUTPUT_PART_FORMAT     );
       fprintf( Note, "OPT__OUTPUT_USER               % d\n",      OPT__OUTPUT_USER            );
       fprintf( Note, "OPT__OUTPUT_TEXT_FORMAT_FLT     %s\n",      OPT__OUTPUT_TEXT_FORMAT_FLT );
       fprintf( Note, "OPT__OUTPUT_TEXT_LENGTH_INT    % d\n",      OPT__OUTPUT_TEXT_LENGTH_INT );
@@ -1676,6 +1691,7 @@ void Aux_TakeNote()
       fprintf( Note, "OUTPUT_PART_X                  % 21.14e\n", OUTPUT_PART_X               );
       fprintf( Note, "OUTPUT_PART_Y                  % 21.14e\n", OUTPUT_PART_Y               );
       fprintf( Note, "OUTPUT_PART_Z                  % 21.14e\n", OUTPUT_PART_Z               );
+      fprintf( Note, "OUTPUT_PART_PROJ_LV            % d\n",      OUTPUT_PART_PROJ_LV         );
       fprintf( Note, "INIT_DUMPID                    % d\n",      INIT_DUMPID                 );
       fprintf( Note, "OUTPUT_DIR                      %s\n",      OUTPUT_DIR                  );
       fprintf( Note, "***********************************************************************************\n" );
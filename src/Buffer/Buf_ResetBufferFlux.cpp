@@ -10,6 +10,8 @@
 // Description :  Reset all fluxes in the buffer patches as zero
 //
 // Note        :  1. Invoked by Flu_AdvanceDt()
+//                2. Fluxes of all buffer patches are stored contiguously at the end of the flux register
+//                   amr->FluxReg[lv] --> reset them with a single memset()
 //
 // Parameter   :  lv : Target refinement level
 //-------------------------------------------------------------------------------------------------------
@@ -24,22 +26,11 @@ void Buf_ResetBufferFlux( const int lv )
    }
 
 
-   real (*FluxPtr)[PATCH_SIZE][PATCH_SIZE] = NULL;
+   const FluxReg_t *FluxReg = &amr->FluxReg[lv];
+   const int        NFaceBuf = FluxReg->NFace - FluxReg->NFaceReal;
 
-#  pragma omp parallel for private( FluxPtr ) schedule( runtime )
-   for (int PID=amr->NPatchComma[lv][1]; PID<amr->NPatchComma[lv][27]; PID++)
-   for (int s=0; s<6; s++)
-   {
-      FluxPtr = amr->patch[0][lv][PID]->flux[s];
-
-      if ( FluxPtr != NULL )
-      {
-         for(int v=0; v<NFLUX_TOTAL; v++)
-         for(int m=0; m<PATCH_SIZE; m++)
-         for(int n=0; n<PATCH_SIZE; n++)
-            FluxPtr[v][m][n] = (real)0.0;
-      }
-   }
+   if ( NFaceBuf > 0 )
+      memset( FluxReg->Flux[ FluxReg->NFaceReal ], 0, (long)NFaceBuf*NFLUX_TOTAL*SQR(PS1)*sizeof(real) );
 
 } // FUNCTION : Buf_ResetBufferFlux
 
@@ -10,6 +10,8 @@
 //
 // Note        :  1. Do nothing on the top level
 //                2. Only used in the serial mode
+//                3. Flux arrays of all faces are stored in the flux register amr->FluxReg[lv]
+//                   --> Faces of real patches are added before those of buffer patches
 //
 // Parameter   :  lv : Coarse-grid level
 //-------------------------------------------------------------------------------------------------------
@@ -28,17 +30,18 @@ void Flu_AllocateFluxArray( const int lv )
    if ( lv == TOP_LEVEL )  return;
 
 
-// deallocate the flux arrays allocated previously
+// detach the flux arrays allocated previously
 #  pragma omp parallel for schedule( runtime )
    for (int PID=0; PID<amr->NPatchComma[lv][7]; PID++)   amr->patch[0][lv][PID]->fdelete();
 
+   amr->FluxReg[lv].Reset();
 
-// allocate flux arrays for the real patches
+
+// record the faces of the real patches
    int SibPID;
 
    if ( amr->NPatchComma[lv+1][7] != 0 )
    {
-#     pragma omp parallel for private( SibPID ) schedule( runtime )
       for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
       {
          if ( amr->patch[0][lv][PID]->son == -1 )
@@ -46,17 +49,21 @@ void Flu_AllocateFluxArray( const int lv )
             for (int s=0; s<6; s++)
             {
                if (  ( SibPID = amr->patch[0][lv][PID]->sibling[s] ) >= 0  )
-                  if ( amr->patch[0][lv][SibPID]->son != -1 )  amr->patch[0][lv][PID]->fnew( s, AUTO_REDUCE_DT );
+                  if ( amr->patch[0][lv][SibPID]->son != -1 )  amr->FluxReg[lv].AddFace( PID, s );
             }
          }
       }
    }
 
 
-// allocate flux arrays for the buffer patches
+// record the faces of the buffer patches
    if ( amr->NPatchComma[lv+1][7] != 0 )  Flu_AllocateFluxArray_Buffer( lv );
 
 
+// allocate flux arrays for all faces
+   amr->FluxReg[lv].Build( amr->patch[0][lv], amr->NPatchComma[lv][1], AUTO_REDUCE_DT );
+
+
 // get the PIDs for sending/receiving fluxes to/from neighboring ranks
    Buf_RecordExchangeFluxPatchID( lv );
 
@@ -7,8 +7,10 @@
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Flu_AllocateFluxArray_Buffer
-// Description :  Allocate flux arrays for the coarse-grid buffer patches (at level lv) adjacent to the
-//                coarse-fine boundaries
+// Description :  Record the faces of the coarse-grid buffer patches (at level lv) adjacent to the
+//                coarse-fine boundaries in the flux register amr->FluxReg[lv]
+//
+// Note        :  1. Invoked by Flu_AllocateFluxArray(), which allocates the flux arrays of all recorded faces
 //
 // Parameter   :  lv : Target coarse-grid level
 //-------------------------------------------------------------------------------------------------------
@@ -27,7 +29,6 @@ void Flu_AllocateFluxArray_Buffer( const int lv )
    {
       for (int t=0; t<4; t++)    Table[t] = TABLE_03(s,t);
 
-#     pragma omp parallel for private( PID, SonPID, SibPID ) schedule( runtime )
       for (int PID0=amr->NPatchComma[lv][s+1]; PID0<amr->NPatchComma[lv][s+2]; PID0+=8)
       for (int t=0; t<4; t++)
       {
@@ -45,7 +46,7 @@ void Flu_AllocateFluxArray_Buffer( const int lv )
 
             if ( SibPID != -1 )
             if ( amr->patch[0][lv][SibPID]->son != -1 )
-               amr->patch[0][lv][PID]->fnew( MirrorSib[s], AUTO_REDUCE_DT );
+               amr->FluxReg[lv].AddFace( PID, MirrorSib[s] );
          }
       }
    } // for (int s=0; s<6; s++)
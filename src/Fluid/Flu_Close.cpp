@@ -23,7 +23,19 @@ static void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List
                                real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                                const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                                const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
-                               const real dt );
+                               const double h_Corner_Array_F[][3],
+                               const real h_Pot_Array_USG_F[][ CUBE(USG_NXT_F) ],
+                               const double TimeOld, const real dt );
+#if ( !defined GPU  &&  !defined MHD  &&  FLU_SCHEME != RTVD )
+static int RetryPatchGroup( const int lv, const int NRetry, const int *TID_List,
+                            const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
+                            real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                            char h_DE_Array_F_Out[][ CUBE(PS2) ],
+                            real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                            const double h_Corner_Array_F[][3],
+                            const real h_Pot_Array_USG_F[][ CUBE(USG_NXT_F) ],
+                            const double TimeOld, const real dt );
+#endif
 #endif
 #ifdef MHD
 void StoreElectric( const int lv, const real h_Ele_Array[][9][NCOMP_ELE][ PS2P1*PS2 ],
@@ -78,6 +90,11 @@ extern void Hydro_RiemannSolver_HLLD( const int XYZ, real Flux_Out[], const real
 //                PID0_List         : List recording the patch indices with LocalID==0 to be udpated
 //                h_Flu_Array_F_In  : Host array storing the input fluid variables
 //                h_Mag_Array_F_In  : Host array storing the input B field (for MHD only)
+//                h_Corner_Array_F  : Host array storing the physical corner coordinates of each patch group
+//                                    (for AUTO_REDUCE_DT_LOCAL only)
+//                h_Pot_Array_USG_F : Host array storing the input potential for UNSPLIT_GRAVITY
+//                                    (for AUTO_REDUCE_DT_LOCAL only)
+//                TimeOld           : Physical time before update (for AUTO_REDUCE_DT_LOCAL only)
 //                dt                : Evolution time-step
 //-------------------------------------------------------------------------------------------------------
 void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
@@ -89,14 +106,16 @@ void Flu_Close( const int lv, const int SaveSg_Flu, const int SaveSg_Mag,
                 const int NPG, const int *PID0_List,
                 const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
                 const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
-                const double dt )
+                const double h_Corner_Array_F[][3],
+                const real h_Pot_Array_USG_F[][ CUBE(USG_NXT_F) ],
+                const double TimeOld, const double dt )
 {
 
 // try to correct the unphysical results in h_Flu_Array_F_Out (e.g., negative density)
 // --> must be done BEFORE invoking both StoreFlux() and CorrectFlux() since CorrectUnphysical() might modify the flux array
 #  if ( MODEL == HYDRO  &&  !defined SRHD )
    CorrectUnphysical( lv, NPG, PID0_List, h_Flu_Array_F_In, h_Flu_Array_F_Out, h_DE_Array_F_Out, h_Flux_Array,
-                      h_Mag_Array_F_In, h_Mag_Array_F_Out, dt );
+                      h_Mag_Array_F_In, h_Mag_Array_F_Out, h_Corner_Array_F, h_Pot_Array_USG_F, TimeOld, dt );
 #  endif
 
 
@@ -520,13 +539,18 @@ bool Unphysical( const real Fluid[], const int CheckMode, const real Emag )
 //                         Apply floors
 //
 //                      if ( still_found_unphysical )
-//                         if ( AUTO_REDUCE_DT )
+//                         if ( AUTO_REDUCE_DT_LOCAL )
+//                            Re-integrate the failed patch groups by RetryPatchGroup()
+//
+//                         if ( still_failed  &&  AUTO_REDUCE_DT )
 //                            Invoke the fluid solver again on the same level but with smaller dt/MINMOD_COEFF/INT_MONO_COEFF(_B)
-//                         else
+//                         else if ( still_failed )
 //                            Print debug messages and abort
 //                      else
 //                         Store the corrected results in the output array
 //                   }
+//                4. AUTO_REDUCE_DT_LOCAL is applied only when AutoReduceDt_Continue is true
+//                   --> When all coefficients have been exhausted, floors are applied in the last attempt as usual
 //
 // Parameter   :  lv                : Target refinement level
 //                NPG               : Number of patch groups to be evaluated
@@ -537,6 +561,9 @@ bool Unphysical( const real Fluid[], const int CheckMode, const real Emag )
 //                h_Flux_Array      : Output array storing the updated flux data
 //                h_Mag_Array_F_In  : Input B field array
 //                h_Mag_Array_F_Out : Output B field array
+//                h_Corner_Array_F  : Input corner coordinates of each patch group (for AUTO_REDUCE_DT_LOCAL only)
+//                h_Pot_Array_USG_F : Input potential array for UNSPLIT_GRAVITY (for AUTO_REDUCE_DT_LOCAL only)
+//                TimeOld           : Physical time before update (for AUTO_REDUCE_DT_LOCAL only)
 //                dt                : Evolution time-step
 //-------------------------------------------------------------------------------------------------------
 void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
@@ -546,7 +573,9 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
                         real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
                         const real h_Mag_Array_F_In[][NCOMP_MAG][ FLU_NXT_P1*SQR(FLU_NXT) ],
                         const real h_Mag_Array_F_Out[][NCOMP_MAG][ PS2P1*SQR(PS2) ],
-                        const real dt )
+                        const double h_Corner_Array_F[][3],
+                        const real h_Pot_Array_USG_F[][ CUBE(USG_NXT_F) ],
+                        const double TimeOld, const real dt )
 {
 
    const real dh               = (real)amr->dh[lv];
@@ -560,6 +589,20 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
    long NCorrThisTime = 0;
    bool CorrectUnphy  = GAMER_SUCCESS;
 
+// re-integrate the failed patch groups locally instead of the entire level
+#  if ( !defined GPU  &&  !defined MHD  &&  FLU_SCHEME != RTVD )
+   const bool RetryLocal = ( AUTO_REDUCE_DT_LOCAL  &&  AutoReduceDt_Continue );
+#  else
+   const bool RetryLocal = false;
+#  endif
+   bool *Retry = NULL;
+
+   if ( RetryLocal )
+   {
+      Retry = new bool [NPG];
+      for (int TID=0; TID<NPG; TID++)  Retry[TID] = false;
+   }
+
 
 // OpenMP parallel region
 #  pragma omp parallel
@@ -987,10 +1030,18 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
 //          --> when AutoReduceDt_Continue is true, we still check Eint instead of Etot
             if ( Unphysical(Update, (AutoReduceDt_Continue)?CheckMinEint:CheckMinEtot, Emag_Out) )
             {
-//             set CorrectUnphy = GAMER_FAILED if any cells fail
+//             mark the patch group to be re-integrated by RetryPatchGroup() if RetryLocal is on
+//             --> each patch group is checked by only one OpenMP thread
+               if ( RetryLocal )
+                  Retry[TID] = true;
+
+//             otherwise set CorrectUnphy = GAMER_FAILED if any cells fail
 //             --> use critical directive to avoid thread racing (may not be necessary here?)
-#              pragma omp critical
-               CorrectUnphy = GAMER_FAILED;
+               else
+               {
+#                 pragma omp critical
+                  CorrectUnphy = GAMER_FAILED;
+               }
 
 
 //             output the debug information (only if AutoReduceDt_Continue is false)
@@ -1275,6 +1326,32 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
    } // end of OpenMP parallel region
 
 
+// re-integrate the failed patch groups with smaller sub-cycle time-steps
+// --> set CorrectUnphy = GAMER_FAILED to fall back to the level-wide AUTO_REDUCE_DT if it still fails
+#  if ( !defined GPU  &&  !defined MHD  &&  FLU_SCHEME != RTVD )
+   if ( RetryLocal )
+   {
+      int  NRetry   = 0;
+      int *TID_List = new int [NPG];
+
+      for (int TID=0; TID<NPG; TID++)
+         if ( Retry[TID] )    TID_List[ NRetry ++ ] = TID;
+
+      if ( NRetry > 0 )
+      {
+         if (  RetryPatchGroup( lv, NRetry, TID_List, h_Flu_Array_F_In, h_Flu_Array_F_Out, h_DE_Array_F_Out, h_Flux_Array,
+                                h_Corner_Array_F, h_Pot_Array_USG_F, TimeOld, dt ) == GAMER_FAILED  )
+            CorrectUnphy = GAMER_FAILED;
+      }
+
+      delete [] TID_List;
+   }
+#  endif
+
+// "delete" applies to NULL as well
+   delete [] Retry;
+
+
 // operations when CorrectUnphysical() fails
    if ( CorrectUnphy == GAMER_FAILED )
    {
@@ -1295,6 +1372,240 @@ void CorrectUnphysical( const int lv, const int NPG, const int *PID0_List,
    }
 
 } // FUNCTION : CorrectUnphysical
+
+
+
+#if ( !defined GPU  &&  !defined MHD  &&  FLU_SCHEME != RTVD )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  RetryPatchGroup
+// Description :  Re-integrate the patch groups failed in CorrectUnphysical() with several sub-cycles of smaller
+//                time-steps (for AUTO_REDUCE_DT_LOCAL)
+//
+// Note        :  1. Invoked by CorrectUnphysical()
+//                   --> Other patch groups on the same level keep their results
+//                2. Restart from the saved input array h_Flu_Array_F_In[], which must NOT be modified by the
+//                   fluid solver (i.e., not applicable to RTVD)
+//                3. Each attempt reduces the sub-cycle time-step and MINMOD_COEFF by AUTO_REDUCE_DT_FACTOR and
+//                   AUTO_REDUCE_MINMOD_FACTOR, respectively, until either of them drops below AUTO_REDUCE_DT_FACTOR_MIN
+//                   or AUTO_REDUCE_MINMOD_MIN
+//                   --> Same criteria as the level-wide AUTO_REDUCE_DT in EvolveLevel()
+//                4. Ghost zones are fixed to the input data at TimeOld during all sub-cycles
+//                   --> Fluxes across the patch group boundaries are therefore not exactly the same as those
+//                       adopted by the sibling patch groups, similar to the correction by OPT__1ST_FLUX_CORR
+//                5. Fluxes are averaged over all sub-cycles with weights dt_sub/dt so that StoreFlux() and
+//                   CorrectFlux() can still multiply them by dt
+//                6. Invoke CPU_FluidSolver() directly and thus only support CPU
+//                   --> Reuse the CPU solver working arrays (e.g., h_PriVar[]), which is safe since the solver
+//                       of the next patch groups has finished when invoking Closing_Step()
+//                7. Not supported for MHD since the face-centered B field is shared with the sibling patch groups
+//
+// Parameter   :  lv                : Target refinement level
+//                NRetry            : Number of patch groups to be re-integrated
+//                TID_List          : Indices of the target patch groups in the input/output arrays
+//                h_Flu_Array_F_In  : Input fluid array
+//                h_Flu_Array_F_Out : Output fluid array
+//                h_DE_Array_F_Out  : Output dual-energy status array
+//                h_Flux_Array      : Output array storing the updated flux data
+//                h_Corner_Array_F  : Input corner coordinates of each patch group
+//                h_Pot_Array_USG_F : Input potential array for UNSPLIT_GRAVITY
+//                TimeOld           : Physical time before update
+//                dt                : Evolution time-step
+//
+// Return      :  GAMER_SUCCESS/GAMER_FAILED <--> all/not all target patch groups are recovered
+//                h_Flu_Array_F_Out[], h_DE_Array_F_Out[], h_Flux_Array[] of the recovered patch groups
+//-------------------------------------------------------------------------------------------------------
+int RetryPatchGroup( const int lv, const int NRetry, const int *TID_List,
+                     const real h_Flu_Array_F_In[][FLU_NIN][ CUBE(FLU_NXT) ],
+                     real h_Flu_Array_F_Out[][FLU_NOUT][ CUBE(PS2) ],
+                     char h_DE_Array_F_Out[][ CUBE(PS2) ],
+                     real h_Flux_Array[][9][NFLUX_TOTAL][ SQR(PS2) ],
+                     const double h_Corner_Array_F[][3],
+                     const real h_Pot_Array_USG_F[][ CUBE(USG_NXT_F) ],
+                     const double TimeOld, const real dt )
+{
+
+#  if ( FLU_NIN != FLU_NOUT )
+#     error : ERROR : FLU_NIN != FLU_NOUT !!
+#  endif
+
+   const real dh           = (real)amr->dh[lv];
+   const int  CheckMinEint = 1;
+   const bool StoreFlux    = ( OPT__FIXUP_FLUX  &&  h_Flux_Array != NULL );
+   const bool StoreDE      = ( h_DE_Array_F_Out != NULL );
+
+#  ifndef GRAVITY
+   const bool        OPT__SELF_GRAVITY = false;
+   const OptExtPot_t OPT__EXT_POT      = EXT_POT_NONE;
+   const OptExtAcc_t OPT__EXT_ACC      = EXT_ACC_NONE;
+#  endif
+#  ifndef DUAL_ENERGY
+   const double DUAL_ENERGY_SWITCH = NULL_REAL;
+#  endif
+#  ifdef GRAVITY
+#  ifdef COMOVING
+   const real JeansMinPres_Coeff = ( JEANS_MIN_PRES ) ?
+                                   TimeOld*NEWTON_G*SQR(JEANS_MIN_PRES_NCELL*amr->dh[JEANS_MIN_PRES_LEVEL])/(GAMMA*M_PI) : NULL_REAL;
+#  else
+   const real JeansMinPres_Coeff = ( JEANS_MIN_PRES ) ?
+                                           NEWTON_G*SQR(JEANS_MIN_PRES_NCELL*amr->dh[JEANS_MIN_PRES_LEVEL])/(GAMMA*M_PI) : NULL_REAL;
+#  endif
+#  else
+   const bool JEANS_MIN_PRES     = false;
+   const real JeansMinPres_Coeff = NULL_REAL;
+#  endif
+
+
+// 1. allocate the working arrays
+   real   (*Flu_In )[FLU_NIN ][ CUBE(FLU_NXT) ]       = new real [NRetry][FLU_NIN ][ CUBE(FLU_NXT) ];
+   real   (*Flu_Out)[FLU_NOUT][ CUBE(PS2) ]           = new real [NRetry][FLU_NOUT][ CUBE(PS2) ];
+   real   (*Flux   )[9][NFLUX_TOTAL][ SQR(PS2) ]      = ( StoreFlux ) ? new real [NRetry][9][NFLUX_TOTAL][ SQR(PS2) ] : NULL;
+   real   (*FluxAve)[9][NFLUX_TOTAL][ SQR(PS2) ]      = ( StoreFlux ) ? new real [NRetry][9][NFLUX_TOTAL][ SQR(PS2) ] : NULL;
+   char   (*DE_Out )[ CUBE(PS2) ]                     = ( StoreDE   ) ? new char [NRetry][ CUBE(PS2) ]                : NULL;
+   double (*Corner )[3]                               = ( h_Corner_Array_F  != NULL ) ? new double [NRetry][3]               : NULL;
+   real   (*Pot_USG)[ CUBE(USG_NXT_F) ]               = ( h_Pot_Array_USG_F != NULL ) ? new real   [NRetry][ CUBE(USG_NXT_F) ] : NULL;
+   int    *Remain                                     = new int  [NRetry];   // indices in TID_List[] not recovered yet
+   bool   *Failed                                     = new bool [NRetry];
+
+   int NRemain = NRetry;
+   for (int t=0; t<NRetry; t++)  Remain[t] = t;
+
+
+// 2. reduce the sub-cycle time-step until all patch groups are recovered or the minimum coefficients are reached
+   double DtCoeff     = 1.0;
+   double MinModCoeff = MINMOD_COEFF;
+
+   while ( NRemain > 0  &&  DtCoeff >= AUTO_REDUCE_DT_FACTOR_MIN  &&  MinModCoeff >= AUTO_REDUCE_MINMOD_MIN )
+   {
+      DtCoeff     *= AUTO_REDUCE_DT_FACTOR;
+      MinModCoeff *= AUTO_REDUCE_MINMOD_FACTOR;
+
+//    tolerance avoids an extra sub-cycle due to round-off errors (e.g., 1.0/0.1)
+      const int  NSub   = MAX(  1, (int)ceil( 1.0/DtCoeff - 1.0e-10 )  );
+      const real dt_Sub = dt / (real)NSub;
+      const real Weight = (real)1.0 / (real)NSub;
+
+
+//    2-1. initialize the working arrays of the remaining patch groups
+#     pragma omp parallel for schedule( static )
+      for (int t=0; t<NRemain; t++)
+      {
+         const int TID = TID_List[ Remain[t] ];
+
+         memcpy( Flu_In[t], h_Flu_Array_F_In[TID], sizeof(real)*FLU_NIN*CUBE(FLU_NXT) );
+
+         if ( Corner  != NULL )  memcpy( Corner[t], h_Corner_Array_F[TID], sizeof(double)*3 );
+         if ( Pot_USG != NULL )  memcpy( Pot_USG[t], h_Pot_Array_USG_F[TID], sizeof(real)*CUBE(USG_NXT_F) );
+
+         if ( StoreFlux )
+         for (int f=0; f<9; f++)
+         for (int v=0; v<NFLUX_TOTAL; v++)
+         for (int m=0; m<SQR(PS2); m++)
+            FluxAve[t][f][v][m] = (real)0.0;
+
+         Failed[t] = false;
+      }
+
+
+//    2-2. sub-cycles
+      bool AllFailed = false;
+
+      for (int s=0; s<NSub && !AllFailed; s++)
+      {
+//       update the interior of the input array with the results of the previous sub-cycle
+         if ( s > 0 )
+         {
+#           pragma omp parallel for schedule( static )
+            for (int t=0; t<NRemain; t++)
+            {
+               for (int v=0; v<FLU_NIN; v++)
+               for (int k=0; k<PS2; k++)
+               for (int j=0; j<PS2; j++)
+               {
+                  const int idx_in  = IDX321( FLU_GHOST_SIZE, j+FLU_GHOST_SIZE, k+FLU_GHOST_SIZE, FLU_NXT, FLU_NXT );
+                  const int idx_out = IDX321( 0, j, k, PS2, PS2 );
+
+                  memcpy( Flu_In[t][v]+idx_in, Flu_Out[t][v]+idx_out, sizeof(real)*PS2 );
+               }
+            }
+         }
+
+         CPU_FluidSolver( Flu_In, Flu_Out, NULL, NULL, DE_Out, Flux, NULL, Corner, Pot_USG, NULL, NULL, NULL,
+                          NRemain, dt_Sub, dh, StoreFlux, false, true,
+                          OPT__LR_LIMITER, MinModCoeff, MINMOD_MAX_ITER, NULL_REAL, NULL_REAL, false,
+                          TimeOld+s*dt_Sub, (OPT__SELF_GRAVITY || OPT__EXT_POT), OPT__EXT_ACC, MicroPhy,
+                          MIN_DENS, MIN_PRES, MIN_EINT, DUAL_ENERGY_SWITCH, PassiveFloorMask,
+                          OPT__NORMALIZE_PASSIVE, PassiveNorm_NVar, PassiveNorm_VarIdx,
+                          OPT__INT_FRAC_PASSIVE_LR, PassiveIntFrac_NVar, PassiveIntFrac_VarIdx,
+                          JEANS_MIN_PRES, JeansMinPres_Coeff, false );
+
+//       check unphysical results and accumulate the time-averaged fluxes
+#        pragma omp parallel for schedule( static )
+         for (int t=0; t<NRemain; t++)
+         {
+            real Out[NCOMP_TOTAL];
+
+            for (int idx=0; idx<CUBE(PS2)  &&  !Failed[t]; idx++)
+            {
+               for (int v=0; v<NCOMP_TOTAL; v++)   Out[v] = Flu_Out[t][v][idx];
+
+               if ( Unphysical(Out, CheckMinEint, NULL_REAL) )    Failed[t] = true;
+            }
+
+            if ( StoreFlux )
+            for (int f=0; f<9; f++)
+            for (int v=0; v<NFLUX_TOTAL; v++)
+            for (int m=0; m<SQR(PS2); m++)
+               FluxAve[t][f][v][m] += Weight*Flux[t][f][v][m];
+         }
+
+//       skip the remaining sub-cycles if all patch groups have failed
+         AllFailed = true;
+         for (int t=0; t<NRemain; t++)    AllFailed &= Failed[t];
+      } // for (int s=0; s<NSub && !AllFailed; s++)
+
+
+//    2-3. store the recovered patch groups and collect the remaining ones
+      int NRemain_New = 0;
+
+      for (int t=0; t<NRemain; t++)
+      {
+         const int TID = TID_List[ Remain[t] ];
+
+         if ( Failed[t] )
+         {
+            Remain[ NRemain_New ++ ] = Remain[t];
+            continue;
+         }
+
+         memcpy( h_Flu_Array_F_Out[TID], Flu_Out[t], sizeof(real)*FLU_NOUT*CUBE(PS2) );
+
+         if ( StoreFlux )  memcpy( h_Flux_Array[TID], FluxAve[t], sizeof(real)*9*NFLUX_TOTAL*SQR(PS2) );
+         if ( StoreDE   )  memcpy( h_DE_Array_F_Out[TID], DE_Out[t], sizeof(char)*CUBE(PS2) );
+      }
+
+      NRemain = NRemain_New;
+
+      if ( OPT__VERBOSE )
+         Aux_Message( stdout, "   AUTO_REDUCE_DT_LOCAL: Rank %d, Lv %d, %d sub-cycles, %d/%d patch group(s) recovered\n",
+                      MPI_Rank, lv, NSub, NRetry-NRemain, NRetry );
+   } // while ( NRemain > 0  &&  ... )
+
+
+// 3. free memory
+   delete [] Flu_In;
+   delete [] Flu_Out;
+   delete [] Flux;
+   delete [] FluxAve;
+   delete [] DE_Out;
+   delete [] Corner;
+   delete [] Pot_USG;
+   delete [] Remain;
+   delete [] Failed;
+
+   return ( NRemain == 0 ) ? GAMER_SUCCESS : GAMER_FAILED;
+
+} // FUNCTION : RetryPatchGroup
+#endif // #if ( !defined GPU  &&  !defined MHD  &&  FLU_SCHEME != RTVD )
 #endif // #ifndef SRHD
 
 
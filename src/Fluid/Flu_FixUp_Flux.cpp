@@ -11,6 +11,7 @@
 // Note        :  1. Boundary fluxes from the neighboring ranks must be received in advance by invoking
 //                   Buf_GetBufferData()
 //                2. Invoked by EvolveLevel()
+//                3. Only loop over the real patches recorded in the flux register amr->FluxReg[lv]
 //
 // Parameter   :  lv   : Target coarse level
 //                TVar : Target variables
@@ -33,6 +34,7 @@ void Flu_FixUp_Flux( const int lv, const long TVar )
 #  endif
    const int  Offset[6]       = { 0, PS1-1, 0, (PS1-1)*PS1, 0, (PS1-1)*SQR(PS1) }; // x=0/PS1-1, y=0/PS1-1, z=0/PS1-1 faces
    const int  didx[3][2]      = { PS1, SQR(PS1), 1, SQR(PS1), 1, PS1 };
+   const FluxReg_t *FluxReg   = &amr->FluxReg[lv];
 
 //###EXPERIMENTAL: (does not work well and thus has been disabled for now)
 /*
@@ -90,26 +92,25 @@ void Flu_FixUp_Flux( const int lv, const long TVar )
 #  endif // #ifdef GAMER_DEBUG
 
 
-#  pragma omp parallel for schedule( runtime )
-   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+// 1. sum up the coarse-grid and fine-grid fluxes of all real patches for bitwise reproducibility
+#  ifdef BIT_REP_FLUX
+   if ( FluxReg->NFaceReal > 0 )
    {
-//    1. sum up the coarse-grid and fine-grid fluxes for bitwise reproducibility
-#     ifdef BIT_REP_FLUX
-      for (int s=0; s<6; s++)
-      {
-         real (*FluxPtr)[PS1][PS1] = amr->patch[0][lv][PID]->flux[s];
+      const long  NData    = (long)FluxReg->NFaceReal*NFLUX_TOTAL*SQR(PS1);
+            real *Flux1D   = FluxReg->Flux       [0][0][0];
+      const real *BitRep1D = FluxReg->Flux_BitRep[0][0][0];
 
-         if ( FluxPtr != NULL )
-         {
-            for (int v=0; v<NFLUX_TOTAL; v++)
-            for (int m=0; m<PS1; m++)
-            for (int n=0; n<PS1; n++)
-               FluxPtr[v][m][n] += amr->patch[0][lv][PID]->flux_bitrep[s][v][m][n];
-         }
-      }
-#     endif
+#     pragma omp parallel for schedule( static )
+      for (long t=0; t<NData; t++)  Flux1D[t] += BitRep1D[t];
+   }
+#  endif
 
 
+#  pragma omp parallel for schedule( runtime )
+   for (int t=0; t<FluxReg->NPatchReal; t++)
+   {
+      const int PID = FluxReg->PIDReal[t];
+
 //    2. correct fluid variables by the difference between the coarse-grid and fine-grid fluxes
 //    loop over all six faces of a given patch
       for (int s=0; s<6; s++)
@@ -371,36 +372,15 @@ void Flu_FixUp_Flux( const int lv, const long TVar )
             } // for (int n=0; n<PS1; n++}
          } // for (int m=0; m<PS1; m++}
       } // for (int s=0; s<6; s++)
-   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   } // for (int t=0; t<FluxReg->NPatchReal; t++)
 
 
 // 3. reset all flux arrays (in both real and buffer patches) to zero for bitwise reproducibility
 #  ifdef BIT_REP_FLUX
-#  pragma omp parallel for schedule( runtime )
-   for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
+   if ( FluxReg->NFace > 0 )
    {
-      for (int s=0; s<6; s++)
-      {
-         real (*FluxPtr)[PS1][PS1] = NULL;
-
-         FluxPtr = amr->patch[0][lv][PID]->flux[s];
-         if ( FluxPtr != NULL )
-         {
-            for (int v=0; v<NFLUX_TOTAL; v++)
-            for (int m=0; m<PS1; m++)
-            for (int n=0; n<PS1; n++)
-               FluxPtr[v][m][n] = (real)0.0;
-         }
-
-         FluxPtr = amr->patch[0][lv][PID]->flux_bitrep[s];
-         if ( FluxPtr != NULL )
-         {
-            for (int v=0; v<NFLUX_TOTAL; v++)
-            for (int m=0; m<PS1; m++)
-            for (int n=0; n<PS1; n++)
-               FluxPtr[v][m][n] = (real)0.0;
-         }
-      }
+      memset( FluxReg->Flux,        0, (long)FluxReg->NFace*NFLUX_TOTAL*SQR(PS1)*sizeof(real) );
+      memset( FluxReg->Flux_BitRep, 0, (long)FluxReg->NFace*NFLUX_TOTAL*SQR(PS1)*sizeof(real) );
    }
 #  endif // #ifdef BIT_REP_FLUX
 
@@ -35,31 +35,26 @@ void Flu_SwapFixUpTempArray( const int lv )
 
 
 // swap pointers
-#  pragma omp parallel for schedule( runtime )
-   for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
-   {
-      if ( OPT__FIXUP_FLUX )
-      for (int s=0; s<6; s++)
-      {
-         if ( amr->patch[0][lv][PID]->flux_tmp[s] != NULL )
-         {
-            Aux_SwapPointer( (void**)&amr->patch[0][lv][PID]->flux    [s],
-                             (void**)&amr->patch[0][lv][PID]->flux_tmp[s] );
-         }
-      }
+// --> flux[] and flux_tmp[] are swapped together with the flux register
+   if ( OPT__FIXUP_FLUX )  amr->FluxReg[lv].SwapTmp( amr->patch[0][lv] );
 
-#     ifdef MHD
-      if ( OPT__FIXUP_ELECTRIC )
-      for (int s=0; s<18; s++)
+#  ifdef MHD
+   if ( OPT__FIXUP_ELECTRIC )
+   {
+#     pragma omp parallel for schedule( runtime )
+      for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
       {
-         if ( amr->patch[0][lv][PID]->electric_tmp[s] != NULL )
+         for (int s=0; s<18; s++)
          {
-            Aux_SwapPointer( (void**)&amr->patch[0][lv][PID]->electric    [s],
-                             (void**)&amr->patch[0][lv][PID]->electric_tmp[s] );
+            if ( amr->patch[0][lv][PID]->electric_tmp[s] != NULL )
+            {
+               Aux_SwapPointer( (void**)&amr->patch[0][lv][PID]->electric    [s],
+                                (void**)&amr->patch[0][lv][PID]->electric_tmp[s] );
+            }
          }
-      }
-#     endif
-   } // for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
+      } // for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
+   } // if ( OPT__FIXUP_ELECTRIC )
+#  endif // #ifdef MHD
 
 } // FUNCTION : Flu_SwapFixUpTempArray
 
@@ -93,27 +88,28 @@ void Flu_InitFixUpTempArray( const int lv )
 
 
 // copy data
-#  pragma omp parallel for schedule( runtime )
-   for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
-   {
-      if ( OPT__FIXUP_FLUX )
-      for (int s=0; s<6; s++)
-      {
-         if ( amr->patch[0][lv][PID]->flux_tmp[s] != NULL )
-            memcpy( amr->patch[0][lv][PID]->flux_tmp[s], amr->patch[0][lv][PID]->flux[s], SQR(PS1)*NFLUX_TOTAL*sizeof(real) );
-      }
+// --> flux[] of all faces are stored contiguously in the flux register
+   const FluxReg_t *FluxReg = &amr->FluxReg[lv];
 
-#     ifdef MHD
-      if ( OPT__FIXUP_ELECTRIC )
-      for (int s=0; s<18; s++)
+   if ( OPT__FIXUP_FLUX  &&  FluxReg->Flux_Tmp != NULL  &&  FluxReg->NFace > 0 )
+      memcpy( FluxReg->Flux_Tmp, FluxReg->Flux, (long)FluxReg->NFace*NFLUX_TOTAL*SQR(PS1)*sizeof(real) );
+
+#  ifdef MHD
+   if ( OPT__FIXUP_ELECTRIC )
+   {
+#     pragma omp parallel for schedule( runtime )
+      for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
       {
-         if ( amr->patch[0][lv][PID]->electric_tmp[s] != NULL )
+         for (int s=0; s<18; s++)
          {
-            const int Size = ( s < 6 ) ? NCOMP_ELE*PS1M1*PS1*sizeof(real) : PS1*sizeof(real);
-            memcpy( amr->patch[0][lv][PID]->electric_tmp[s], amr->patch[0][lv][PID]->electric[s], Size );
+            if ( amr->patch[0][lv][PID]->electric_tmp[s] != NULL )
+            {
+               const int Size = ( s < 6 ) ? NCOMP_ELE*PS1M1*PS1*sizeof(real) : PS1*sizeof(real);
+               memcpy( amr->patch[0][lv][PID]->electric_tmp[s], amr->patch[0][lv][PID]->electric[s], Size );
+            }
          }
-      }
-#     endif
-   } // for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
+      } // for (int PID=0; PID<amr->NPatchComma[lv][27]; PID++)
+   } // if ( OPT__FIXUP_ELECTRIC )
+#  endif // #ifdef MHD
 
 } // FUNCTION : Flu_InitFixUpTempArray
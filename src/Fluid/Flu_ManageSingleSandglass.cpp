@@ -0,0 +1,371 @@
+#include "GAMER.h"
+
+
+// memory pool of the fluid and magnetic field arrays released by OPT__SINGLE_SANDGLASS
+typedef real (*FluArray_t)[PS1][PS1][PS1];
+#ifdef MHD
+typedef real (*MagArray_t)[ PS1P1*SQR(PS1) ];
+#endif
+
+static FluArray_t *FluPool       = NULL;   // stack of the released fluid arrays
+static int         FluPool_N     = 0;      // number of arrays in FluPool[]
+static int         FluPool_Cap   = 0;      // capacity of FluPool[]
+#ifdef MHD
+static MagArray_t *MagPool       = NULL;
+static int         MagPool_N     = 0;
+static int         MagPool_Cap   = 0;
+#endif
+
+// progressive release of the old sandglass on the current level
+static bool        Release       = false;  // whether the old sandglass is released on the current level
+static int        *ReleaseList   = NULL;   // patch group indices sorted by their last preparation batch
+static int        *ReleaseBatch  = NULL;   // last preparation batch of each entry in ReleaseList[]
+static int         ReleaseN      = 0;      // number of entries in ReleaseList[]
+static int         ReleaseCursor = 0;      // number of patch groups already released
+static int         InFlight      = 0;      // net number of fluid arrays taken from the pool on the current level
+static int         InFlightMax   = 0;      // maximum InFlight on the current level --> pool size kept for the next update
+
+static void PushFluArray( FluArray_t Array );
+static FluArray_t PopFluArray( const int lv, const int Sg );
+#ifdef MHD
+static void PushMagArray( MagArray_t Array );
+static MagArray_t PopMagArray( const int lv, const int Sg );
+#endif
+template <typename T> static void DeleteArray( T Array );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_InitSingleSandglass
+// Description :  Prepare the progressive release of the old fluid sandglass for the option OPT__SINGLE_SANDGLASS
+//
+// Note        :  1. Invoked by InvokeSolver() before advancing the fluid solver
+//                2. Old data are released only when they are no longer needed after the fluid solver, which
+//                   requires that
+//                   (1) lv is the finest level (otherwise level lv+1 interpolates the data of level lv in time)
+//                   (2) AUTO_REDUCE_DT is off (otherwise the entire level may be re-advanced)
+//                   (3) UNSPLIT_GRAVITY is off (otherwise the gravity solver requires the old data)
+//                   (4) OverlapMPI is off (otherwise the patch groups are updated by two separate calls)
+//                3. The old data of a patch group can be released once all patch groups adopting it as ghost
+//                   zones have been prepared
+//                   --> Record the last preparation batch of each patch group by checking the 26 siblings of
+//                       all its patches
+//                   --> Assuming FLU_GHOST_SIZE <= PATCH_SIZE
+//                4. Must be followed by Flu_EndSingleSandglass()
+//
+// Parameter   :  lv         : Target refinement level
+//                NTotal     : Total number of patch groups to be updated
+//                PID0_List  : List recording the patch indices with LocalID==0 to be updated
+//                NPG_Max    : Maximum number of patch groups to be prepared at a time
+//                OverlapMPI : Overlap MPI time with CPU/GPU computation
+//-------------------------------------------------------------------------------------------------------
+void Flu_InitSingleSandglass( const int lv, const int NTotal, const int *PID0_List, const int NPG_Max,
+                              const bool OverlapMPI )
+{
+
+// 1. check whether the old data can be released on this level
+#  if ( defined GRAVITY  &&  defined UNSPLIT_GRAVITY )
+   const bool UnsplitGravity = true;
+#  else
+   const bool UnsplitGravity = false;
+#  endif
+
+   Release       = (  !AUTO_REDUCE_DT  &&  !UnsplitGravity  &&  !OverlapMPI  &&
+                      ( lv == TOP_LEVEL || NPatchTotal[lv+1] == 0 )  );
+   ReleaseN      = 0;
+   ReleaseCursor = 0;
+   InFlight      = 0;
+   InFlightMax   = 0;
+
+   if ( !Release  ||  NTotal == 0 )  return;
+
+
+// 2. record the last preparation batch of each patch group
+//    --> the patch group index is PID/8 since PID0_List[t] = 8*t when OverlapMPI is off
+   const int NReal     = amr->NPatchComma[lv][1];
+   const int NBatch    = ( NTotal + NPG_Max - 1 ) / NPG_Max;
+   int      *LastBatch = new int [NTotal];
+
+   for (int t=0; t<NTotal; t++)  LastBatch[t] = t / NPG_Max;
+
+   for (int t=0; t<NTotal; t++)
+   {
+      const int Batch = t / NPG_Max;
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const int PID = PID0_List[t] + LocalID;
+
+         for (int s=0; s<26; s++)
+         {
+            const int SibPID = amr->patch[0][lv][PID]->sibling[s];
+
+            if ( SibPID >= 0  &&  SibPID < NReal )
+               LastBatch[ SibPID/8 ] = MAX( LastBatch[ SibPID/8 ], Batch );
+         }
+      }
+   }
+
+
+// 3. sort the patch groups by their last preparation batch (counting sort)
+   int *Count = new int [NBatch+1];
+
+   for (int b=0; b<=NBatch; b++)    Count[b] = 0;
+   for (int t=0; t<NTotal; t++)     Count[ LastBatch[t]+1 ] ++;
+   for (int b=0; b<NBatch; b++)     Count[b+1] += Count[b];
+
+   ReleaseList  = new int [NTotal];
+   ReleaseBatch = new int [NTotal];
+
+   for (int t=0; t<NTotal; t++)
+   {
+      const int Idx = Count[ LastBatch[t] ] ++;
+
+      ReleaseList [Idx] = t;
+      ReleaseBatch[Idx] = LastBatch[t];
+   }
+
+   ReleaseN = NTotal;
+
+   delete [] Count;
+   delete [] LastBatch;
+
+} // FUNCTION : Flu_InitSingleSandglass
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_UpdateSingleSandglass
+// Description :  Release the old fluid data no longer required and allocate the arrays to store the updated
+//                data for the option OPT__SINGLE_SANDGLASS
+//
+// Note        :  1. Invoked by InvokeSolver() before each closing step of the fluid solver
+//                2. Release the old data of all patch groups whose last preparation batch < NPrepBatch
+//                   --> Only when Flu_InitSingleSandglass() allows releasing the old data on this level
+//                3. Allocate the fluid (and magnetic) arrays of SaveSg_Flu (and SaveSg_Mag) for all target
+//                   patches whose arrays have been released previously
+//                   --> Always performed since the released arrays may belong to any level after regridding
+//                   --> Reuse the arrays in the memory pool first
+//
+// Parameter   :  lv         : Target refinement level
+//                SaveSg_Flu : Sandglass to store the updated fluid data
+//                SaveSg_Mag : Sandglass to store the updated B field
+//                NPrepBatch : Number of preparation batches already completed
+//                NPG        : Number of patch groups to be closed
+//                PID0_List  : List recording the patch indices with LocalID==0 to be closed
+//-------------------------------------------------------------------------------------------------------
+void Flu_UpdateSingleSandglass( const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int NPrepBatch,
+                                const int NPG, const int *PID0_List )
+{
+
+// 1. release the old data no longer required
+   if ( Release )
+   {
+      while ( ReleaseCursor < ReleaseN  &&  ReleaseBatch[ReleaseCursor] < NPrepBatch )
+      {
+         const int PID0 = 8*ReleaseList[ ReleaseCursor ++ ];
+
+         for (int PID=PID0; PID<PID0+8; PID++)
+         {
+            patch_t *OldPatch = amr->patch[ 1-SaveSg_Flu ][lv][PID];
+
+            if ( OldPatch->fluid != NULL )
+            {
+               PushFluArray( OldPatch->fluid );
+               OldPatch->fluid = NULL;
+               InFlight --;
+            }
+
+#           ifdef MHD
+            patch_t *OldPatch_Mag = amr->patch[ 1-SaveSg_Mag ][lv][PID];
+
+            if ( OldPatch_Mag->magnetic != NULL )
+            {
+               PushMagArray( OldPatch_Mag->magnetic );
+               OldPatch_Mag->magnetic = NULL;
+            }
+#           endif
+         }
+      }
+   } // if ( Release )
+
+
+// 2. allocate the arrays to store the updated data
+   for (int TID=0; TID<NPG; TID++)
+   for (int PID=PID0_List[TID]; PID<PID0_List[TID]+8; PID++)
+   {
+      if ( amr->patch[SaveSg_Flu][lv][PID]->fluid == NULL )
+      {
+         amr->patch[SaveSg_Flu][lv][PID]->fluid = PopFluArray( lv, SaveSg_Flu );
+         InFlight ++;
+      }
+
+#     ifdef MHD
+      if ( amr->patch[SaveSg_Mag][lv][PID]->magnetic == NULL )
+         amr->patch[SaveSg_Mag][lv][PID]->magnetic = PopMagArray( lv, SaveSg_Mag );
+#     endif
+   }
+
+   InFlightMax = MAX( InFlightMax, InFlight );
+
+} // FUNCTION : Flu_UpdateSingleSandglass
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_EndSingleSandglass
+// Description :  Finalize the progressive release of the old fluid sandglass for the option OPT__SINGLE_SANDGLASS
+//
+// Note        :  1. Invoked by InvokeSolver() after the last closing step of the fluid solver
+//                2. Release the old data of all remaining patch groups and reset FluSgTime (and MagSgTime) of
+//                   the old sandglass to an arbitrary negative number to indicate that they are no longer available
+//                3. Shrink the memory pool to the maximum number of arrays required by a single level update
+//
+// Parameter   :  lv         : Target refinement level
+//                SaveSg_Flu : Sandglass storing the updated fluid data
+//                SaveSg_Mag : Sandglass storing the updated B field
+//-------------------------------------------------------------------------------------------------------
+void Flu_EndSingleSandglass( const int lv, const int SaveSg_Flu, const int SaveSg_Mag )
+{
+
+   if ( Release )
+   {
+//    1. release all remaining patch groups
+      Flu_UpdateSingleSandglass( lv, SaveSg_Flu, SaveSg_Mag, __INT_MAX__, 0, NULL );
+
+      amr->FluSgTime[lv][ 1-SaveSg_Flu ] = -__FLT_MAX__;
+#     ifdef MHD
+      amr->MagSgTime[lv][ 1-SaveSg_Mag ] = -__FLT_MAX__;
+#     endif
+
+      delete [] ReleaseList;    ReleaseList  = NULL;
+      delete [] ReleaseBatch;   ReleaseBatch = NULL;
+      ReleaseN = 0;
+      Release  = false;
+   }
+
+
+// 2. shrink the memory pool
+   while ( FluPool_N > InFlightMax )   DeleteArray( FluPool[ -- FluPool_N ] );
+#  ifdef MHD
+   while ( MagPool_N > InFlightMax )   DeleteArray( MagPool[ -- MagPool_N ] );
+#  endif
+
+} // FUNCTION : Flu_EndSingleSandglass
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Flu_FreeSingleSandglassPool
+// Description :  Free the memory pool of the option OPT__SINGLE_SANDGLASS
+//
+// Note        :  1. Invoked by End_MemFree()
+//-------------------------------------------------------------------------------------------------------
+void Flu_FreeSingleSandglassPool()
+{
+
+   while ( FluPool_N > 0 )    DeleteArray( FluPool[ -- FluPool_N ] );
+   delete [] FluPool;   FluPool = NULL;   FluPool_Cap = 0;
+
+#  ifdef MHD
+   while ( MagPool_N > 0 )    DeleteArray( MagPool[ -- MagPool_N ] );
+   delete [] MagPool;   MagPool = NULL;   MagPool_Cap = 0;
+#  endif
+
+} // FUNCTION : Flu_FreeSingleSandglassPool
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PushFluArray / PopFluArray
+// Description :  Push/pop a fluid array into/from the memory pool
+//
+// Note        :  1. PopFluArray() allocates a new array if the pool is empty
+//                   --> From the slab blocks of the target level and sandglass when OPT__PATCH_SLAB is on
+//-------------------------------------------------------------------------------------------------------
+void PushFluArray( FluArray_t Array )
+{
+
+   if ( FluPool_N == FluPool_Cap )
+   {
+      FluPool_Cap = MAX( 2*FluPool_Cap, 64 );
+
+      FluArray_t *NewPool = new FluArray_t [FluPool_Cap];
+      for (int t=0; t<FluPool_N; t++)  NewPool[t] = FluPool[t];
+
+      delete [] FluPool;
+      FluPool = NewPool;
+   }
+
+   FluPool[ FluPool_N ++ ] = Array;
+
+} // FUNCTION : PushFluArray
+
+FluArray_t PopFluArray( const int lv, const int Sg )
+{
+
+   if ( FluPool_N > 0 )    return FluPool[ -- FluPool_N ];
+
+   FluArray_t Array = (FluArray_t)Mis_PatchSlab_New( SLAB_FLU, lv, Sg );
+
+   return ( Array != NULL ) ? Array : new real [NCOMP_TOTAL][PS1][PS1][PS1];
+
+} // FUNCTION : PopFluArray
+
+
+
+#ifdef MHD
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PushMagArray / PopMagArray
+// Description :  Push/pop a magnetic field array into/from the memory pool
+//
+// Note        :  1. PopMagArray() allocates a new array if the pool is empty
+//                   --> From the slab blocks of the target level and sandglass when OPT__PATCH_SLAB is on
+//-------------------------------------------------------------------------------------------------------
+void PushMagArray( MagArray_t Array )
+{
+
+   if ( MagPool_N == MagPool_Cap )
+   {
+      MagPool_Cap = MAX( 2*MagPool_Cap, 64 );
+
+      MagArray_t *NewPool = new MagArray_t [MagPool_Cap];
+      for (int t=0; t<MagPool_N; t++)  NewPool[t] = MagPool[t];
+
+      delete [] MagPool;
+      MagPool = NewPool;
+   }
+
+   MagPool[ MagPool_N ++ ] = Array;
+
+} // FUNCTION : PushMagArray
+
+MagArray_t PopMagArray( const int lv, const int Sg )
+{
+
+   if ( MagPool_N > 0 )    return MagPool[ -- MagPool_N ];
+
+   MagArray_t Array = (MagArray_t)Mis_PatchSlab_New( SLAB_MAG, lv, Sg );
+
+   return ( Array != NULL ) ? Array : new real [NCOMP_MAG][ PS1P1*SQR(PS1) ];
+
+} // FUNCTION : PopMagArray
+#endif // #ifdef MHD
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  DeleteArray
+// Description :  Free an array of the memory pool
+//
+// Note        :  1. Return it to the slab blocks if it was allocated by Mis_PatchSlab_New()
+//-------------------------------------------------------------------------------------------------------
+template <typename T>
+void DeleteArray( T Array )
+{
+
+   if (  ! Mis_PatchSlab_Delete( Array )  )  delete [] Array;
+
+} // FUNCTION : DeleteArray
+
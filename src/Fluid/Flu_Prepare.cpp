@@ -124,32 +124,39 @@ void Flu_Prepare( const int lv, const double PrepTime,
 
 
 // prepare boolean array that indicates whether patch group is fully refined (in other words has 8*8=64 children)
+// --> for the fluid levels of the hybrid scheme, it is copied from the cache together with h_HasWaveCounterpart below
 #  if ( MODEL == ELBDM )
-#  pragma omp parallel for schedule( runtime )
-   for (int TID=0; TID<NPG; TID++)
+#  if ( ELBDM_SCHEME == ELBDM_HYBRID )
+   if ( amr->use_wave_flag[lv] )
+#  endif
    {
-      bool PGIsCompletelyRefined = true;
-
-      const int PID0 = PID0_List[TID];
-      for (int LocalID=0; LocalID<8; LocalID++)
+#     pragma omp parallel for schedule( runtime )
+      for (int TID=0; TID<NPG; TID++)
       {
-         const int PID = PID0 + LocalID;
-         if ( amr->patch[0][lv][PID]->son == -1 )
+         bool PGIsCompletelyRefined = true;
+
+         const int PID0 = PID0_List[TID];
+         for (int LocalID=0; LocalID<8; LocalID++)
          {
-            PGIsCompletelyRefined = false;
-            break;
+            const int PID = PID0 + LocalID;
+            if ( amr->patch[0][lv][PID]->son == -1 )
+            {
+               PGIsCompletelyRefined = false;
+               break;
+            }
          }
-      }
 
-      h_IsCompletelyRefined[TID] = PGIsCompletelyRefined;
+         h_IsCompletelyRefined[TID] = PGIsCompletelyRefined;
+      }
    }
 #  endif
 
 
 // prepare h_HasWaveCounterpart with information which cells have wave counterparts
+// --> copy the bitmasks cached after the last reconstruction of the global tree to avoid traversing the tree for each cell
 #  if ( ELBDM_SCHEME == ELBDM_HYBRID )
    if ( !amr->use_wave_flag[lv] )
-      Prepare_PatchData_HasWaveCounterpart( lv, h_HasWaveCounterpart, HYB_GHOST_SIZE, NPG, PID0_List, NSIDE_26, GlobalTree );
+      ELBDM_PrepareWaveCounterpart( lv, h_IsCompletelyRefined, h_HasWaveCounterpart, NPG, PID0_List, GlobalTree );
 #  endif
 
 
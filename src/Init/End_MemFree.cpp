@@ -3,6 +3,7 @@
 #ifdef LOAD_BALANCE
 void LB_GetBufferData_MemFree();
 #endif
+void Flu_FreeSingleSandglassPool();
 
 
 
@@ -59,6 +60,10 @@ void End_MemFree()
    if ( GRACKLE_ACTIVATE )    End_MemFree_Grackle();
 #  endif
 
+#  ifdef CR_DIFFUSION
+   if ( CR_DIFF_RKL2 )        End_MemFree_CR_Diff();
+#  endif
+
 
 // 4. dump table
    delete [] DumpTable;    DumpTable = NULL;
@@ -93,6 +98,21 @@ void End_MemFree()
    delete GlobalTree;   GlobalTree = NULL;
 
 
+// 11. memory pool for OPT__SINGLE_SANDGLASS
+   Flu_FreeSingleSandglassPool();
+
+
+// 12. slab blocks for OPT__PATCH_SLAB
+// --> must be done after freeing all patches and the memory pool of OPT__SINGLE_SANDGLASS
+   Mis_PatchSlab_Free();
+
+
+// 13. cache of the wave-counterpart bitmasks for ELBDM_HYBRID
+#  if ( ELBDM_SCHEME == ELBDM_HYBRID )
+   ELBDM_FreeWaveCounterpartCache();
+#  endif
+
+
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
 } // FUNCTION : End_MemFree
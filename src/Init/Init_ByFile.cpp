@@ -1,4 +1,7 @@
 #include "GAMER.h"
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 
 // declare as static so that other functions cannot invoke it directly and must use the function pointer
 static void Init_ByFile_Default( real fluid_out[], const real fluid_in[], const int nvar_in,
@@ -13,6 +16,8 @@ void (*Init_ByFile_User_Ptr)( real fluid_out[], const real fluid_in[], const int
 static void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const int UM_lv0, const int UM_NVar,
                                     const int UM_LoadNRank, const UM_IC_Format_t UM_Format, const long UM_Size3D[][3],
                                     const int FlagPatch[][6] );
+static void Init_ByFile_AssignData_MMap( const char UM_Filename[], const int UM_lv, const int UM_lv0, const int UM_NVar,
+                                         const UM_IC_Format_t UM_Format, const long UM_Size3D[][3], const int FlagPatch[][6] );
 static void Load_RefineRegion( const char Filename[] );
 static void Flag_RefineRegion( const int lv, const int FlagPatch[6] );
 
@@ -56,7 +61,12 @@ static void Flag_RefineRegion( const int lv, const int FlagPatch[6] );
 //                4. The data format of the UM_IC file is controlled by the runtime parameter OPT__UM_IC_FORMAT
 //                5. Does not work with rectangular domain decomposition anymore
 //                   --> Must enable either SERIAL or LOAD_BALANCE
-//                6. OpenMP is not supported yet
+//                6. Two loaders are supported
+//                   --> OPT__UM_IC_MMAP=0: OPT__UM_IC_LOAD_NRANK ranks load data at a time by fread()
+//                       --> OpenMP is not supported
+//                   --> OPT__UM_IC_MMAP=1: all ranks memory-map the z slabs overlapping their patches concurrently
+//                       and fill patches with OpenMP (unless OPT__INIT_GRID_WITH_OMP is disabled)
+//                       --> Init_ByFile_User_Ptr() must be thread-safe in this case
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -280,8 +290,12 @@ void Init_ByFile()
 // 4. assign data on level OPT__UM_IC_LEVEL by the input file UM_IC
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Assigning data on level %d ...\n", OPT__UM_IC_LEVEL );
 
-   Init_ByFile_AssignData( UM_Filename, OPT__UM_IC_LEVEL, OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK,
-                           OPT__UM_IC_FORMAT, UM_Size3D, FlagPatch );
+   if ( OPT__UM_IC_MMAP )
+      Init_ByFile_AssignData_MMap( UM_Filename, OPT__UM_IC_LEVEL, OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR,
+                                   OPT__UM_IC_FORMAT, UM_Size3D, FlagPatch );
+   else
+      Init_ByFile_AssignData( UM_Filename, OPT__UM_IC_LEVEL, OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK,
+                              OPT__UM_IC_FORMAT, UM_Size3D, FlagPatch );
 
    if ( OPT__RESET_FLUID_INIT )
       Flu_ResetByUser_API_Ptr( OPT__UM_IC_LEVEL, amr->FluSg[OPT__UM_IC_LEVEL], amr->MagSg[OPT__UM_IC_LEVEL],
@@ -332,8 +346,12 @@ void Init_ByFile()
 #     endif
 
 //    assign data on SonLv
-      Init_ByFile_AssignData( UM_Filename, SonLv, OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK,
-                              OPT__UM_IC_FORMAT, UM_Size3D, FlagPatch );
+      if ( OPT__UM_IC_MMAP )
+         Init_ByFile_AssignData_MMap( UM_Filename, SonLv, OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR,
+                                      OPT__UM_IC_FORMAT, UM_Size3D, FlagPatch );
+      else
+         Init_ByFile_AssignData( UM_Filename, SonLv, OPT__UM_IC_LEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK,
+                                 OPT__UM_IC_FORMAT, UM_Size3D, FlagPatch );
 
       if ( OPT__RESET_FLUID_INIT )
          Flu_ResetByUser_API_Ptr( SonLv, amr->FluSg[SonLv], amr->MagSg[SonLv], Time[SonLv], 0.0 );
@@ -623,6 +641,183 @@ void Init_ByFile_AssignData( const char UM_Filename[], const int UM_lv, const in
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_ByFile_AssignData_MMap
+// Description :  Same as Init_ByFile_AssignData() except that all ranks memory-map the input file concurrently
+//                and fill patches with OpenMP
+//
+// Note        :  1. Invoked by Init_ByFile() when OPT__UM_IC_MMAP is on
+//                2. Each rank only maps the z slabs overlapping its own patch groups on level "UM_lv"
+//                   --> One mapping per variable for UM_IC_FORMAT_VZYX and a single mapping for UM_IC_FORMAT_ZYXV
+//                   --> Pages are read from the disk on first access, so the x-y regions outside the
+//                       patches of this rank are typically never touched
+//                3. Single/double-precision input data are converted to "real" on the fly
+//                4. Init_ByFile_User_Ptr() is invoked by multiple OpenMP threads unless OPT__INIT_GRID_WITH_OMP
+//                   is disabled
+//
+// Parameter   :  See Init_ByFile_AssignData()
+//
+// Return      :  amr->patch->fluid
+//-------------------------------------------------------------------------------------------------------
+void Init_ByFile_AssignData_MMap( const char UM_Filename[], const int UM_lv, const int UM_lv0, const int UM_NVar,
+                                  const UM_IC_Format_t UM_Format, const long UM_Size3D[][3], const int FlagPatch[][6] )
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "      Mapping data from the input file on level %d ...\n", UM_lv );
+
+
+// check
+   if ( Init_ByFile_User_Ptr == NULL )  Aux_Error( ERROR_INFO, "Init_ByFile_User_Ptr == NULL !!\n" );
+
+
+   const int    dlv         = UM_lv - UM_lv0;
+   const long   UM_Size1v   = UM_Size3D[dlv][0]*UM_Size3D[dlv][1]*UM_Size3D[dlv][2];
+   const int    NVarPerLoad = ( UM_Format == UM_IC_FORMAT_ZYXV ) ? UM_NVar : 1;
+   const int    NMap        = UM_NVar / NVarPerLoad;
+   const long   DataSize    = ( OPT__UM_IC_FLOAT8 ) ? sizeof(double) : sizeof(float);
+   const long   SliceSize   = (long)NVarPerLoad*UM_Size3D[dlv][0]*UM_Size3D[dlv][1]*DataSize;
+   const long   PageSize    = sysconf( _SC_PAGESIZE );
+   const int    NPG         = amr->NPatchComma[UM_lv][1] / 8;
+   const int    scale       = amr->scale[UM_lv];
+   const double dh          = amr->dh[UM_lv];
+#  ifdef OPENMP
+   const int    OMP_NT      = ( OPT__INIT_GRID_WITH_OMP ) ? OMP_NTHREAD : 1;
+#  else
+   const int    OMP_NT      = 1;
+#  endif
+
+
+// 1. calculate the file offset of the target level
+   long Offset_lv = 0;
+   for (int t=0; t<dlv; t++)
+      Offset_lv += long(UM_NVar)*UM_Size3D[t][0]*UM_Size3D[t][1]*UM_Size3D[t][2]*DataSize;
+
+
+// 2. get the cell indices of each patch group in the file and the range of z slices required by this rank
+   long (*Corner)[3] = new long [NPG][3];
+   long z_min        = UM_Size3D[dlv][2];
+   long z_max        = -1;
+
+   for (int PG=0; PG<NPG; PG++)
+   {
+      const int PID0 = 8*PG;
+
+      for (int d=0; d<3; d++)
+      {
+         Corner[PG][d] = amr->patch[0][UM_lv][PID0]->corner[d] / scale;
+
+         if ( dlv > 0 )    Corner[PG][d] -= FlagPatch[dlv-1][2*d]*PS2;
+
+         if ( Corner[PG][d] < 0  ||  Corner[PG][d]+PS2 > UM_Size3D[dlv][d] )
+            Aux_Error( ERROR_INFO, "Corner[%d] = %ld lies outside the input array (size %ld) !!\n",
+                       d, Corner[PG][d], UM_Size3D[dlv][d] );
+      }
+
+      z_min = MIN( z_min, Corner[PG][2]         );
+      z_max = MAX( z_max, Corner[PG][2]+PS2-1 );
+   }
+
+
+// 3. map the z slabs [z_min, z_max]
+//    --> mmap() requires the file offset to be a multiple of the page size
+   char       *MapPtr [NMap];
+   size_t      MapSize[NMap];
+   const char *SlabPtr[NMap];    // address of the z slice z_min of each mapping
+
+   for (int m=0; m<NMap; m++)
+   {
+      MapPtr [m] = NULL;
+      MapSize[m] = 0;
+      SlabPtr[m] = NULL;
+   }
+
+   if ( NPG > 0 )
+   {
+      const int FileDes = open( UM_Filename, O_RDONLY );
+
+      if ( FileDes < 0 )   Aux_Error( ERROR_INFO, "cannot open the file \"%s\" on rank %d !!\n", UM_Filename, MPI_Rank );
+
+      for (int m=0; m<NMap; m++)
+      {
+         const long Offset_Slab  = Offset_lv + m*UM_Size1v*DataSize + z_min*SliceSize;
+         const long Offset_Align = Offset_Slab - Offset_Slab%PageSize;
+
+         MapSize[m] = Offset_Slab - Offset_Align + ( z_max - z_min + 1 )*SliceSize;
+         MapPtr [m] = (char*)mmap( NULL, MapSize[m], PROT_READ, MAP_PRIVATE, FileDes, Offset_Align );
+
+         if ( MapPtr[m] == MAP_FAILED )
+            Aux_Error( ERROR_INFO, "mmap() failed for the file \"%s\" on rank %d !!\n", UM_Filename, MPI_Rank );
+
+         madvise( MapPtr[m], MapSize[m], MADV_WILLNEED );
+
+         SlabPtr[m] = MapPtr[m] + ( Offset_Slab - Offset_Align );
+      }
+
+//    the mappings remain valid after closing the file
+      close( FileDes );
+   } // if ( NPG > 0 )
+
+
+// 4. copy data to each patch
+#  pragma omp parallel for schedule( runtime ) num_threads( OMP_NT )
+   for (int PG=0; PG<NPG; PG++)
+   {
+      real   fluid_in[UM_NVar], fluid_out[NCOMP_TOTAL];
+      double x, y, z;
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const int PID    = 8*PG + LocalID;
+         const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1 );
+         const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1 );
+         const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1 );
+
+         for (int k=0; k<PS1; k++)  {  z = amr->patch[0][UM_lv][PID]->EdgeL[2] + (k+0.5)*dh;
+         for (int j=0; j<PS1; j++)  {  y = amr->patch[0][UM_lv][PID]->EdgeL[1] + (j+0.5)*dh;
+         for (int i=0; i<PS1; i++)  {  x = amr->patch[0][UM_lv][PID]->EdgeL[0] + (i+0.5)*dh;
+
+//          cell index relative to the z slice z_min
+            const long Idx = IDX321( Corner[PG][0]+Disp_i+i, Corner[PG][1]+Disp_j+j, Corner[PG][2]+Disp_k+k-z_min,
+                                     UM_Size3D[dlv][0], UM_Size3D[dlv][1] );
+
+            if ( UM_Format == UM_IC_FORMAT_ZYXV )
+            {
+               if ( OPT__UM_IC_FLOAT8 )
+                  for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( (const double*)SlabPtr[0] )[ Idx*UM_NVar + v ];
+               else
+                  for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( (const float* )SlabPtr[0] )[ Idx*UM_NVar + v ];
+            }
+
+            else
+            {
+               if ( OPT__UM_IC_FLOAT8 )
+                  for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( (const double*)SlabPtr[v] )[ Idx ];
+               else
+                  for (int v=0; v<UM_NVar; v++) fluid_in[v] = (real)( (const float* )SlabPtr[v] )[ Idx ];
+            }
+
+            Init_ByFile_User_Ptr( fluid_out, fluid_in, UM_NVar, x, y, z, Time[UM_lv], UM_lv, NULL );
+
+            for (int v=0; v<NCOMP_TOTAL; v++)
+               amr->patch[ amr->FluSg[UM_lv] ][UM_lv][PID]->fluid[v][k][j][i] = fluid_out[v];
+         }}}
+      } // for (int LocalID=0; LocalID<8; LocalID++)
+   } // for (int PG=0; PG<NPG; PG++)
+
+
+// free resources
+   for (int m=0; m<NMap; m++)
+      if ( MapPtr[m] != NULL )   munmap( MapPtr[m], MapSize[m] );
+
+   delete [] Corner;
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "      Mapping data from the input file on level %d ... done\n", UM_lv );
+
+} // FUNCTION : Init_ByFile_AssignData_MMap
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Init_ByFile_Default
 // Description :  Function to actually set the fluid field from the input uniform-mesh array
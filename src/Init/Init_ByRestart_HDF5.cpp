@@ -1505,6 +1505,11 @@ void LoadOnePatch( const hid_t H5_FileID, const int lv, const int GID, const boo
                                            PType );
 #     endif
 
+//    sort particles for bitwise reproducibility
+#     ifdef BITWISE_REPRODUCIBILITY
+      Par_SortParList( lv, PID );
+#     endif
+
 //    free resource
       H5_Status = H5Sclose( H5_MemID_ParData );
 
@@ -1795,6 +1800,7 @@ void Check_SymConst( const char *FileName, const int FormatVersion )
    LoadField( "BitRep_Electric",      &RS.BitRep_Electric,      SID, TID, NonFatal, &RT.BitRep_Electric,       1, NonFatal );
 #  endif
    LoadField( "InterpMask",           &RS.InterpMask,           SID, TID, NonFatal, &RT.InterpMask,            1, NonFatal );
+   LoadField( "InterpMaskLocal",      &RS.InterpMaskLocal,      SID, TID, NonFatal, &RT.InterpMaskLocal,       1, NonFatal );
    LoadField( "FB_SepFluOut",         &RS.FB_SepFluOut,         SID, TID, NonFatal, &RT.FB_SepFluOut,          1, NonFatal );
 
 #  if   ( MODEL == HYDRO )
@@ -1982,6 +1988,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Par_GhostSizeTracer",     &RS.Par_GhostSizeTracer,     SID, TID, NonFatal, &RT.Par_GhostSizeTracer,      1, NonFatal );
    LoadField( "Par_TracerVelCorr",       &RS.Par_TracerVelCorr,       SID, TID, NonFatal, &RT.Par_TracerVelCorr,        1, NonFatal );
    LoadField( "Opt__ParInitCheck",       &RS.Opt__ParInitCheck,       SID, TID, NonFatal, &RT.Opt__ParInitCheck,        1, NonFatal );
+   LoadField( "Par_ReorderStep",         &RS.Par_ReorderStep,         SID, TID, NonFatal, &RT.Par_ReorderStep,          1, NonFatal );
 #  endif
 
 // cosmology
@@ -2032,6 +2039,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  if ( MODEL == HYDRO )
    LoadField( "AutoReduceMinModFactor",  &RS.AutoReduceMinModFactor,  SID, TID, NonFatal, &RT.AutoReduceMinModFactor,   1, NonFatal );
    LoadField( "AutoReduceMinModMin",     &RS.AutoReduceMinModMin,     SID, TID, NonFatal, &RT.AutoReduceMinModMin,      1, NonFatal );
+   LoadField( "AutoReduceDtLocal",       &RS.AutoReduceDtLocal,       SID, TID, NonFatal, &RT.AutoReduceDtLocal,        1, NonFatal );
 #  endif
    LoadField( "AutoReduceIntMonoFactor", &RS.AutoReduceIntMonoFactor, SID, TID, NonFatal, &RT.AutoReduceIntMonoFactor,  1, NonFatal );
    LoadField( "AutoReduceIntMonoMin",    &RS.AutoReduceIntMonoMin,    SID, TID, NonFatal, &RT.AutoReduceIntMonoMin,     1, NonFatal );
@@ -2099,6 +2107,8 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
    LoadField( "Opt__ReuseMemory",        &RS.Opt__ReuseMemory,        SID, TID, NonFatal, &RT.Opt__ReuseMemory,         1, NonFatal );
    LoadField( "Opt__MemoryPool",         &RS.Opt__MemoryPool,         SID, TID, NonFatal, &RT.Opt__MemoryPool,          1, NonFatal );
+   LoadField( "Opt__SingleSandglass",    &RS.Opt__SingleSandglass,    SID, TID, NonFatal, &RT.Opt__SingleSandglass,     1, NonFatal );
+   LoadField( "Opt__PatchSlab",          &RS.Opt__PatchSlab,          SID, TID, NonFatal, &RT.Opt__PatchSlab,           1, NonFatal );
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -2210,6 +2220,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "ExtPotTable_dh",           RS.ExtPotTable_dh,          SID, TID, NonFatal,  RT.ExtPotTable_dh,           3, NonFatal );
    LoadField( "ExtPotTable_EdgeL",        RS.ExtPotTable_EdgeL,       SID, TID, NonFatal,  RT.ExtPotTable_EdgeL,        3, NonFatal );
    LoadField( "ExtPotTable_Float8",      &RS.ExtPotTable_Float8,      SID, TID, NonFatal, &RT.ExtPotTable_Float8,       1, NonFatal );
+   LoadField( "ExtPotTable_Cache",       &RS.ExtPotTable_Cache,       SID, TID, NonFatal, &RT.ExtPotTable_Cache,        1, NonFatal );
    LoadField( "Opt__GravityExtraMass",   &RS.Opt__GravityExtraMass,   SID, TID, NonFatal, &RT.Opt__GravityExtraMass,    1, NonFatal );
 #  endif
 
@@ -2272,6 +2283,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "CR_Diffusion_ParaCoeff",  &RS.CR_Diffusion_ParaCoeff,  SID, TID, NonFatal, &RT.CR_Diffusion_ParaCoeff,   1, NonFatal );
    LoadField( "CR_Diffusion_PerpCoeff",  &RS.CR_Diffusion_PerpCoeff,  SID, TID, NonFatal, &RT.CR_Diffusion_PerpCoeff,   1, NonFatal );
    LoadField( "CR_Diffusion_MinB",       &RS.CR_Diffusion_MinB,       SID, TID, NonFatal, &RT.CR_Diffusion_MinB,        1, NonFatal );
+   LoadField( "CR_Diffusion_RKL2",       &RS.CR_Diffusion_RKL2,       SID, TID, NonFatal, &RT.CR_Diffusion_RKL2,        1, NonFatal );
 #  endif
 #  endif // #ifdef COSMIC_RAY
 
@@ -2287,6 +2299,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__UM_IC_Downgrade",    &RS.Opt__UM_IC_Downgrade,    SID, TID, NonFatal, &RT.Opt__UM_IC_Downgrade,     1, NonFatal );
    LoadField( "Opt__UM_IC_Refine",       &RS.Opt__UM_IC_Refine,       SID, TID, NonFatal, &RT.Opt__UM_IC_Refine,        1, NonFatal );
    LoadField( "Opt__UM_IC_LoadNRank",    &RS.Opt__UM_IC_LoadNRank,    SID, TID, NonFatal, &RT.Opt__UM_IC_LoadNRank,     1, NonFatal );
+   LoadField( "Opt__UM_IC_MMap",         &RS.Opt__UM_IC_MMap,         SID, TID, NonFatal, &RT.Opt__UM_IC_MMap,          1, NonFatal );
    LoadField( "Opt__InitRestrict",       &RS.Opt__InitRestrict,       SID, TID, NonFatal, &RT.Opt__InitRestrict,        1, NonFatal );
    LoadField( "Opt__InitGridWithOMP",    &RS.Opt__InitGridWithOMP,    SID, TID, NonFatal, &RT.Opt__InitGridWithOMP,     1, NonFatal );
    LoadField( "Opt__GPUID_Select",       &RS.Opt__GPUID_Select,       SID, TID, NonFatal, &RT.Opt__GPUID_Select,        1, NonFatal );
@@ -2296,6 +2309,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
 #  endif
 #  ifdef SUPPORT_FFTW
    LoadField( "Opt__FFTW_Startup",       &RS.Opt__FFTW_Startup,       SID, TID, NonFatal, &RT.Opt__FFTW_Startup,        1, NonFatal );
+   LoadField( "Opt__FFTW_Cache",         &RS.Opt__FFTW_Cache,         SID, TID, NonFatal, &RT.Opt__FFTW_Cache,          1, NonFatal );
 #  endif
 
 // interpolation schemes
@@ -2346,8 +2360,10 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Opt__Output_Par_Mesh",        &RS.Opt__Output_Par_Mesh,        SID, TID, NonFatal, &RT.Opt__Output_Par_Mesh,        1, NonFatal );
 #  endif
    LoadField( "Opt__Output_BasePS",          &RS.Opt__Output_BasePS,          SID, TID, NonFatal, &RT.Opt__Output_BasePS,          1, NonFatal );
-   if ( OPT__OUTPUT_PART )
+   if ( OPT__OUTPUT_PART ) {
+   LoadField( "Opt__Output_Part_Format",     &RS.Opt__Output_Part_Format,     SID, TID, NonFatal, &RT.Opt__Output_Part_Format,     1, NonFatal );
    LoadField( "Opt__Output_Base",            &RS.Opt__Output_Base,            SID, TID, NonFatal, &RT.Opt__Output_Base,            1, NonFatal );
+   }
 #  ifdef GRAVITY
    LoadField( "Opt__Output_Pot",             &RS.Opt__Output_Pot,             SID, TID, NonFatal, &RT.Opt__Output_Pot,             1, NonFatal );
 #  endif
@@ -2395,6 +2411,7 @@ void Check_InputPara( const char *FileName, const int FormatVersion )
    LoadField( "Output_PartX",                &RS.Output_PartX,                SID, TID, NonFatal, &RT.Output_PartX,                1, NonFatal );
    LoadField( "Output_PartY",                &RS.Output_PartY,                SID, TID, NonFatal, &RT.Output_PartY,                1, NonFatal );
    LoadField( "Output_PartZ",                &RS.Output_PartZ,                SID, TID, NonFatal, &RT.Output_PartZ,                1, NonFatal );
+   LoadField( "Output_PartProjLv",           &RS.Output_PartProjLv,           SID, TID, NonFatal, &RT.Output_PartProjLv,           1, NonFatal );
    }
    LoadField( "InitDumpID",                  &RS.InitDumpID,                  SID, TID, NonFatal, &RT.InitDumpID,                  1, NonFatal );
 
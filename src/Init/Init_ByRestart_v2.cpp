@@ -717,6 +717,11 @@ void Init_ByRestart()
                amr->patch[0][lv][PID]->AddParticle( NParThisPatch, NewParList, &amr->Par->NPar_Lv[lv],
                                                     PType );
 #              endif
+
+//             sort particles for bitwise reproducibility
+#              ifdef BITWISE_REPRODUCIBILITY
+               Par_SortParList( lv, PID );
+#              endif
             } // if ( amr->patch[0][lv][PID]->NPar > 0 )
          } // for PID, lv
 
@@ -3,6 +3,13 @@
 #ifdef SUPPORT_FFTW
 
 static int ZIndex2Rank( const int IndexZ, const int *List_z_start, const int TRank_Guess );
+#if ( SUPPORT_FFTW == FFTW3 )
+static ulong GetWisdomKey( const int StartupFlag );
+static void  ImportWisdom( const ulong Key );
+static void  ExportWisdom( const ulong Key );
+#endif
+
+static const char FFTW_CacheDir[] = "FFTW_Cache";
 
 root_fftw::real_plan_nd FFTW_Plan_PS;                       // PS  : plan for calculating the power spectrum
 #ifdef GRAVITY
@@ -127,6 +134,20 @@ void Init_FFTW()
 #  endif // # if ( SUPPORT_FFTW == FFTW3 )
 
 
+// create the directory storing the FFTW wisdom and the Green's function
+   if ( OPT__FFTW_CACHE )
+   {
+      if ( MPI_Rank == 0  &&  !Aux_CheckFolderExist(FFTW_CacheDir) )
+      {
+         char Cmd[MAX_STRING];
+         sprintf( Cmd, "mkdir -p %s", FFTW_CacheDir );
+         system( Cmd );
+      }
+
+      MPI_Barrier( MPI_COMM_WORLD );
+   }
+
+
 
 // determine the FFT size for the power spectrum
    int PS_FFT_Size[3]      = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2] };
@@ -184,6 +205,14 @@ void Init_FFTW()
       default:                       Aux_Error( ERROR_INFO, "unrecognised FFTW startup option %d  !!\n", OPT__FFTW_STARTUP );
    } // switch ( OPT__FFTW_STARTUP )
 
+// load the wisdom accumulated by previous runs with the same FFT configuration
+// --> plans created with FFTW_MEASURE/FFTW_PATIENT can then skip the expensive measurements
+#  if ( SUPPORT_FFTW == FFTW3 )
+   const ulong WisdomKey = ( OPT__FFTW_CACHE ) ? GetWisdomKey( StartupFlag ) : 0UL;
+
+   if ( OPT__FFTW_CACHE )  ImportWisdom( WisdomKey );
+#  endif
+
 // allocate memory for arrays in fftw3
 #  if ( SUPPORT_FFTW == FFTW3 )
    PS   = (real*) root_fftw::fft_malloc( ComputePaddedTotalSize(PS_FFT_Size     )*sizeof(real) );
@@ -234,6 +263,11 @@ void Init_FFTW()
 
 #  endif // #  if ( MODEL == ELBDM )
 
+// store the wisdom for future runs
+#  if ( SUPPORT_FFTW == FFTW3 )
+   if ( OPT__FFTW_CACHE )  ExportWisdom( WisdomKey );
+#  endif
+
 // free memory for arrays in fftw3
 #  if ( SUPPORT_FFTW == FFTW3 )
    root_fftw::fft_free(PS);
@@ -304,6 +338,141 @@ void End_FFTW()
 } // FUNCTION : End_FFTW
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  FFTW_GetCacheFileName
+// Description :  Get the name of a file stored in the FFTW cache directory
+//
+// Note        :  1. Format: "FFTW_Cache/Prefix_Key[_RankXXXXXX]"
+//                2. Key should be the hash of all parameters the cached data depend on
+//                   --> Files computed with different parameters thus never collide
+//
+// Parameter   :  FileName : Output file name (must have at least MAX_STRING elements)
+//                Prefix   : Prefix of the file name
+//                Key      : Hash key of the cached data
+//                Rank     : MPI rank appended to the file name
+//                           --> Set to a negative value for files shared by all ranks
+//-------------------------------------------------------------------------------------------------------
+void FFTW_GetCacheFileName( char *FileName, const char *Prefix, const ulong Key, const int Rank )
+{
+
+   if ( Rank >= 0 )  sprintf( FileName, "%s/%s_%016lx_Rank%06d", FFTW_CacheDir, Prefix, Key, Rank );
+   else              sprintf( FileName, "%s/%s_%016lx",          FFTW_CacheDir, Prefix, Key );
+
+} // FUNCTION : FFTW_GetCacheFileName
+
+
+
+#if ( SUPPORT_FFTW == FFTW3 )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetWisdomKey
+// Description :  Return the hash key of all parameters affecting the FFTW plans created by Init_FFTW()
+//
+// Note        :  1. Include the grid size, MPI/OpenMP layout, floating-point precision, planner flag, and
+//                   FFTW version
+//
+// Parameter   :  StartupFlag : FFTW planner flag
+//
+// Return      :  Hash key
+//-------------------------------------------------------------------------------------------------------
+ulong GetWisdomKey( const int StartupFlag )
+{
+
+   long Para[16];
+   int  NPara = 0;
+
+   for (int d=0; d<3; d++)    Para[ NPara ++ ] = NX0_TOT[d];
+   Para[ NPara ++ ] = MPI_NRank;
+   Para[ NPara ++ ] = OMP_NTHREAD;
+   Para[ NPara ++ ] = FFTW3_Double_OMP_Enabled;
+   Para[ NPara ++ ] = FFTW3_Single_OMP_Enabled;
+   Para[ NPara ++ ] = sizeof(real);
+   Para[ NPara ++ ] = StartupFlag;
+   Para[ NPara ++ ] = MODEL;
+#  ifdef GRAVITY
+   Para[ NPara ++ ] = OPT__BC_POT;
+#  endif
+#  if ( MODEL == ELBDM  &&  WAVE_SCHEME == WAVE_GRAMFE )
+   Para[ NPara ++ ] = GRAMFE_FLU_NXT;
+#  endif
+
+   ulong Key = Aux_Hash( Para, NPara*sizeof(long), AUX_HASH_INIT );
+   Key = Aux_Hash( fftw_version, strlen(fftw_version), Key );
+
+   return Key;
+
+} // FUNCTION : GetWisdomKey
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ImportWisdom
+// Description :  Import the double- and single-precision FFTW wisdom from the cache directory
+//
+// Note        :  1. Only rank 0 reads the files, which are then broadcast to all ranks
+//                2. Missing files are silently ignored
+//
+// Parameter   :  Key : Hash key returned by GetWisdomKey()
+//-------------------------------------------------------------------------------------------------------
+void ImportWisdom( const ulong Key )
+{
+
+   char FileName_D[MAX_STRING], FileName_F[MAX_STRING];
+
+   FFTW_GetCacheFileName( FileName_D, "Wisdom_Double", Key, -1 );
+   FFTW_GetCacheFileName( FileName_F, "Wisdom_Single", Key, -1 );
+
+   if ( MPI_Rank == 0 )
+   {
+      if ( Aux_CheckFileExist(FileName_D)  &&  !fftw_import_wisdom_from_filename(FileName_D) )
+         Aux_Message( stderr, "WARNING : failed to import the FFTW wisdom \"%s\" !!\n", FileName_D );
+
+      if ( Aux_CheckFileExist(FileName_F)  &&  !fftwf_import_wisdom_from_filename(FileName_F) )
+         Aux_Message( stderr, "WARNING : failed to import the FFTW wisdom \"%s\" !!\n", FileName_F );
+   }
+
+#  ifndef SERIAL
+   fftw_mpi_broadcast_wisdom( MPI_COMM_WORLD );
+   fftwf_mpi_broadcast_wisdom( MPI_COMM_WORLD );
+#  endif
+
+} // FUNCTION : ImportWisdom
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ExportWisdom
+// Description :  Export the double- and single-precision FFTW wisdom to the cache directory
+//
+// Note        :  1. The wisdom of all ranks is gathered to rank 0 before being written
+//
+// Parameter   :  Key : Hash key returned by GetWisdomKey()
+//-------------------------------------------------------------------------------------------------------
+void ExportWisdom( const ulong Key )
+{
+
+#  ifndef SERIAL
+   fftw_mpi_gather_wisdom( MPI_COMM_WORLD );
+   fftwf_mpi_gather_wisdom( MPI_COMM_WORLD );
+#  endif
+
+   if ( MPI_Rank == 0 )
+   {
+      char FileName_D[MAX_STRING], FileName_F[MAX_STRING];
+
+      FFTW_GetCacheFileName( FileName_D, "Wisdom_Double", Key, -1 );
+      FFTW_GetCacheFileName( FileName_F, "Wisdom_Single", Key, -1 );
+
+      if ( !fftw_export_wisdom_to_filename(FileName_D) )
+         Aux_Message( stderr, "WARNING : failed to export the FFTW wisdom \"%s\" !!\n", FileName_D );
+
+      if ( !fftwf_export_wisdom_to_filename(FileName_F) )
+         Aux_Message( stderr, "WARNING : failed to export the FFTW wisdom \"%s\" !!\n", FileName_F );
+   }
+
+} // FUNCTION : ExportWisdom
+#endif // #if ( SUPPORT_FFTW == FFTW3 )
+
+
 
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Patch2Slab
@@ -168,7 +168,8 @@ void Init_GAMER( int *argc, char ***argv )
 
 
 // initialize memory pool
-   if ( OPT__MEMORY_POOL )    Init_MemoryPool();
+// --> the adaptive memory pool is adjusted by Mis_AdjustMemoryPool() during the evolution
+   if ( OPT__MEMORY_POOL == MEMORY_POOL_TABLE )    Init_MemoryPool();
 
 
 // allocate memory for several CPU/GPU global arrays
@@ -91,6 +91,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__FREEZE_PAR",            &OPT__FREEZE_PAR,                 false,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "PAR_TR_VEL_CORR",            &amr->Par->TracerVelCorr,         false,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__PAR_INIT_CHECK",        &OPT__PAR_INIT_CHECK,             true,             Useless_bool,  Useless_bool   );
+   ReadPara->Add( "PAR_REORDER_STEP",           &PAR_REORDER_STEP,                0,                NoMin_int,     NoMax_int      );
 #  endif // #ifdef PARTICLE
 
 
@@ -147,6 +148,7 @@ void Init_Load_Parameter()
 #  if ( MODEL == HYDRO )
    ReadPara->Add( "AUTO_REDUCE_MINMOD_FACTOR",  &AUTO_REDUCE_MINMOD_FACTOR,       0.8,             Eps_double,    1.0            );
    ReadPara->Add( "AUTO_REDUCE_MINMOD_MIN",     &AUTO_REDUCE_MINMOD_MIN,          1.0e-2,          0.0,           NoMax_double   );
+   ReadPara->Add( "AUTO_REDUCE_DT_LOCAL",       &AUTO_REDUCE_DT_LOCAL,            false,           Useless_bool,  Useless_bool   );
 #  endif
    ReadPara->Add( "AUTO_REDUCE_INT_MONO_FACTOR",&AUTO_REDUCE_INT_MONO_FACTOR,     0.8,             Eps_double,    1.0            );
    ReadPara->Add( "AUTO_REDUCE_INT_MONO_MIN",   &AUTO_REDUCE_INT_MONO_MIN,        1.0e-2,          0.0,           NoMax_double   );
@@ -217,7 +219,9 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__PARTICLE_COUNT",        &OPT__PARTICLE_COUNT,             1,               0,             2              );
 #  endif
    ReadPara->Add( "OPT__REUSE_MEMORY",          &OPT__REUSE_MEMORY,               2,               0,             2              );
-   ReadPara->Add( "OPT__MEMORY_POOL",           &OPT__MEMORY_POOL,                false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__MEMORY_POOL",           &OPT__MEMORY_POOL,                0,               0,             2              );
+   ReadPara->Add( "OPT__SINGLE_SANDGLASS",      &OPT__SINGLE_SANDGLASS,           false,           Useless_bool,  Useless_bool   );
+   ReadPara->Add( "OPT__PATCH_SLAB",            &OPT__PATCH_SLAB,                 false,           Useless_bool,  Useless_bool   );
 
 
 // load balance
@@ -305,6 +309,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "CR_DIFF_PARA",               &CR_DIFF_PARA,                    0.0,             0.0,           NoMax_double   );
    ReadPara->Add( "CR_DIFF_PERP",               &CR_DIFF_PERP,                    0.0,             0.0,           NoMax_double   );
    ReadPara->Add( "CR_DIFF_MIN_B",              &CR_DIFF_MIN_B,                   0.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "CR_DIFF_RKL2",               &CR_DIFF_RKL2,                    false,           Useless_bool,  Useless_bool   );
 #  endif
 
 
@@ -432,6 +437,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "EXT_POT_TABLE_EDGEL_Z",      &EXT_POT_TABLE_EDGEL[2],          NoDef_double,    NoMin_double,  NoMax_double   );
 // fix EXT_POT_TABLE_FLOAT8 to -1 for now since this option is not supported yet
    ReadPara->Add( "EXT_POT_TABLE_FLOAT8",       &EXT_POT_TABLE_FLOAT8,           -1,              -1,            -1              );
+   ReadPara->Add( "EXT_POT_TABLE_CACHE",        &EXT_POT_TABLE_CACHE,             true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__GRAVITY_EXTRA_MASS",    &OPT__GRAVITY_EXTRA_MASS,         false,           Useless_bool,  Useless_bool   );
 #  endif // #ifdef GRAVITY
 
@@ -454,6 +460,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "OPT__UM_IC_DOWNGRADE",       &OPT__UM_IC_DOWNGRADE,            true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__UM_IC_REFINE",          &OPT__UM_IC_REFINE,               true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__UM_IC_LOAD_NRANK",      &OPT__UM_IC_LOAD_NRANK,           1,               1,             NoMax_int      );
+   ReadPara->Add( "OPT__UM_IC_MMAP",            &OPT__UM_IC_MMAP,                 false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__INIT_RESTRICT",         &OPT__INIT_RESTRICT,              true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__INIT_GRID_WITH_OMP",    &OPT__INIT_GRID_WITH_OMP,         true,            Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__GPUID_SELECT",          &OPT__GPUID_SELECT,              -1,              -3,             NoMax_int      );
@@ -469,6 +476,7 @@ void Init_Load_Parameter()
 #  else  // # if ( SUPPORT_FFTW == FFTW2 ) ... # else
 #  error : ERROR : Unsupported FFTW version for OPT__FFTW_STARTUP
 #  endif // #  if ( SUPPORT_FFTW == FFTW2 ) ... # else
+   ReadPara->Add( "OPT__FFTW_CACHE",       &OPT__FFTW_CACHE,                 false,           Useless_bool,  Useless_bool   );
 #  endif // # ifdef SUPPORT_FFTW
 
 
@@ -518,7 +526,8 @@ void Init_Load_Parameter()
 
 // data dump
    ReadPara->Add( "OPT__OUTPUT_TOTAL",          &OPT__OUTPUT_TOTAL,               1,               0,             2              );
-   ReadPara->Add( "OPT__OUTPUT_PART",           &OPT__OUTPUT_PART,                0,               0,             8              );
+   ReadPara->Add( "OPT__OUTPUT_PART",           &OPT__OUTPUT_PART,                0,               0,             11             );
+   ReadPara->Add( "OPT__OUTPUT_PART_FORMAT",    &OPT__OUTPUT_PART_FORMAT,         1,               1,             2              );
    ReadPara->Add( "OPT__OUTPUT_USER",           &OPT__OUTPUT_USER,                false,           Useless_bool,  Useless_bool   );
    ReadPara->Add( "OPT__OUTPUT_TEXT_FORMAT_FLT", OPT__OUTPUT_TEXT_FORMAT_FLT,     "%24.16e",       Useless_str,   Useless_str    );
    ReadPara->Add( "OPT__OUTPUT_TEXT_LENGTH_INT",&OPT__OUTPUT_TEXT_LENGTH_INT,     12,              0,             NoMax_int      );
@@ -575,6 +584,7 @@ void Init_Load_Parameter()
    ReadPara->Add( "OUTPUT_PART_X",              &OUTPUT_PART_X,                  -1.0,             NoMin_double,  NoMax_double   );
    ReadPara->Add( "OUTPUT_PART_Y",              &OUTPUT_PART_Y,                  -1.0,             NoMin_double,  NoMax_double   );
    ReadPara->Add( "OUTPUT_PART_Z",              &OUTPUT_PART_Z,                  -1.0,             NoMin_double,  NoMax_double   );
+   ReadPara->Add( "OUTPUT_PART_PROJ_LV",        &OUTPUT_PART_PROJ_LV,            -1,               NoMin_int,     TOP_LEVEL      );
    ReadPara->Add( "INIT_DUMPID",                &INIT_DUMPID,                    -1,               NoMin_int,     NoMax_int      );
    ReadPara->Add( "OUTPUT_DIR",                  OUTPUT_DIR,                     ".",              Useless_str,   Useless_str    );
 
@@ -38,6 +38,11 @@ void Init_MemAllocate()
       Init_MemAllocate_Grackle( CHE_GPU_NPGROUP );
 #  endif
 
+#  ifdef CR_DIFFUSION
+   if ( CR_DIFF_RKL2 )
+      Init_MemAllocate_CR_Diff( FLU_GPU_NPGROUP );
+#  endif
+
 
 // c. allocate load-balance variables
 #  ifdef LOAD_BALANCE
@@ -11,8 +11,9 @@
 //                   --> Set the numbers at higher levels to zero if they are not specified in the table
 //                   --> Currently the table must have one header line
 //                2. Preallocate patches with both fluid and pot data allocated
-//                3. Controlled by the option "OPT__MEMORY_POOL"
+//                3. Controlled by the option "OPT__MEMORY_POOL == MEMORY_POOL_TABLE"
 //                   --> Must turn on "OPT__REUSE_MEMORY" as well
+//                   --> See Mis_AdjustMemoryPool() for the adaptive memory pool (MEMORY_POOL_AUTO)
 //
 // Parameter   :  None
 //
@@ -952,6 +952,16 @@ void Init_ResetParameter()
 #  endif
 
 
+// OUTPUT_PART_PROJ_LV
+   if (  ( OPT__OUTPUT_PART == OUTPUT_PROJ_XY || OPT__OUTPUT_PART == OUTPUT_PROJ_YZ || OPT__OUTPUT_PART == OUTPUT_PROJ_XZ )  &&
+         OUTPUT_PART_PROJ_LV < 0  )
+   {
+      OUTPUT_PART_PROJ_LV = MAX_LEVEL;
+
+      PRINT_RESET_PARA( OUTPUT_PART_PROJ_LV, FORMAT_INT, "" );
+   }
+
+
 // reset MPI_NRank_X
 #  ifdef SERIAL
    for (int d=0; d<3; d++)
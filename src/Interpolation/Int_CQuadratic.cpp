@@ -1,10 +1,11 @@
 #include "GAMER.h"
+#include "Int_Specialized.h"
 
 
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Int_CQuadratic
+// Function    :  Int_CQuadratic_Kernel
 // Description :  Perform spatial interpolation based on the conservative quadratic interpolation
 //
 // Note        :  1. It is the 3D generalization of the 1D central interpolation
@@ -15,11 +16,13 @@
 //                   in order
 //                4. The "Monotonic" option is used to ensure that the interpolation results are monotonic
 //                   --> A slope limiter is adopted to ensure the monotonicity
+//                5. Function template with compile-time CRange[] (CRX/Y/Z > 0) and monotonicity (MONO)
+//                   --> See Int_Specialized.h
 //
 // Parameter   :  CData           : Input coarse-grid array
 //                CSize           : Size of the CData array
 //                CStart          : (x,y,z) starting indices to perform interpolation on the CData array
-//                CRange          : Number of grids in each direction to perform interpolation
+//                CRange_In       : Number of grids in each direction to perform interpolation
 //                FData           : Output fine-grid array
 //                FStart          : (x,y,z) starting indcies to store the interpolation results
 //                NComp           : Number of components in the CData and FData array
@@ -28,12 +31,20 @@
 //                MonoCoeff       : Slope limiter coefficient for the option "Monotonic"
 //                OppSign0thOrder : See Int_MinMod1D()
 //-------------------------------------------------------------------------------------------------------
-void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
-                     real FData[], const int FSize[3], const int FStart[3], const int NComp,
-                     const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
-                     const bool OppSign0thOrder )
+template <int CRX, int CRY, int CRZ, int MONO>
+static void Int_CQuadratic_Kernel( real CData[], const int CSize[3], const int CStart[3], const int CRange_In[3],
+                                   real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                                   const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                                   const bool OppSign0thOrder )
 {
 
+// number of coarse-grid cells to be interpolated along each direction
+// --> compile-time constants in the specialized kernels
+   const int CRange[3] = { ( CRX > 0 ) ? CRX : CRange_In[0],
+                           ( CRY > 0 ) ? CRY : CRange_In[1],
+                           ( CRZ > 0 ) ? CRZ : CRange_In[2] };
+
+
 // interpolation-scheme-dependent parameters
 // ===============================================================================
 // number of coarse-grid ghost zone
@@ -63,8 +74,12 @@ void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], cons
 
    real *CPtr   = CData;
    real *FPtr   = FData;
-   real *TDataX = new real [ (CRange[2]+2*CGhost)*TdzX ];   // temporary array after x interpolation
-   real *TDataY = new real [ (CRange[2]+2*CGhost)*TdzY ];   // temporary array after y interpolation
+// temporary arrays after x and y interpolations (allocated on the stack in the specialized kernels)
+   const bool FixShape = INT_SPEC_FIX_SHAPE( CRX, CRY, CRZ );
+   real TDataX_Stack[ INT_SPEC_TSIZE_X( CRX, CRY, CRZ, CGhost ) ];
+   real TDataY_Stack[ INT_SPEC_TSIZE_Y( CRX, CRY, CRZ, CGhost ) ];
+   real *TDataX = ( FixShape ) ? TDataX_Stack : new real [ (CRange[2]+2*CGhost)*TdzX ];
+   real *TDataY = ( FixShape ) ? TDataY_Stack : new real [ (CRange[2]+2*CGhost)*TdzY ];
 
    int  Idx_InL, Idx_InC, Idx_InR, Idx_Out;
    real LSlopeDh_4, RSlopeDh_4, SlopeDh_4, Sign;
@@ -72,6 +87,9 @@ void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], cons
 
    for (int v=0; v<NComp; v++)
    {
+//    monotonicity of this component
+      const bool Mono = ( MONO == INT_SPEC_MONO_RUNTIME ) ? Monotonic[v] : ( MONO == INT_SPEC_MONO_YES );
+
 //    unwrap phase along x direction
 #     if ( MODEL == ELBDM )
       if ( UnwrapPhase )
@@ -101,7 +119,7 @@ void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], cons
          SlopeDh_4 = (real)0.125*( CPtr[Idx_InR] - CPtr[Idx_InL] );
 
 //       ensure monotonicity
-         if ( Monotonic[v] )
+         if ( Mono )
          {
             LSlopeDh_4 = (real)0.25*( CPtr[Idx_InC] - CPtr[Idx_InL] );
             RSlopeDh_4 = (real)0.25*( CPtr[Idx_InR] - CPtr[Idx_InC] );
@@ -123,7 +141,7 @@ void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], cons
 
             else
                SlopeDh_4 = (real)0.0;
-         } // if ( Monotonic[v] )
+         } // if ( Mono )
 
          if ( OppSign0thOrder  &&  CPtr[Idx_InL]*CPtr[Idx_InR] < (real)0.0 )  SlopeDh_4 = (real)0.0;
 
@@ -161,7 +179,7 @@ void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], cons
 
          SlopeDh_4 = (real)0.125*( TDataX[Idx_InR] - TDataX[Idx_InL] );
 
-         if ( Monotonic[v] )
+         if ( Mono )
          {
             LSlopeDh_4 = (real)0.25*( TDataX[Idx_InC] - TDataX[Idx_InL] );
             RSlopeDh_4 = (real)0.25*( TDataX[Idx_InR] - TDataX[Idx_InC] );
@@ -183,7 +201,7 @@ void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], cons
 
             else
                SlopeDh_4 = (real)0.0;
-         } // if ( Monotonic[v] )
+         } // if ( Mono )
 
          if ( OppSign0thOrder  &&  TDataX[Idx_InL]*TDataX[Idx_InR] < (real)0.0 )    SlopeDh_4 = (real)0.0;
 
@@ -221,7 +239,7 @@ void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], cons
 
          SlopeDh_4 = (real)0.125*( TDataY[Idx_InR] - TDataY[Idx_InL] );
 
-         if ( Monotonic[v] )
+         if ( Mono )
          {
             LSlopeDh_4 = (real)0.25*( TDataY[Idx_InC] - TDataY[Idx_InL] );
             RSlopeDh_4 = (real)0.25*( TDataY[Idx_InR] - TDataY[Idx_InC] );
@@ -243,7 +261,7 @@ void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], cons
 
             else
                SlopeDh_4 = (real)0.0;
-         } // if ( Monotonic[v] )
+         } // if ( Mono )
 
          if ( OppSign0thOrder  &&  TDataY[Idx_InL]*TDataY[Idx_InR] < (real)0.0 )    SlopeDh_4 = (real)0.0;
 
@@ -257,7 +275,37 @@ void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], cons
 
    } // for (int v=0; v<NComp; v++)
 
-   delete [] TDataX;
-   delete [] TDataY;
+   if ( !FixShape )
+   {
+      delete [] TDataX;
+      delete [] TDataY;
+   }
+
+} // FUNCTION : Int_CQuadratic_Kernel
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_CQuadratic
+// Description :  Generic path of Int_CQuadratic_Kernel() with CRange[] and monotonicity determined at runtime
+//
+// Note        :  1. Invoked by Interpolate() for the shapes not listed in INT_SPEC_SHAPE_LIST
+//                2. Kernels specialized for the shapes in INT_SPEC_SHAPE_LIST are stored in Int_CQuadratic_Spec[][]
+//
+// Parameter   :  See Int_CQuadratic_Kernel()
+//-------------------------------------------------------------------------------------------------------
+void Int_CQuadratic( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                     real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                     const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                     const bool OppSign0thOrder )
+{
+
+   Int_CQuadratic_Kernel<0,0,0,INT_SPEC_MONO_RUNTIME>( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                                                       UnwrapPhase, Monotonic, MonoCoeff, OppSign0thOrder );
 
 } // FUNCTION : Int_CQuadratic
+
+
+
+// kernels specialized for the shapes in INT_SPEC_SHAPE_LIST
+IntSchemeFunc_t Int_CQuadratic_Spec[INT_SPEC_NSHAPE][2] = { INT_SPEC_SHAPE_LIST( INT_SPEC_KERNEL, Int_CQuadratic_Kernel ) };
@@ -1,10 +1,11 @@
 #include "GAMER.h"
+#include "Int_Specialized.h"
 
 
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Int_MinMod1D
+// Function    :  Int_MinMod1D_Kernel
 // Description :  Perform spatial interpolation based on the MinMod limiter
 //
 // Note        :  1. MinMod limiter:
@@ -19,22 +20,32 @@
 //                           the low central density
 //                2. BOTH conservative and monotonic
 //                3. 3D interpolation is realized by computing the slopes in all three directions at once
+//                4. Function template with compile-time CRange[] (CRX/Y/Z > 0)
+//                   --> See Int_Specialized.h
 //
 // Parameter   :  CData           : Input coarse-grid array
 //                CSize           : Size of the CData array
 //                CStart          : (x,y,z) starting indices to perform interpolation on the CData array
-//                CRange          : Number of grids in each direction to perform interpolation
+//                CRange_In       : Number of grids in each direction to perform interpolation
 //                FData           : Output fine-grid array
 //                FStart          : (x,y,z) starting indcies to store the interpolation results
 //                NComp           : Number of components in the CData and FData array
 //                OppSign0thOrder : See the note above
 //-------------------------------------------------------------------------------------------------------
-void Int_MinMod1D( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
-                   real FData[], const int FSize[3], const int FStart[3], const int NComp,
-                   const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
-                   const bool OppSign0thOrder )
+template <int CRX, int CRY, int CRZ>
+static void Int_MinMod1D_Kernel( real CData[], const int CSize[3], const int CStart[3], const int CRange_In[3],
+                                 real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                                 const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                                 const bool OppSign0thOrder )
 {
 
+// number of coarse-grid cells to be interpolated along each direction
+// --> compile-time constants in the specialized kernels
+   const int CRange[3] = { ( CRX > 0 ) ? CRX : CRange_In[0],
+                           ( CRY > 0 ) ? CRY : CRange_In[1],
+                           ( CRZ > 0 ) ? CRZ : CRange_In[2] };
+
+
    const int Cdx = 1;
    const int Cdy = CSize[0];
    const int Cdz = CSize[0]*CSize[1];
@@ -92,4 +103,31 @@ void Int_MinMod1D( real CData[], const int CSize[3], const int CStart[3], const
       }
    } // for (int v=0; v<NComp; v++)
 
+} // FUNCTION : Int_MinMod1D_Kernel
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_MinMod1D
+// Description :  Generic path of Int_MinMod1D_Kernel() with CRange[] determined at runtime
+//
+// Note        :  1. Invoked by Interpolate() for the shapes not listed in INT_SPEC_SHAPE_LIST
+//                2. Kernels specialized for the shapes in INT_SPEC_SHAPE_LIST are stored in Int_MinMod1D_Spec[][]
+//
+// Parameter   :  See Int_MinMod1D_Kernel()
+//-------------------------------------------------------------------------------------------------------
+void Int_MinMod1D( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                   real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                   const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                   const bool OppSign0thOrder )
+{
+
+   Int_MinMod1D_Kernel<0,0,0>( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                               UnwrapPhase, Monotonic, MonoCoeff, OppSign0thOrder );
+
 } // FUNCTION : Int_MinMod1D
+
+
+
+// kernels specialized for the shapes in INT_SPEC_SHAPE_LIST
+IntSchemeFunc_t Int_MinMod1D_Spec[INT_SPEC_NSHAPE][2] = { INT_SPEC_SHAPE_LIST( INT_SPEC_KERNEL_NOMONO, Int_MinMod1D_Kernel ) };
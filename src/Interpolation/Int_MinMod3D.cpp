@@ -1,33 +1,44 @@
 #include "GAMER.h"
+#include "Int_Specialized.h"
 
 
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Int_MinMod3D
+// Function    :  Int_MinMod3D_Kernel
 // Description :  Perform spatial interpolation based on the MinMod limiter
 //
 // Note        :  1. MinMod limiter: see Int_MinMod1D()
 //                2. BOTH conservative and monotonic
 //                3. 3D interpolation is achieved by performing interpolation along x, y, and z directions
 //                   in order --> different from MINMOD1D
+//                4. Function template with compile-time CRange[] (CRX/Y/Z > 0)
+//                   --> See Int_Specialized.h
 //
 // Parameter   :  CData           : Input coarse-grid array
 //                CSize           : Size of the CData array
 //                CStart          : (x,y,z) starting indices to perform interpolation on the CData array
-//                CRange          : Number of grids in each direction to perform interpolation
+//                CRange_In       : Number of grids in each direction to perform interpolation
 //                FData           : Output fine-grid array
 //                FStart          : (x,y,z) starting indcies to store the interpolation results
 //                NComp           : Number of components in the CData and FData array
 //                UnwrapPhase     : Unwrap phase when OPT__INT_PHASE is on (for ELBDM only)
 //                OppSign0thOrder : See Int_MinMod1D()
 //-------------------------------------------------------------------------------------------------------
-void Int_MinMod3D( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
-                   real FData[], const int FSize[3], const int FStart[3], const int NComp,
-                   const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
-                   const bool OppSign0thOrder )
+template <int CRX, int CRY, int CRZ>
+static void Int_MinMod3D_Kernel( real CData[], const int CSize[3], const int CStart[3], const int CRange_In[3],
+                                 real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                                 const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                                 const bool OppSign0thOrder )
 {
 
+// number of coarse-grid cells to be interpolated along each direction
+// --> compile-time constants in the specialized kernels
+   const int CRange[3] = { ( CRX > 0 ) ? CRX : CRange_In[0],
+                           ( CRY > 0 ) ? CRY : CRange_In[1],
+                           ( CRZ > 0 ) ? CRZ : CRange_In[2] };
+
+
 // interpolation-scheme-dependent parameters
 // ===============================================================================
 // number of coarse-grid ghost zone
@@ -57,8 +68,12 @@ void Int_MinMod3D( real CData[], const int CSize[3], const int CStart[3], const
 
    real *CPtr   = CData;
    real *FPtr   = FData;
-   real *TDataX = new real [ (CRange[2]+2*CGhost)*TdzX ];   // temporary array after x interpolation
-   real *TDataY = new real [ (CRange[2]+2*CGhost)*TdzY ];   // temporary array after y interpolation
+// temporary arrays after x and y interpolations (allocated on the stack in the specialized kernels)
+   const bool FixShape = INT_SPEC_FIX_SHAPE( CRX, CRY, CRZ );
+   real TDataX_Stack[ INT_SPEC_TSIZE_X( CRX, CRY, CRZ, CGhost ) ];
+   real TDataY_Stack[ INT_SPEC_TSIZE_Y( CRX, CRY, CRZ, CGhost ) ];
+   real *TDataX = ( FixShape ) ? TDataX_Stack : new real [ (CRange[2]+2*CGhost)*TdzX ];
+   real *TDataY = ( FixShape ) ? TDataY_Stack : new real [ (CRange[2]+2*CGhost)*TdzY ];
 
    int  Idx_InL, Idx_InC, Idx_InR, Idx_Out;
    real LSlope, RSlope, SlopeDh_4;
@@ -190,7 +205,37 @@ void Int_MinMod3D( real CData[], const int CSize[3], const int CStart[3], const
 
    } // for (int v=0; v<NComp; v++)
 
-   delete [] TDataX;
-   delete [] TDataY;
+   if ( !FixShape )
+   {
+      delete [] TDataX;
+      delete [] TDataY;
+   }
+
+} // FUNCTION : Int_MinMod3D_Kernel
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_MinMod3D
+// Description :  Generic path of Int_MinMod3D_Kernel() with CRange[] determined at runtime
+//
+// Note        :  1. Invoked by Interpolate() for the shapes not listed in INT_SPEC_SHAPE_LIST
+//                2. Kernels specialized for the shapes in INT_SPEC_SHAPE_LIST are stored in Int_MinMod3D_Spec[][]
+//
+// Parameter   :  See Int_MinMod3D_Kernel()
+//-------------------------------------------------------------------------------------------------------
+void Int_MinMod3D( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                   real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                   const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                   const bool OppSign0thOrder )
+{
+
+   Int_MinMod3D_Kernel<0,0,0>( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                               UnwrapPhase, Monotonic, MonoCoeff, OppSign0thOrder );
 
 } // FUNCTION : Int_MinMod3D
+
+
+
+// kernels specialized for the shapes in INT_SPEC_SHAPE_LIST
+IntSchemeFunc_t Int_MinMod3D_Spec[INT_SPEC_NSHAPE][2] = { INT_SPEC_SHAPE_LIST( INT_SPEC_KERNEL_NOMONO, Int_MinMod3D_Kernel ) };
@@ -1,10 +1,11 @@
 #include "GAMER.h"
+#include "Int_Specialized.h"
 
 
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Int_Quartic
+// Function    :  Int_Quartic_Kernel
 // Description :  Perform spatial interpolation based on the quartic interpolation
 //
 // Note        :  1. The spatial disribution is approximated by a quartic polynomial in each direction
@@ -15,11 +16,13 @@
 //                   in order
 //                4. The "Monotonic" option is used to ensure that the interpolation results are monotonic
 //                   --> A slope limiter is adopted to ensure the monotonicity
+//                5. Function template with compile-time CRange[] (CRX/Y/Z > 0) and monotonicity (MONO)
+//                   --> See Int_Specialized.h
 //
 // Parameter   :  CData           : Input coarse-grid array
 //                CSize           : Size of the CData array
 //                CStart          : (x,y,z) starting indices to perform interpolation on the CData array
-//                CRange          : Number of grids in each direction to perform interpolation
+//                CRange_In       : Number of grids in each direction to perform interpolation
 //                FData           : Output fine-grid array
 //                FStart          : (x,y,z) starting indcies to store the interpolation results
 //                NComp           : Number of components in the CData and FData array
@@ -28,12 +31,20 @@
 //                MonoCoeff       : Slope limiter coefficient for the option "Monotonic"
 //                OppSign0thOrder : See Int_MinMod1D()
 //-------------------------------------------------------------------------------------------------------
-void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
-                  real FData[], const int FSize[3], const int FStart[3], const int NComp,
-                  const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
-                  const bool OppSign0thOrder )
+template <int CRX, int CRY, int CRZ, int MONO>
+static void Int_Quartic_Kernel( real CData[], const int CSize[3], const int CStart[3], const int CRange_In[3],
+                                real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                                const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                                const bool OppSign0thOrder )
 {
 
+// number of coarse-grid cells to be interpolated along each direction
+// --> compile-time constants in the specialized kernels
+   const int CRange[3] = { ( CRX > 0 ) ? CRX : CRange_In[0],
+                           ( CRY > 0 ) ? CRY : CRange_In[1],
+                           ( CRZ > 0 ) ? CRZ : CRange_In[2] };
+
+
 // interpolation-scheme-dependent parameters
 // ===============================================================================
 // number of coarse-grid ghost zone
@@ -70,8 +81,12 @@ void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const i
 
    real *CPtr   = CData;
    real *FPtr   = FData;
-   real *TDataX = new real [ (CRange[2]+2*CGhost)*TdzX ];  // temporary array after x interpolation
-   real *TDataY = new real [ (CRange[2]+2*CGhost)*TdzY ];  // temporary array after y interpolation
+// temporary arrays after x and y interpolations (allocated on the stack in the specialized kernels)
+   const bool FixShape = INT_SPEC_FIX_SHAPE( CRX, CRY, CRZ );
+   real TDataX_Stack[ INT_SPEC_TSIZE_X( CRX, CRY, CRZ, CGhost ) ];
+   real TDataY_Stack[ INT_SPEC_TSIZE_Y( CRX, CRY, CRZ, CGhost ) ];
+   real *TDataX = ( FixShape ) ? TDataX_Stack : new real [ (CRange[2]+2*CGhost)*TdzX ];
+   real *TDataY = ( FixShape ) ? TDataY_Stack : new real [ (CRange[2]+2*CGhost)*TdzY ];
 
    int Idx_InL2, Idx_InL1, Idx_InC, Idx_InR1, Idx_InR2, Idx_Out;
    real LSlopeDh_4, RSlopeDh_4, SlopeDh_4, Sign, CDataMax, CDataMin;
@@ -79,6 +94,9 @@ void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const i
 
    for (int v=0; v<NComp; v++)
    {
+//    monotonicity of this component
+      const bool Mono = ( MONO == INT_SPEC_MONO_RUNTIME ) ? Monotonic[v] : ( MONO == INT_SPEC_MONO_YES );
+
 //    unwrap phase along x direction
 #     if ( MODEL == ELBDM )
       if ( UnwrapPhase )
@@ -113,7 +131,7 @@ void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const i
                                    R[3]*CPtr[Idx_InR1] + R[4]*CPtr[Idx_InR2];
 
 //       ensure monotonicity
-         if ( Monotonic[v] )
+         if ( Mono )
          {
             LSlopeDh_4 = CPtr[Idx_InC ] - CPtr[Idx_InL1];
             RSlopeDh_4 = CPtr[Idx_InR1] - CPtr[Idx_InC ];
@@ -155,7 +173,7 @@ void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const i
                TDataX[ Idx_Out       ] = CPtr[Idx_InC];
                TDataX[ Idx_Out + Tdx ] = CPtr[Idx_InC];
             } // if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 ) ... else
-         } // if ( Monotonic[v] )
+         } // if ( Mono )
 
          if ( OppSign0thOrder  &&  CPtr[Idx_InL1]*CPtr[Idx_InR1] < (real)0.0 )
          {
@@ -199,7 +217,7 @@ void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const i
                                    R[3]*TDataX[Idx_InR1] + R[4]*TDataX[Idx_InR2];
 
 //       ensure monotonicity
-         if ( Monotonic[v] )
+         if ( Mono )
          {
             LSlopeDh_4 = TDataX[Idx_InC ] - TDataX[Idx_InL1];
             RSlopeDh_4 = TDataX[Idx_InR1] - TDataX[Idx_InC ];
@@ -241,7 +259,7 @@ void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const i
                TDataY[ Idx_Out       ] = TDataX[Idx_InC];
                TDataY[ Idx_Out + Tdy ] = TDataX[Idx_InC];
             } // if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 ) ... else
-         } // if ( Monotonic[v] )
+         } // if ( Mono )
 
          if ( OppSign0thOrder  &&  TDataX[Idx_InL1]*TDataX[Idx_InR1] < (real)0.0 )
          {
@@ -285,7 +303,7 @@ void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const i
                                  R[3]*TDataY[Idx_InR1] + R[4]*TDataY[Idx_InR2];
 
 //       ensure monotonicity
-         if ( Monotonic[v] )
+         if ( Mono )
          {
             LSlopeDh_4 = TDataY[Idx_InC ] - TDataY[Idx_InL1];
             RSlopeDh_4 = TDataY[Idx_InR1] - TDataY[Idx_InC ];
@@ -327,7 +345,7 @@ void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const i
                FPtr[ Idx_Out       ] = TDataY[Idx_InC];
                FPtr[ Idx_Out + Fdz ] = TDataY[Idx_InC];
             } // if ( LSlopeDh_4*RSlopeDh_4 > (real)0.0 ) ... else
-         } // if ( Monotonic[v] )
+         } // if ( Mono )
 
          if ( OppSign0thOrder  &&  TDataY[Idx_InL1]*TDataY[Idx_InR1] < (real)0.0 )
          {
@@ -341,7 +359,37 @@ void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const i
 
    } // for (int v=0; v<NComp; v++)
 
-   delete [] TDataX;
-   delete [] TDataY;
+   if ( !FixShape )
+   {
+      delete [] TDataX;
+      delete [] TDataY;
+   }
+
+} // FUNCTION : Int_Quartic_Kernel
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_Quartic
+// Description :  Generic path of Int_Quartic_Kernel() with CRange[] and monotonicity determined at runtime
+//
+// Note        :  1. Invoked by Interpolate() for the shapes not listed in INT_SPEC_SHAPE_LIST
+//                2. Kernels specialized for the shapes in INT_SPEC_SHAPE_LIST are stored in Int_Quartic_Spec[][]
+//
+// Parameter   :  See Int_Quartic_Kernel()
+//-------------------------------------------------------------------------------------------------------
+void Int_Quartic( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                  real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                  const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff,
+                  const bool OppSign0thOrder )
+{
+
+   Int_Quartic_Kernel<0,0,0,INT_SPEC_MONO_RUNTIME>( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                                                    UnwrapPhase, Monotonic, MonoCoeff, OppSign0thOrder );
 
 } // FUNCTION : Int_Quartic
+
+
+
+// kernels specialized for the shapes in INT_SPEC_SHAPE_LIST
+IntSchemeFunc_t Int_Quartic_Spec[INT_SPEC_NSHAPE][2] = { INT_SPEC_SHAPE_LIST( INT_SPEC_KERNEL, Int_Quartic_Kernel ) };
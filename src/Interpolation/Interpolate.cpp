@@ -1,8 +1,14 @@
 #include "GAMER.h"
 #include "CUFLU.h"
+#include "Int_Specialized.h"
 
 
-static IntSchemeFunc_t Int_SelectScheme( const IntScheme_t IntScheme );
+static IntSchemeFunc_t  Int_SelectScheme( const IntScheme_t IntScheme );
+static IntSchemeFunc_t *Int_SelectSpecScheme( const IntScheme_t IntScheme, const int CRange[3] );
+static void Int_Dispatch( const IntScheme_t IntScheme, IntSchemeFunc_t IntSchemeFunc,
+                          real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                          real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                          const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff, const bool OppSign0thOrder );
 
 #if ( MODEL == HYDRO )
 static void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
@@ -40,6 +46,15 @@ void Int_Spectral  ( real CData[], const int CSize[3], const int CStart[3], cons
                      const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff, const bool OppSign0thOrder );
 #endif
 
+// kernels specialized for the shapes in INT_SPEC_SHAPE_LIST
+extern IntSchemeFunc_t Int_MinMod1D_Spec  [INT_SPEC_NSHAPE][2];
+extern IntSchemeFunc_t Int_MinMod3D_Spec  [INT_SPEC_NSHAPE][2];
+extern IntSchemeFunc_t Int_vanLeer_Spec   [INT_SPEC_NSHAPE][2];
+extern IntSchemeFunc_t Int_CQuadratic_Spec[INT_SPEC_NSHAPE][2];
+extern IntSchemeFunc_t Int_Quadratic_Spec [INT_SPEC_NSHAPE][2];
+extern IntSchemeFunc_t Int_CQuartic_Spec  [INT_SPEC_NSHAPE][2];
+extern IntSchemeFunc_t Int_Quartic_Spec   [INT_SPEC_NSHAPE][2];
+
 
 
 
@@ -51,6 +66,8 @@ void Int_Spectral  ( real CData[], const int CSize[3], const int CStart[3], cons
 //                2. CData[] may be overwritten
 //                3. Switch to Interpolate_Iterate() when enabling ReduceMonoCoeff
 //                   --> Only applicable for HYDRO with AllCons==true
+//                4. Use the compile-time specialized kernels for the coarse-grid shapes in INT_SPEC_SHAPE_LIST
+//                   --> See Int_Dispatch() and Int_Specialized.h
 //
 // Parameter   :  CData           : Input coarse-grid array (which may be overwritten)
 //                CSize           : Size of CData[]
@@ -164,8 +181,8 @@ void Interpolate( real CData[], const int CSize[3], const int CStart[3], const i
 #     endif
 
 //    perform interpolation
-      IntSchemeFunc( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
-                     UnwrapPhase, Monotonic, INT_MONO_COEFF, OppSign0thOrder );
+      Int_Dispatch( IntScheme, IntSchemeFunc, CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                    UnwrapPhase, Monotonic, INT_MONO_COEFF, OppSign0thOrder );
    }
 
 } // FUNCTION : Interpolate
@@ -200,6 +217,13 @@ void Interpolate( real CData[], const int CSize[3], const int CStart[3], const i
 //                5. CData[] may be overwritten
 //                6. Only applicable for HYDRO
 //                7. When enabling INTERP_MASK (in Macro.h), only iterate on cells with unphysical results
+//                8. When enabling INTERP_MASK_LOCAL (in Macro.h), only recompute the coarse cells with unphysical
+//                   results after the first iteration
+//                   --> Interpolate one coarse cell at a time (i.e., CRange[]={1,1,1}) instead of the entire block
+//                   --> Only convert the coarse cells within the stencils of these cells to primitive variables
+//                       when enabling IntPrim
+//                   --> Results are the same as recomputing the entire block since the interpolation result of each
+//                       fine cell depends only on the stencil of its parent coarse cell
 //
 // Parameter   :  See Interpolate()
 //
@@ -218,6 +242,12 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
    for (int d=0; d<3; d++)
       if ( FStart[d] != 0 )   Aux_Error( ERROR_INFO, "FStart[%d] = %d != 0 !!\n", d, FStart[d] );
 
+#  ifdef INTERP_MASK_LOCAL
+   for (int d=0; d<3; d++)
+      if ( FSize[d] != 2*CRange[d] )
+         Aux_Error( ERROR_INFO, "FSize[%d] (%d) != 2*CRange[%d] (%d) for INTERP_MASK_LOCAL !!\n", d, FSize[d], d, 2*CRange[d] );
+#  endif
+
 
    const int  CSize3D         = CSize[0]*CSize[1]*CSize[2];
    const int  FSize3D         = FSize[0]*FSize[1]*FSize[2];
@@ -245,6 +275,18 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
    for (int i=0; i<FSize3D; i++)    Mask[i] = UNMASKED;
 #  endif
 
+#  ifdef INTERP_MASK_LOCAL
+// FailCell: relative indices (with respect to CStart[]) of the coarse cells with unphysical results
+// CMask   : coarse cells within the stencils of FailCell[]
+   const int CRange1[3] = { 1, 1, 1 };
+   int NSide_Useless, CGhost;
+   Int_Table( IntScheme, NSide_Useless, CGhost );
+
+   int   NFailCell = 0;
+   int (*FailCell)[3] = new int [ CRange[0]*CRange[1]*CRange[2] ][3];
+   bool *CMask        = ( IntPrim ) ? new bool [CSize3D] : NULL;
+#  endif
+
 
 // start iterations
    Iteration = 0;
@@ -261,9 +303,30 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
 //    2. interpolate primitive variables with the original monotonic coefficient
       else if ( Iteration == 1  &&  IntPrim )
       {
+//       only convert the coarse cells within the stencils of the failed cells
+#        ifdef INTERP_MASK_LOCAL
+         for (int i=0; i<CSize3D; i++)    CMask[i] = UNMASKED;
+
+         for (int t=0; t<NFailCell; t++)
+         {
+            const int i0 = CStart[0] + FailCell[t][0];
+            const int j0 = CStart[1] + FailCell[t][1];
+            const int k0 = CStart[2] + FailCell[t][2];
+
+            for (int k=k0-CGhost; k<=k0+CGhost; k++)
+            for (int j=j0-CGhost; j<=j0+CGhost; j++)
+            for (int i=i0-CGhost; i<=i0+CGhost; i++)
+               CMask[ IDX321( i, j, k, CSize[0], CSize[1] ) ] = MASKED;
+         }
+#        endif
+
 //       conserved --> primitive
          for (int i=0; i<CSize3D; i++)
          {
+#           ifdef INTERP_MASK_LOCAL
+            if ( CMask[i] == UNMASKED )   continue;
+#           endif
+
 //          assuming **all** elements of CData[] and CMag[] are filled in (i.e., no unused cells)
             for (int v=0; v<NCOMP_TOTAL; v++)   Cons[v] = CData[ CSize3D*v + i ];
 #           ifdef MHD
@@ -308,8 +371,24 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
 
 
 //    4. perform interpolation
-      IntSchemeFunc( CData, CSize, CStart, CRange, FData_tmp, FSize, FStart, NComp,
-                     UnwrapPhase, Monotonic, IntMonoCoeff, OppSign0thOrder );
+#     ifdef INTERP_MASK_LOCAL
+//    only recompute the failed coarse cells after the first iteration
+      if ( Iteration > 0 )
+      {
+         for (int t=0; t<NFailCell; t++)
+         {
+            const int CStart1[3] = { CStart[0]+FailCell[t][0], CStart[1]+FailCell[t][1], CStart[2]+FailCell[t][2] };
+            const int FStart1[3] = { 2*FailCell[t][0], 2*FailCell[t][1], 2*FailCell[t][2] };
+
+            Int_Dispatch( IntScheme, IntSchemeFunc, CData, CSize, CStart1, CRange1, FData_tmp, FSize, FStart1, NComp,
+                          UnwrapPhase, Monotonic, IntMonoCoeff, OppSign0thOrder );
+         }
+      }
+
+      else
+#     endif
+      Int_Dispatch( IntScheme, IntSchemeFunc, CData, CSize, CStart, CRange, FData_tmp, FSize, FStart, NComp,
+                    UnwrapPhase, Monotonic, IntMonoCoeff, OppSign0thOrder );
 
 
       Fail_AnyCell = false;
@@ -505,6 +584,10 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
          typedef bool (*vla)[ FSize[1] ][ FSize[0] ];
          vla Mask3D = ( vla )Mask;
 
+#        ifdef INTERP_MASK_LOCAL
+         NFailCell = 0;
+#        endif
+
          for (int k=0; k<FSize[2]; k+=2)  {  const int kp = k+1;
          for (int j=0; j<FSize[1]; j+=2)  {  const int jp = j+1;
          for (int i=0; i<FSize[0]; i+=2)  {  const int ip = i+1;
@@ -526,6 +609,14 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
                Mask3D[kp][jp][i ] = UNMASKED;
                Mask3D[kp][j ][ip] = UNMASKED;
                Mask3D[kp][jp][ip] = UNMASKED;
+
+//             record the parent cell
+#              ifdef INTERP_MASK_LOCAL
+               FailCell[NFailCell][0] = i/2;
+               FailCell[NFailCell][1] = j/2;
+               FailCell[NFailCell][2] = k/2;
+               NFailCell ++;
+#              endif
             }
          }}}
 #        endif // #ifdef INTERP_MASK
@@ -556,6 +647,10 @@ void Interpolate_Iterate( real CData[], const int CSize[3], const int CStart[3],
 #  ifdef INTERP_MASK
    delete [] Mask;
 #  endif
+#  ifdef INTERP_MASK_LOCAL
+   delete [] FailCell;
+   delete [] CMask;
+#  endif
 
 } // FUNCTION : Interpolate_Iterate
 #endif // #if ( MODEL == HYDRO )
@@ -606,3 +701,112 @@ static IntSchemeFunc_t Int_SelectScheme( const IntScheme_t IntScheme )
    return NULL;
 
 } // FUNCTION : Int_SelectScheme
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_SelectSpecScheme
+// Description :  Select the compile-time specialized kernels of a spatial interpolation scheme
+//
+// Note        :  1. Look up the shape table INT_SPEC_SHAPE_LIST with CRange[]
+//                   --> See Int_Specialized.h
+//                2. Spectral interpolation does not have specialized kernels
+//
+// Parameter   :  IntScheme : Interpolation scheme
+//                CRange    : Number of coarse cells along each direction to perform interpolation
+//
+// Return      :  Int_XXX_Spec[ShapeIdx] (i.e., kernels without/with the monotonicity constraint)
+//                --> NULL if IntScheme or CRange[] is not supported
+//-------------------------------------------------------------------------------------------------------
+static IntSchemeFunc_t *Int_SelectSpecScheme( const IntScheme_t IntScheme, const int CRange[3] )
+{
+
+   static const int Shape[INT_SPEC_NSHAPE][3] = { INT_SPEC_SHAPE_LIST( INT_SPEC_SHAPE, NoFunc ) };
+
+   int ShapeIdx = -1;
+
+   for (int s=0; s<INT_SPEC_NSHAPE; s++)
+   {
+      if ( CRange[0] == Shape[s][0]  &&  CRange[1] == Shape[s][1]  &&  CRange[2] == Shape[s][2] )
+      {
+         ShapeIdx = s;
+         break;
+      }
+   }
+
+   if ( ShapeIdx == -1 )   return NULL;
+
+   switch ( IntScheme )
+   {
+      case INT_MINMOD3D :  return Int_MinMod3D_Spec  [ShapeIdx];   break;
+      case INT_MINMOD1D :  return Int_MinMod1D_Spec  [ShapeIdx];   break;
+      case INT_VANLEER  :  return Int_vanLeer_Spec   [ShapeIdx];   break;
+      case INT_CQUAD    :  return Int_CQuadratic_Spec[ShapeIdx];   break;
+      case INT_QUAD     :  return Int_Quadratic_Spec [ShapeIdx];   break;
+      case INT_CQUAR    :  return Int_CQuartic_Spec  [ShapeIdx];   break;
+      case INT_QUAR     :  return Int_Quartic_Spec   [ShapeIdx];   break;
+      default           :  return NULL;
+   }
+
+   return NULL;
+
+} // FUNCTION : Int_SelectSpecScheme
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Int_Dispatch
+// Description :  Invoke either the compile-time specialized kernels or the generic path of a spatial
+//                interpolation scheme
+//
+// Note        :  1. Use the specialized kernels returned by Int_SelectSpecScheme() when available and
+//                   fall back to IntSchemeFunc() otherwise
+//                2. Specialized kernels have compile-time monotonicity
+//                   --> Consecutive components with the same Monotonic[] are interpolated together
+//                   --> MinMod-3D, MinMod-1D, and vanLeer do not use Monotonic[] and interpolate all
+//                       components at once
+//                3. Components are interpolated independently, so the results are the same as the generic path
+//
+// Parameter   :  IntScheme     : Interpolation scheme
+//                IntSchemeFunc : Generic path returned by Int_SelectScheme()
+//                Others        : See Interpolate()
+//
+// Return      :  FData[]
+//-------------------------------------------------------------------------------------------------------
+static void Int_Dispatch( const IntScheme_t IntScheme, IntSchemeFunc_t IntSchemeFunc,
+                          real CData[], const int CSize[3], const int CStart[3], const int CRange[3],
+                          real FData[], const int FSize[3], const int FStart[3], const int NComp,
+                          const bool UnwrapPhase, const bool Monotonic[], const real MonoCoeff, const bool OppSign0thOrder )
+{
+
+   IntSchemeFunc_t *SpecFunc = Int_SelectSpecScheme( IntScheme, CRange );
+
+// 1. generic path
+   if ( SpecFunc == NULL )
+   {
+      IntSchemeFunc( CData, CSize, CStart, CRange, FData, FSize, FStart, NComp,
+                     UnwrapPhase, Monotonic, MonoCoeff, OppSign0thOrder );
+      return;
+   }
+
+
+// 2. specialized kernels
+   const bool UseMono = ( IntScheme != INT_MINMOD3D  &&  IntScheme != INT_MINMOD1D  &&  IntScheme != INT_VANLEER );
+   const long CSize3D = (long)CSize[0]*CSize[1]*CSize[2];
+   const long FSize3D = (long)FSize[0]*FSize[1]*FSize[2];
+
+   int v1;
+
+   for (int v0=0; v0<NComp; v0=v1)
+   {
+//    find the components [v0 ... v1-1] with the same monotonicity
+      const bool Mono = ( UseMono ) ? Monotonic[v0] : false;
+
+      for (v1=v0+1; v1<NComp; v1++)
+         if ( UseMono  &&  Monotonic[v1] != Mono )    break;
+
+      SpecFunc[ (Mono)?1:0 ]( CData+v0*CSize3D, CSize, CStart, CRange, FData+v0*FSize3D, FSize, FStart, v1-v0,
+                              UnwrapPhase, Monotonic+v0, MonoCoeff, OppSign0thOrder );
+   }
+
+} // FUNCTION : Int_Dispatch
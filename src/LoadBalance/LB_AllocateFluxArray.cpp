@@ -10,9 +10,10 @@
 // Description :  Prepare for transferring fluxes on the coarse-fine boundaries
 //
 // Note        :  1. Procedure:
-//                   (1) Allocate flux arrays for the real patches at FaLv adjacent to the coarse-fine boundaries
+//                   (1) Record the faces of the real patches at FaLv adjacent to the coarse-fine boundaries
 //                   (2) Construct the MPI send and recv lists for exchanging fluxes at FaLv
-//                   (3) According to the send list, allocate flux arrays for the buffer patches at FaLv
+//                   (3) According to the send list, record the faces of the buffer patches at FaLv
+//                   (4) Allocate flux arrays for all recorded faces in the flux register amr->FluxReg[FaLv]
 //                2. Invoked by LB_Init_LoadBalance() and LB_Refine()
 //
 // Parameter   :  FaLv : Coarse-grid level
@@ -60,13 +61,15 @@ void LB_AllocateFluxArray( const int FaLv )
    }
 
 
-// 1. deallocate the flux arrays allocated previously
+// 1. detach the flux arrays allocated previously
 // ============================================================================================================
 #  pragma omp parallel for schedule( runtime )
    for (int FaPID=0; FaPID<amr->NPatchComma[FaLv][3]; FaPID++)  amr->patch[0][FaLv][FaPID]->fdelete();
 
+   amr->FluxReg[FaLv].Reset();
 
-// 2. allocate flux arrays for the real patches and record the unsorted recv list
+
+// 2. record the faces of the real patches and the unsorted recv list
 // ============================================================================================================
    if ( NPatchTotal[SonLv] != 0 )
    {
@@ -86,8 +89,8 @@ void LB_AllocateFluxArray( const int FaLv )
 
                   if ( SibSonPID != -1 )
                   {
-//                   allocate flux array
-                     amr->patch[0][FaLv][FaPID]->fnew( Sib, AUTO_REDUCE_DT );
+//                   record the face
+                     amr->FluxReg[FaLv].AddFace( FaPID, Sib );
 
 //                   record the MPI recv list
                      if ( SibSonPID < -1 )   // son is not home
@@ -205,7 +208,7 @@ void LB_AllocateFluxArray( const int FaLv )
                   RecvBuf_LBIdx, LB_SendF_NList, Recv_Disp_F, MPI_LONG, MPI_COMM_WORLD );
 
 
-// 5. construct the send list and allocate flux arrays for the buffer patches
+// 5. construct the send list and record the faces of the buffer patches
 // ============================================================================================================
    const int MirrorSib[6] = { 1,0,3,2,5,4 };
    int TPID, TSib, MSib, *Match_F=NULL, *RecvPtr=NULL;
@@ -236,7 +239,7 @@ void LB_AllocateFluxArray( const int FaLv )
                        FaLv, r, *(RecvBuf_LBIdx+Recv_Disp_F[r]+t) );
 #     endif
 
-//    5.4 store the send patch indices and allocate flux arrays
+//    5.4 store the send patch indices and record the faces
       for (int t=0; t<LB_SendF_NList[r]; t++)
       {
          TSib      = LB_SendF_SibList[r][t];
@@ -267,8 +270,8 @@ void LB_AllocateFluxArray( const int FaLv )
 //       record send PID
          LB_SendF_IDList[r][t] = TPID;
 
-//       allocate flux array
-         amr->patch[0][FaLv][TPID]->fnew( TSib, AUTO_REDUCE_DT );
+//       record the face
+         amr->FluxReg[FaLv].AddFace( TPID, TSib );
 
       } // for (int t=0; t<LB_SendF_NList[FaLv][r]; t++)
 
@@ -289,6 +292,11 @@ void LB_AllocateFluxArray( const int FaLv )
    delete [] SendBuf_LBIdx;
    delete [] RecvBuf_LBIdx;
 
+
+// 6. allocate flux arrays for all faces
+// ============================================================================================================
+   amr->FluxReg[FaLv].Build( amr->patch[0][FaLv], FaNReal, AUTO_REDUCE_DT );
+
 } // LB_AllocateFluxArray
 
 
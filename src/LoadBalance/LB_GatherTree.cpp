@@ -772,8 +772,11 @@ LB_GlobalPatch* LB_GatherTree( LB_PatchCount& pc, int root ) {
 
 LB_GlobalTree::LB_GlobalTree(int root) : PatchCount(), Patches(NULL)
 {
+   static long NConstructed = 0;
+
    Patches = LB_GatherTree(PatchCount, root);
    NPatch  = PatchCount.NPatchAllLv;
+   Version = ++NConstructed;
 }
 
 LB_GlobalTree::~LB_GlobalTree()
@@ -1038,3 +1041,17 @@ long LB_GlobalTree::PID2GID(const int PID, const int lv) const
       return -1;
    }
 } // FUNCTION : LB_GlobalTree::PID2GID
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LB_GlobalTree::GetVersion
+// Description :  Return the unique ID of this tree
+//
+// Note        :  1. Different LB_GlobalTree objects constructed during the same run always have different IDs
+//                   --> Used for detecting whether the data derived from a previous tree are outdated
+//                       (e.g., the cache in ELBDM_PrepareWaveCounterpart())
+//
+// Return      :  Version
+//-------------------------------------------------------------------------------------------------------
+long LB_GlobalTree::GetVersion() const
+{
+   return Version;
+} // FUNCTION : LB_GlobalTree::GetVersion
@@ -175,6 +175,11 @@ void LB_Init_LoadBalance( const bool Redistribute, const bool SendGridData, cons
    if ( Redistribute  &&  TLv < 0 )    LB_RedistributeParticle_End( ParAttFlt_Old, ParAttInt_Old );
 #  endif
 
+// repack the field arrays of all patches in the order of PID for OPT__PATCH_SLAB
+// --> must be done after allocating all buffer patches since step 3.5 also allocates patches at lv-1
+   if ( OPT__PATCH_SLAB )
+   for (int lv=lv_min; lv<=lv_max; lv++)  Mis_PatchSlab_Repack( lv );
+
 
 // 4. contruct the patch relation
    const bool ResetSonID_Yes = true;
@@ -869,6 +874,11 @@ void LB_RedistributeRealPatch( const int lv, real_par **ParAttFlt_Old, long_par
          amr->patch[0][lv][PID]->AddParticle( RecvBuf_NPar[PID], ParList, &amr->Par->NPar_Lv[lv],
                                               PType );
 #        endif
+
+//       sort particles for bitwise reproducibility
+#        ifdef BITWISE_REPRODUCIBILITY
+         Par_SortParList( lv, PID );
+#        endif
 #        endif // #ifdef PARTICLE
       } // for (int LocalID=0; LocalID<8; LocalID++)
    } // for (int PID0=0; PID0<NRecv_Total_Patch; PID0+=8)
@@ -524,7 +524,25 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
 
 // *********************************
-//    6-2. Grackle cooling/heating
+//    6-2. cosmic-ray diffusion
+// *********************************
+#     ifdef CR_DIFFUSION
+      if ( CR_DIFF_RKL2 )
+      {
+         if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+            Aux_Message( stdout, "   Lv %2d: CR_Diff_AdvanceDt, counter = %4ld ... ", lv, AdvanceCounter[lv] );
+
+//       reuse the timer Timer_Src_Advance[lv] for now
+         TIMING_FUNC(   CR_Diff_AdvanceDt( lv, TimeNew, TimeOld, dt_SubStep, SaveSg_Flu, SaveSg_Mag ),
+                        Timer_Src_Advance[lv],   TIMER_ON   );
+
+         if ( OPT__VERBOSE  &&  MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
+      } // if ( CR_DIFF_RKL2 )
+#     endif // #ifdef CR_DIFFUSION
+
+
+// *********************************
+//    6-3. Grackle cooling/heating
 // *********************************
 #     ifdef SUPPORT_GRACKLE
       if ( GRACKLE_ACTIVATE )
@@ -544,7 +562,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
 
 // *********************************
-//    6-3. star formation
+//    6-4. star formation
 // *********************************
 #     ifdef PARTICLE
 //    pass particles to the children patches here if OPT__MINIMIZE_MPI_BARRIER is adopted
@@ -578,7 +596,7 @@ void EvolveLevel( const int lv, const double dTime_FaLv )
 
 
 // *********************************
-//    6-4. feedback
+//    6-5. feedback
 // *********************************
 #     ifdef FEEDBACK
       const int SaveSg_FBFlu = SaveSg_Flu;   // save in the same Flu/MagSg
@@ -5,7 +5,12 @@ static void Preparation_Step( const Solver_t TSolver, const int lv, const double
 static void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const double TimeOld,
                     const int NPG, const int ArrayID, const double dt, const double Poi_Coeff );
 static void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                          const int NPG, const int *PID0_List, const int ArrayID, const double dt );
+                          const int NPG, const int *PID0_List, const int ArrayID, const double TimeOld, const double dt );
+void Flu_InitSingleSandglass( const int lv, const int NTotal, const int *PID0_List, const int NPG_Max,
+                              const bool OverlapMPI );
+void Flu_UpdateSingleSandglass( const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int NPrepBatch,
+                                const int NPG, const int *PID0_List );
+void Flu_EndSingleSandglass( const int lv, const int SaveSg_Flu, const int SaveSg_Mag );
 
 extern Timer_t *Timer_Pre         [NLEVEL][NSOLVER];
 extern Timer_t *Timer_Sol         [NLEVEL][NSOLVER];
@@ -33,6 +38,9 @@ extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 //                   the input data
 //                4. For LOAD_BALANCE, one can turn on the option "OPT__OVERLAP_MPI" to enable the
 //                   overlapping between MPI communication and CPU/GPU computation
+//                5. For OPT__SINGLE_SANDGLASS, the fluid solver releases the old data no longer required and
+//                   allocates the arrays for the updated data before each closing step
+//                   --> See Flu_ManageSingleSandglass.cpp
 //
 // Parameter   :  TSolver      : Target solver
 //                               --> FLUID_SOLVER               : Fluid / ELBDM solver
@@ -43,6 +51,7 @@ extern Timer_t *Timer_Poi_PrePot_F[NLEVEL];
 //                                   DT_FLU_SOLVER              : dt solver for fluid
 //                                   DT_GRA_SOLVER              : dt solver for gravity
 //                                   SRC_SOLVER                 : source-term solver
+//                                   CR_DIFF_SOLVER             : RKL2 cosmic-ray diffusion solver
 //                lv           : Target refinement level
 //                TimeNew      : Target physical time to reach
 //                TimeOld      : Physical time before update
@@ -100,6 +109,12 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
    if ( TSolver == SRC_SOLVER  &&  ( SaveSg_Flu != 0 &&  SaveSg_Flu != 1 )  )
       Aux_Error( ERROR_INFO, "incorrect SaveSg_Flu (%d) for the solver %d !!\n", SaveSg_Flu, TSolver );
 
+#  ifdef CR_DIFFUSION
+   if ( TSolver == CR_DIFF_SOLVER  &&  SaveSg_Flu != amr->FluSg[lv] )
+      Aux_Error( ERROR_INFO, "SaveSg_Flu (%d) != amr->FluSg (%d) in the RKL2 cosmic-ray diffusion solver at level %d !!\n",
+                 SaveSg_Flu, amr->FluSg[lv], lv );
+#  endif
+
 
 // reset the time-step actually adopted to zero for OPT__FREEZE_FLUID
 #  ifdef SUPPORT_GRACKLE
@@ -135,6 +150,11 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
       case SRC_SOLVER:                 NPG_Max = SRC_GPU_NPGROUP;    break;
 
+#     ifdef CR_DIFFUSION
+//    currently we use FLU_GPU_NPGROUP for the RKL2 cosmic-ray diffusion solver
+      case CR_DIFF_SOLVER:             NPG_Max = FLU_GPU_NPGROUP;    break;
+#     endif
+
       default :
          Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TSolver", TSolver );
    }
@@ -203,6 +223,10 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
    MPI_Allreduce( &NTotal, &NTotal_Max, 1, MPI_INT, MPI_MAX, MPI_COMM_WORLD );
 
+   const bool SingleSg = ( TSolver == FLUID_SOLVER  &&  OPT__SINGLE_SANDGLASS );
+
+   if ( SingleSg )   Flu_InitSingleSandglass( lv, NTotal, PID0_List, NPG_Max, OverlapMPI );
+
 
 // evaluate time evolution matrix (once per level per timestep)
 #  if ( GRAMFE_SCHEME == GRAMFE_MATMUL )
@@ -254,8 +278,11 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
+      if ( SingleSg )
+      Flu_UpdateSingleSandglass( lv, SaveSg_Flu, SaveSg_Mag, Disp/NPG_Max+1, NPG[1-ArrayID], PID0_List+Disp-NPG_Max );
+
       TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, dt ),
+                     NPG[1-ArrayID], PID0_List+Disp-NPG_Max, 1-ArrayID, TimeOld, dt ),
                      Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
@@ -270,11 +297,16 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 
 
 //-------------------------------------------------------------------------------------------------------------
+   if ( SingleSg )
+   Flu_UpdateSingleSandglass( lv, SaveSg_Flu, SaveSg_Mag, __INT_MAX__, NPG[ArrayID], PID0_List+Disp-NPG_Max );
+
    TIMING_SYNC(   Closing_Step( TSolver, lv, SaveSg_Flu, SaveSg_Mag, SaveSg_Pot,
-                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, dt ),
+                  NPG[ArrayID], PID0_List+Disp-NPG_Max, ArrayID, TimeOld, dt ),
                   Timer_Clo[lv][TSolver]  );
 //-------------------------------------------------------------------------------------------------------------
 
+   if ( SingleSg )   Flu_EndSingleSandglass( lv, SaveSg_Flu, SaveSg_Mag );
+
 
    if ( AllocateList )  delete [] PID0_List;
 
@@ -297,6 +329,7 @@ void InvokeSolver( const Solver_t TSolver, const int lv, const double TimeNew, c
 //                                DT_FLU_SOLVER              : dt solver for fluid
 //                                DT_GRA_SOLVER              : dt solver for gravity
 //                                SRC_SOLVER                 : source-term solver
+//                                CR_DIFF_SOLVER             : RKL2 cosmic-ray diffusion solver
 //                lv        : Target refinement level
 //                TimeNew   : Target physical time to reach
 //                TimeOld   : Physical time before update
@@ -435,6 +468,12 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
                       NPG, PID0_List );
       break;
 
+#     ifdef CR_DIFFUSION
+      case CR_DIFF_SOLVER :
+         CR_Diff_Prepare( lv, TimeNew, h_CR_Diff_Array_In[ArrayID], h_CR_Diff_Mag_In[ArrayID], NPG, PID0_List );
+      break;
+#     endif
+
       default :
          Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TSolver", TSolver );
 
@@ -459,6 +498,7 @@ void Preparation_Step( const Solver_t TSolver, const int lv, const double TimeNe
 //                                DT_FLU_SOLVER              : dt solver for fluid
 //                                DT_GRA_SOLVER              : dt solver for gravity
 //                                SRC_SOLVER                 : source-term solver
+//                                CR_DIFF_SOLVER             : RKL2 cosmic-ray diffusion solver
 //                lv        : Target refinement level
 //                TimeNew   : Target physical time to reach (for external gravity)
 //                TimeOld   : Physical time before update   (for external gravity with UNSPLIT_GRAVITY)
@@ -778,6 +818,17 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
       break;
 
 
+#     ifdef CR_DIFFUSION
+//    the RKL2 cosmic-ray diffusion solver is only supported by CPU
+      case CR_DIFF_SOLVER :
+         CPU_CR_DiffusionSolver( h_CR_Diff_Array_In [ArrayID],
+                                 h_CR_Diff_Mag_In   [ArrayID],
+                                 h_CR_Diff_Array_Out[ArrayID],
+                                 NPG, dh, MicroPhy );
+      break;
+#     endif
+
+
       default :
          Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TSolver", TSolver );
 
@@ -802,6 +853,7 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 //                                 DT_FLU_SOLVER              : dt solver for fluid
 //                                 DT_GRA_SOLVER              : dt solver for gravity
 //                                 SRC_SOLVER                 : source-term solver
+//                                 CR_DIFF_SOLVER             : RKL2 cosmic-ray diffusion solver
 //                lv         : Target refinement level
 //                SaveSg_Flu : Sandglass to store the updated fluid data (for both the fluid, gravity, and Grackle solvers)
 //                SaveSg_Mag : Sandglass to store the updated B field (for the fluid solver)
@@ -809,10 +861,12 @@ void Solver( const Solver_t TSolver, const int lv, const double TimeNew, const d
 //                NPG        : Number of patch groups to be evaluated at a time
 //                PID0_List  : List recording the patch indices with LocalID==0 to be udpated
 //                ArrayID    : Array index to load and store data ( 0 or 1 )
-//                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR in Flu_Close())
+//                TimeOld    : Physical time before update (for AUTO_REDUCE_DT_LOCAL in Flu_Close())
+//                dt         : Time interval to advance solution (for OPT__1ST_FLUX_CORR and AUTO_REDUCE_DT_LOCAL
+//                             in Flu_Close())
 //-------------------------------------------------------------------------------------------------------
 void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, const int SaveSg_Mag, const int SaveSg_Pot,
-                   const int NPG, const int *PID0_List, const int ArrayID, const double dt )
+                   const int NPG, const int *PID0_List, const int ArrayID, const double TimeOld, const double dt )
 {
 
 #  ifndef DUAL_ENERGY
@@ -823,6 +877,9 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
    real (*h_Mag_Array_F_Out[2])[NCOMP_MAG][ PS2P1*SQR(PS2) ]          = { NULL, NULL };
    real (*h_Ele_Array      [2])[9][NCOMP_ELE][ PS2P1*PS2 ]            = { NULL, NULL };
 #  endif
+#  ifndef UNSPLIT_GRAVITY
+   real (*h_Pot_Array_USG_F[2])[ CUBE(USG_NXT_F) ]                    = { NULL, NULL };
+#  endif
 #  if ( defined GRAVITY  &&  !defined DUAL_ENERGY )
    char (*h_DE_Array_G     [2])[PS1][PS1][PS1]                        = { NULL, NULL };
 #  endif
@@ -835,7 +892,8 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
       case FLUID_SOLVER :
          Flu_Close( lv, SaveSg_Flu, SaveSg_Mag, h_Flux_Array[ArrayID], h_Ele_Array[ArrayID],
                     h_Flu_Array_F_Out[ArrayID], h_Mag_Array_F_Out[ArrayID], h_DE_Array_F_Out[ArrayID],
-                    NPG, PID0_List, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID], dt );
+                    NPG, PID0_List, h_Flu_Array_F_In[ArrayID], h_Mag_Array_F_In[ArrayID],
+                    h_Corner_Array_F[ArrayID], h_Pot_Array_USG_F[ArrayID], TimeOld, dt );
       break;
 
 #     ifdef GRAVITY
@@ -875,6 +933,12 @@ void Closing_Step( const Solver_t TSolver, const int lv, const int SaveSg_Flu, c
          Src_Close( lv, SaveSg_Flu, h_Flu_Array_S_Out[ArrayID], NPG, PID0_List );
       break;
 
+#     ifdef CR_DIFFUSION
+      case CR_DIFF_SOLVER :
+         CR_Diff_Close( lv, h_CR_Diff_Array_Out[ArrayID], NPG, PID0_List );
+      break;
+#     endif
+
       default:
          Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "TSolver", TSolver );
 
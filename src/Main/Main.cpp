@@ -59,15 +59,16 @@ double               OUTPUT_PART_X, OUTPUT_PART_Y, OUTPUT_PART_Z, AUTO_REDUCE_DT
 double               AUTO_REDUCE_INT_MONO_FACTOR, AUTO_REDUCE_INT_MONO_MIN;
 double               OPT__CK_MEMFREE, INT_MONO_COEFF, UNIT_L, UNIT_M, UNIT_T, UNIT_V, UNIT_D, UNIT_E, UNIT_P;
 int                  OPT__UM_IC_LEVEL, OPT__UM_IC_NLEVEL, OPT__UM_IC_NVAR, OPT__UM_IC_LOAD_NRANK, OPT__GPUID_SELECT, OPT__PATCH_COUNT;
-int                  INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK;
+int                  INIT_DUMPID, INIT_SUBSAMPLING_NCELL, OPT__TIMING_BARRIER, OPT__REUSE_MEMORY, RESTART_LOAD_NRANK, OUTPUT_PART_PROJ_LV;
 bool                 OPT__FLAG_RHO, OPT__FLAG_RHO_GRADIENT, OPT__FLAG_USER, OPT__FLAG_LOHNER_DENS, OPT__FLAG_REGION, OPT__FLAG_ANGULAR, OPT__FLAG_RADIAL;
 int                  OPT__FLAG_USER_NUM, MONO_MAX_ITER, OPT__RESET_FLUID_INIT;
-bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__MEMORY_POOL, OPT__RESTART_RESET;
+bool                 OPT__DT_USER, OPT__RECORD_DT, OPT__RECORD_MEMORY, OPT__RESTART_RESET;
+bool                 OPT__SINGLE_SANDGLASS, OPT__PATCH_SLAB;
 bool                 OPT__FIXUP_RESTRICT, OPT__INIT_RESTRICT, OPT__VERBOSE, OPT__MANUAL_CONTROL, OPT__UNIT;
 bool                 OPT__INT_TIME, OPT__OUTPUT_USER, OPT__OUTPUT_BASE, OPT__OUTPUT_RESTART, OPT__OVERLAP_MPI, OPT__TIMING_BALANCE;
 bool                 OPT__OUTPUT_BASEPS, OPT__CK_REFINE, OPT__CK_PROPER_NESTING, OPT__CK_FINITE, OPT__RECORD_PERFORMANCE;
 bool                 OPT__CK_RESTRICT, OPT__CK_PATCH_ALLOCATE, OPT__FIXUP_FLUX, OPT__CK_FLUX_ALLOCATE, OPT__CK_NORMALIZE_PASSIVE;
-bool                 OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__TIMING_MPI;
+bool                 OPT__UM_IC_DOWNGRADE, OPT__UM_IC_REFINE, OPT__UM_IC_MMAP, OPT__TIMING_MPI;
 bool                 OPT__CK_CONSERVATION, OPT__RESET_FLUID, OPT__FREEZE_FLUID, OPT__RECORD_CENTER, OPT__RECORD_USER, OPT__NORMALIZE_PASSIVE, AUTO_REDUCE_DT;
 bool                 OPT__OPTIMIZE_AGGRESSIVE, OPT__INIT_GRID_WITH_OMP, OPT__NO_FLAG_NEAR_BOUNDARY;
 bool                 OPT__RECORD_NOTE, OPT__RECORD_UNPHY, INT_OPP_SIGN_0TH_ORDER;
@@ -87,11 +88,13 @@ TestProbID_t         TESTPROB_ID;
 OptInit_t            OPT__INIT;
 OptOutputFormat_t    OPT__OUTPUT_TOTAL;
 OptOutputPart_t      OPT__OUTPUT_PART;
+OptOutputPartFormat_t OPT__OUTPUT_PART_FORMAT;
 OptOutputMode_t      OPT__OUTPUT_MODE;
 OptFluBC_t           OPT__BC_FLU[6];
 OptLohnerForm_t      OPT__FLAG_LOHNER_FORM;
 OptCorrAfterSync_t   OPT__CORR_AFTER_ALL_SYNC;
 OptTimeStepLevel_t   OPT__DT_LEVEL;
+OptMemPool_t         OPT__MEMORY_POOL;
 
 bool                 ConRefInitialized = false;
 double               ConRef[1+NCONREF_MAX]; // time + conserved variables
@@ -107,7 +110,7 @@ LR_Limiter_t         OPT__LR_LIMITER;
 Opt1stFluxCorr_t     OPT__1ST_FLUX_CORR;
 OptRSolver1st_t      OPT__1ST_FLUX_CORR_SCHEME;
 bool                 OPT__FLAG_PRES_GRADIENT, OPT__FLAG_LOHNER_ENGY, OPT__FLAG_LOHNER_PRES, OPT__FLAG_LOHNER_TEMP, OPT__FLAG_LOHNER_ENTR;
-bool                 OPT__FLAG_VORTICITY, OPT__FLAG_JEANS, JEANS_MIN_PRES, OPT__LAST_RESORT_FLOOR;
+bool                 OPT__FLAG_VORTICITY, OPT__FLAG_JEANS, JEANS_MIN_PRES, OPT__LAST_RESORT_FLOOR, AUTO_REDUCE_DT_LOCAL;
 bool                 OPT__OUTPUT_DIVVEL, OPT__OUTPUT_MACH, OPT__OUTPUT_PRES, OPT__OUTPUT_CS;
 bool                 OPT__OUTPUT_TEMP, OPT__OUTPUT_ENTR, OPT__INT_PRIM;
 int                  OPT__CK_NEGATIVE, JEANS_MIN_PRES_LEVEL, JEANS_MIN_PRES_NCELL, OPT__CHECK_PRES_AFTER_FLU;
@@ -177,7 +180,7 @@ double               GFUNC_COEFF0;
 double               DT__GRAVITY;
 double               NEWTON_G;
 int                  POT_GPU_NPGROUP;
-bool                 OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__SELF_GRAVITY, OPT__GRAVITY_EXTRA_MASS;
+bool                 OPT__OUTPUT_POT, OPT__GRA_P5_GRADIENT, OPT__SELF_GRAVITY, OPT__GRAVITY_EXTRA_MASS, EXT_POT_TABLE_CACHE;
 double               SOR_OMEGA;
 int                  SOR_MAX_ITER, SOR_MIN_ITER;
 double               MG_TOLERATED_ERROR;
@@ -222,6 +225,7 @@ bool                 OPT__LB_EXCHANGE_FATHER;
 bool                 OPT__MINIMIZE_MPI_BARRIER;
 #ifdef SUPPORT_FFTW
 int                  OPT__FFTW_STARTUP;
+bool                 OPT__FFTW_CACHE;
 #if ( SUPPORT_FFTW == FFTW3 )
 bool                 FFTW3_Double_OMP_Enabled, FFTW3_Single_OMP_Enabled;
 #endif // # if ( SUPPORT_FFTW == FFTW3 )
@@ -231,7 +235,7 @@ bool                 FFTW3_Double_OMP_Enabled, FFTW3_Single_OMP_Enabled;
 #ifdef PARTICLE
 double               DT__PARVEL, DT__PARVEL_MAX, DT__PARACC;
 bool                 OPT__CK_PARTICLE, OPT__FLAG_NPAR_CELL, OPT__FLAG_PAR_MASS_CELL, OPT__FREEZE_PAR, OPT__OUTPUT_PAR_MESH, OPT__PAR_INIT_CHECK;
-int                  OPT__OUTPUT_PAR_MODE, OPT__PARTICLE_COUNT, OPT__FLAG_NPAR_PATCH, PAR_IC_FLOAT8, PAR_IC_INT8, FlagTable_NParPatch[NLEVEL-1], FlagTable_NParCell[NLEVEL-1];
+int                  OPT__OUTPUT_PAR_MODE, OPT__PARTICLE_COUNT, OPT__FLAG_NPAR_PATCH, PAR_IC_FLOAT8, PAR_IC_INT8, PAR_REORDER_STEP, FlagTable_NParPatch[NLEVEL-1], FlagTable_NParCell[NLEVEL-1];
 double               FlagTable_ParMassCell[NLEVEL-1];
 ParOutputDens_t      OPT__OUTPUT_PAR_DENS;
 #endif
@@ -383,6 +387,7 @@ double CR_DIFF_PARA;
 double CR_DIFF_PERP;
 double DT__CR_DIFFUSION;
 double CR_DIFF_MIN_B;
+bool   CR_DIFF_RKL2;
 #endif
 
 
@@ -479,6 +484,13 @@ real (*h_SrcDlepProf_Data)[SRC_DLEP_PROF_NBINMAX]                  = NULL;
 real  *h_SrcDlepProf_Radius                                        = NULL;
 #endif
 
+// (3-8) RKL2 cosmic-ray diffusion
+#ifdef CR_DIFFUSION
+real (*h_CR_Diff_Array_In [2])[ CUBE(CR_DIFF_NXT) ]                = { NULL, NULL };
+real (*h_CR_Diff_Mag_In   [2])[NCOMP_MAG][ CR_DIFF_NXT_P1*SQR(CR_DIFF_NXT) ] = { NULL, NULL };
+real (*h_CR_Diff_Array_Out[2])[ CUBE(PS2) ]                        = { NULL, NULL };
+#endif
+
 
 
 // 4. GPU (device) global memory arrays
@@ -649,6 +661,9 @@ int main( int argc, char *argv[] )
       else
          Aux_Error( ERROR_INFO, "Aux_Record_User_Ptr == NULL for OPT__RECORD_USER !!\n" );
    }
+// evaluate the grid-based reductions of Aux_Record_Center() and Aux_Check() in a single pass
+   Aux_Diagnostics();
+
    if ( OPT__RECORD_CENTER )              Aux_Record_Center();
 
 #  ifdef PARTICLE
@@ -755,6 +770,8 @@ int main( int argc, char *argv[] )
       TIMING_FUNC(   Par_Aux_Record_ParticleCount(),  Timer_Main[4],   TIMER_ON   );
 #     endif
 
+      TIMING_FUNC(   Aux_Diagnostics(),               Timer_Main[4],   TIMER_ON   );
+
       if ( OPT__RECORD_CENTER )
       TIMING_FUNC(   Aux_Record_Center(),             Timer_Main[4],   TIMER_ON   );
 
@@ -798,6 +815,10 @@ int main( int argc, char *argv[] )
 
 //    6. check whether to redistribute all patches for LOAD_BALANCE
 //    ---------------------------------------------------------------------------------------------------
+#     ifdef PARTICLE
+      bool Redistributed = false;
+#     endif
+
 #     ifdef LOAD_BALANCE
       if ( OPT__TIMING_BARRIER ) MPI_Barrier( MPI_COMM_WORLD );
 #     ifdef TIMING
@@ -830,6 +851,8 @@ int main( int argc, char *argv[] )
 
 #        ifdef PARTICLE
          if ( OPT__PARTICLE_COUNT > 0 )      Par_Aux_Record_ParticleCount();
+
+         Redistributed = true;
 #        endif
       } // if ( LB_EstimateLoadImbalance() > amr->LB->WLI_Max )
 
@@ -840,7 +863,23 @@ int main( int argc, char *argv[] )
 //    ---------------------------------------------------------------------------------------------------
 
 
-//    7. record timing
+//    7. reorder the particle repository for cache locality
+//    ---------------------------------------------------------------------------------------------------
+#     ifdef PARTICLE
+      if (  PAR_REORDER_STEP > 0  &&  ( Step % PAR_REORDER_STEP == 0  ||  Redistributed )  )
+      TIMING_FUNC(   Par_ReorderRepository(),         Timer_Main[4],   TIMER_ON   );
+#     endif
+//    ---------------------------------------------------------------------------------------------------
+
+
+//    8. adjust the adaptive memory pool
+//    ---------------------------------------------------------------------------------------------------
+      if ( OPT__MEMORY_POOL == MEMORY_POOL_AUTO )
+      TIMING_FUNC(   Mis_AdjustMemoryPool(),          Timer_Main[4],   TIMER_ON   );
+//    ---------------------------------------------------------------------------------------------------
+
+
+//    9. record timing
 //    ---------------------------------------------------------------------------------------------------
 #     ifdef TIMING
       MPI_Barrier( MPI_COMM_WORLD );
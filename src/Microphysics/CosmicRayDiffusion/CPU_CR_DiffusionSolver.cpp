@@ -0,0 +1,133 @@
+#include "GAMER.h"
+
+#ifdef CR_DIFFUSION
+
+
+
+// external functions
+real CR_ComputeDiffuseFlux( const real g_CRay[], const int idx, const int didx[], const int d,
+                            real B_N, real B_T1, real B_T2, const real _dh, const MicroPhy_t *MicroPhy );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CPU_CR_DiffusionSolver
+// Description :  Evaluate the cosmic-ray diffusion operator L(e_cr) = -div(F_cr) used by the RKL2
+//                super-time-stepping stages
+//
+// Note        :  1. Invoked by InvokeSolver() with TSolver = CR_DIFF_SOLVER
+//                2. CPU only (even when GPU is enabled)
+//                3. Diffusive fluxes are computed by CR_ComputeDiffuseFlux(), which is shared with the fluid solver
+//                   --> The transverse B field on each face is the average of the cell-centered B field on both
+//                       sides, same as CR_AddDiffuseFlux_HalfStep()
+//                4. Input arrays must have CR_DIFF_GHOST_SIZE ghost zones on each side
+//                5. Return L(e_cr) instead of the updated e_cr
+//                   --> Different RKL2 stages are combined by CR_Diff_AdvanceDt()
+//
+// Parameter   :  g_CRay_In   : Array storing the prepared cosmic-ray energy density
+//                g_Mag_In    : Array storing the prepared face-centered B field
+//                g_LCRay_Out : Array to store the diffusion operator L(e_cr)
+//                NPatchGroup : Number of patch groups to be evaluated
+//                dh          : Cell size
+//                MicroPhy    : Microphysics object
+//
+// Return      :  g_LCRay_Out[]
+//-------------------------------------------------------------------------------------------------------
+void CPU_CR_DiffusionSolver( const real g_CRay_In[][ CUBE(CR_DIFF_NXT) ],
+                             const real g_Mag_In[][NCOMP_MAG][ CR_DIFF_NXT_P1*SQR(CR_DIFF_NXT) ],
+                                   real g_LCRay_Out[][ CUBE(PS2) ],
+                             const int NPatchGroup, const real dh, const MicroPhy_t MicroPhy )
+{
+
+   const int  NCell      = CR_DIFF_NXT;
+   const int  NGhost     = CR_DIFF_GHOST_SIZE;
+   const int  didx_cc[3] = { 1, NCell, SQR(NCell) };
+   const real _dh        = (real)1.0 / dh;
+
+
+#  pragma omp parallel
+   {
+//    per-thread arrays for the cell-centered B field and the face-centered fluxes
+      real (*CC_B)[ CUBE(CR_DIFF_NXT) ] = new real [NCOMP_MAG][ CUBE(CR_DIFF_NXT) ];
+      real (*Flux)[ PS2P1*SQR(PS2) ]    = new real [3        ][ PS2P1*SQR(PS2)    ];
+
+#     pragma omp for schedule( runtime )
+      for (int P=0; P<NPatchGroup; P++)
+      {
+         const real *CRay = g_CRay_In[P];
+         const real *B_FC[3] = { g_Mag_In[P][MAGX], g_Mag_In[P][MAGY], g_Mag_In[P][MAGZ] };
+
+
+//       1. cell-centered B field including ghost zones
+         for (int k=0; k<NCell; k++)
+         for (int j=0; j<NCell; j++)
+         for (int i=0; i<NCell; i++)
+         {
+            const int idx = IDX321( i, j, k, NCell, NCell );
+            real B_CC[NCOMP_MAG];
+
+            MHD_GetCellCenteredBField( B_CC, B_FC[0], B_FC[1], B_FC[2], NCell, NCell, NCell, i, j, k );
+
+            for (int v=0; v<NCOMP_MAG; v++)  CC_B[v][idx] = B_CC[v];
+         }
+
+
+//       2. diffusive fluxes on all cell faces of the patch group
+//          --> Flux[d] has PS2+1 faces along d and PS2 cells along the transverse directions
+//          --> the face with index s along d is located between the cells s-1 and s
+         for (int d=0; d<3; d++)
+         {
+            const int TDir1   = (d+1)%3;
+            const int TDir2   = (d+2)%3;
+            const int size[3] = { (d==0)?PS2P1:PS2, (d==1)?PS2P1:PS2, (d==2)?PS2P1:PS2 };
+
+            for (int fk=0; fk<size[2]; fk++)
+            for (int fj=0; fj<size[1]; fj++)
+            for (int fi=0; fi<size[0]; fi++)
+            {
+//             cell on the left side of the target face
+               int ijk[3] = { fi+NGhost, fj+NGhost, fk+NGhost };
+               ijk[d] --;
+
+               const int idx_cc   = IDX321( ijk[0], ijk[1], ijk[2], NCell, NCell );
+               const int idx_fc   = ( d == 0 ) ? IDX321_BX( ijk[0]+1, ijk[1],   ijk[2],   NCell, NCell ) :
+                                    ( d == 1 ) ? IDX321_BY( ijk[0],   ijk[1]+1, ijk[2],   NCell, NCell ) :
+                                                 IDX321_BZ( ijk[0],   ijk[1],   ijk[2]+1, NCell, NCell );
+               const int idx_flux = IDX321( fi, fj, fk, size[0], size[1] );
+
+               const real B_N_mean  =             B_FC[d][ idx_fc ];
+               const real B_T1_mean = (real)0.5*( CC_B[TDir1][ idx_cc ] + CC_B[TDir1][ idx_cc + didx_cc[d] ] );
+               const real B_T2_mean = (real)0.5*( CC_B[TDir2][ idx_cc ] + CC_B[TDir2][ idx_cc + didx_cc[d] ] );
+
+               Flux[d][idx_flux] = CR_ComputeDiffuseFlux( CRay, idx_cc, didx_cc, d, B_N_mean, B_T1_mean, B_T2_mean,
+                                                          _dh, &MicroPhy );
+            }
+         } // for (int d=0; d<3; d++)
+
+
+//       3. L(e_cr) = -div(F_cr)
+         for (int k=0; k<PS2; k++)
+         for (int j=0; j<PS2; j++)
+         for (int i=0; i<PS2; i++)
+         {
+            const int idx_fx = IDX321( i, j, k, PS2P1, PS2   );
+            const int idx_fy = IDX321( i, j, k, PS2,   PS2P1 );
+            const int idx_fz = IDX321( i, j, k, PS2,   PS2   );
+
+            g_LCRay_Out[P][ IDX321( i, j, k, PS2, PS2 ) ]
+               = -_dh*(  ( Flux[0][ idx_fx + 1        ] - Flux[0][idx_fx] ) +
+                         ( Flux[1][ idx_fy + PS2      ] - Flux[1][idx_fy] ) +
+                         ( Flux[2][ idx_fz + SQR(PS2) ] - Flux[2][idx_fz] )  );
+         }
+      } // for (int P=0; P<NPatchGroup; P++)
+
+      delete [] CC_B;
+      delete [] Flux;
+   } // OpenMP parallel region
+
+} // FUNCTION : CPU_CR_DiffusionSolver
+
+
+
+#endif // #ifdef CR_DIFFUSION
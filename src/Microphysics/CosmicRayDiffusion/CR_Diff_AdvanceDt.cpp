@@ -0,0 +1,168 @@
+#include "GAMER.h"
+
+#ifdef CR_DIFFUSION
+
+
+// RKL2 working array for storing the diffusion operator of each real patch
+// --> also used by CR_Diff_Close.cpp
+// --> not declared in "Global.h" simply because it is only used by a few routines
+real (*CR_Diff_LCRay)[ CUBE(PS1) ] = NULL;
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CR_Diff_AdvanceDt
+// Description :  Advance the cosmic-ray diffusion by the second-order Runge-Kutta-Legendre (RKL2)
+//                super-time-stepping scheme
+//
+// Note        :  1. Invoked by EvolveLevel() after the fluid solver when CR_DIFF_RKL2 is on
+//                   --> The fluid solver and the dt solver skip cosmic-ray diffusion in this case
+//                2. Invoke InvokeSolver() with TSolver = CR_DIFF_SOLVER once per stage to evaluate the diffusion
+//                   operator L(e_cr) = -div(F_cr) of all real patches
+//                   --> Fill the buffer patches of the cosmic-ray energy density before each stage
+//                3. The number of stages s is the smallest integer >= 2 satisfying
+//                      dt <= dt_expl*(s^2+s-2)/4
+//                   where dt_expl = DT__CR_DIFFUSION*0.5*dh^2/max(CR_DIFF_PARA,CR_DIFF_PERP) is the explicit
+//                   time-step adopted by the fluid solver when CR_DIFF_RKL2 is off
+//                4. Update both the cosmic-ray energy density and the total energy density
+//                5. B field is fixed during the diffusion
+//                6. Ghost zones outside the coarse-fine boundaries are interpolated from the coarse-grid data
+//                   at TimeNew and are fixed during all stages
+//                   --> Diffusive fluxes across the coarse-fine boundaries are not corrected by the fix-up operation
+//
+// Reference   :  Meyer, Balsara, & Aslam, J. Comput. Phys. 257, 594 (2014); doi:10.1016/j.jcp.2013.08.021
+//
+// Parameter   :  lv         : Target refinement level
+//                TimeNew    : Target physical time to reach
+//                TimeOld    : Physical time before update
+//                dt         : Time interval to advance solution
+//                SaveSg_Flu : Sandglass storing the fluid data to be updated
+//                             --> Must be equal to amr->FluSg[lv]
+//                SaveSg_Mag : Sandglass storing the B field
+//                             --> Must be equal to amr->MagSg[lv]
+//-------------------------------------------------------------------------------------------------------
+void CR_Diff_AdvanceDt( const int lv, const double TimeNew, const double TimeOld, const double dt,
+                        const int SaveSg_Flu, const int SaveSg_Mag )
+{
+
+// check
+#  ifdef GAMER_DEBUG
+   if ( SaveSg_Flu != amr->FluSg[lv] )
+      Aux_Error( ERROR_INFO, "SaveSg_Flu (%d) != amr->FluSg (%d) at level %d !!\n", SaveSg_Flu, amr->FluSg[lv], lv );
+
+   if ( SaveSg_Mag != amr->MagSg[lv] )
+      Aux_Error( ERROR_INFO, "SaveSg_Mag (%d) != amr->MagSg (%d) at level %d !!\n", SaveSg_Mag, amr->MagSg[lv], lv );
+#  endif
+
+
+// nothing to do if there is no diffusion at all
+   const double DiffCoeffMax = MAX( CR_DIFF_PARA, CR_DIFF_PERP );
+
+   if ( OPT__FREEZE_FLUID  ||  dt <= 0.0  ||  DiffCoeffMax <= 0.0 )   return;
+
+
+// 1. set the number of stages
+   const double dt_Expl = DT__CR_DIFFUSION*0.5*SQR( amr->dh[lv] )/DiffCoeffMax;
+   const int    NStage  = MAX(  2, (int)ceil( 0.5*( sqrt(9.0+16.0*dt/dt_Expl) - 1.0 ) )  );
+   const double w1      = 4.0/( SQR(NStage) + NStage - 2.0 );
+
+   if ( OPT__VERBOSE  &&  MPI_Rank == 0 )
+      Aux_Message( stdout, "(RKL2 stages = %d) ", NStage );
+
+
+// 2. allocate the working arrays of all real patches
+   const int NReal = amr->NPatchComma[lv][1];
+
+   real (*CRay_Y0  )[ CUBE(PS1) ] = new real [NReal][ CUBE(PS1) ];   // Y_0
+   real (*CRay_LY0 )[ CUBE(PS1) ] = new real [NReal][ CUBE(PS1) ];   // L(Y_0)
+   real (*CRay_Yjm2)[ CUBE(PS1) ] = new real [NReal][ CUBE(PS1) ];   // Y_{j-2}
+
+   CR_Diff_LCRay = new real [NReal][ CUBE(PS1) ];                    // L(Y_{j-1})
+
+
+// 3. RKL2 stages
+// --> Y_j = mu_j*Y_{j-1} + nu_j*Y_{j-2} + (1-mu_j-nu_j)*Y_0 + mu~_j*dt*L(Y_{j-1}) + gamma~_j*dt*L(Y_0)
+   double b_jm1 = 1.0/3.0;    // b_{j-1}
+   double b_jm2 = 1.0/3.0;    // b_{j-2}
+
+   for (int j=1; j<=NStage; j++)
+   {
+//    3-1. fill the buffer patches
+//         --> also fill the B field in the first stage since it has not been exchanged after the fluid solver
+      if ( j == 1 ) {
+         Buf_GetBufferData( lv, SaveSg_Flu, SaveSg_Mag, NULL_INT, DATA_GENERAL, _CRAY, _MAG, Flu_ParaBuf, USELB_YES );
+      }
+      else {
+         Buf_GetBufferData( lv, SaveSg_Flu, NULL_INT, NULL_INT, DATA_GENERAL, _CRAY, _NONE, CR_DIFF_GHOST_SIZE, USELB_YES );
+      }
+
+
+//    3-2. evaluate L(Y_{j-1}) and store it in CR_Diff_LCRay[]
+      InvokeSolver( CR_DIFF_SOLVER, lv, TimeNew, TimeOld, dt, NULL_REAL, SaveSg_Flu, SaveSg_Mag, NULL_INT,
+                    false, false );
+
+
+//    3-3. combine stages
+      const double b_j     = ( j <= 2 ) ? 1.0/3.0 : ( SQR(j) + j - 2.0 )/( 2.0*j*(j+1.0) );
+      const double mu_j    = ( j == 1 ) ? NULL_REAL : (2.0*j-1.0)/j*b_j/b_jm1;
+      const double nu_j    = ( j == 1 ) ? NULL_REAL : -(j-1.0)/j*b_j/b_jm2;
+      const double mut_j   = ( j == 1 ) ? b_j*w1    : mu_j*w1;
+      const double gammat_j= ( j == 1 ) ? NULL_REAL : -( 1.0 - b_jm1 )*mut_j;
+
+#     pragma omp parallel for schedule( static )
+      for (int PID=0; PID<NReal; PID++)
+      {
+         real *CRay = amr->patch[SaveSg_Flu][lv][PID]->fluid[CRAY][0][0];
+
+         if ( j == 1 )
+         {
+            for (int t=0; t<CUBE(PS1); t++)
+            {
+               CRay_Y0  [PID][t] = CRay[t];
+               CRay_Yjm2[PID][t] = CRay[t];
+               CRay_LY0 [PID][t] = CR_Diff_LCRay[PID][t];
+               CRay     [t]      = CRay_Y0[PID][t] + mut_j*dt*CRay_LY0[PID][t];
+            }
+         }
+
+         else
+         {
+            for (int t=0; t<CUBE(PS1); t++)
+            {
+               const real Yjm1 = CRay[t];
+
+               CRay[t]            = mu_j*Yjm1 + nu_j*CRay_Yjm2[PID][t] + ( 1.0 - mu_j - nu_j )*CRay_Y0[PID][t]
+                                  + mut_j*dt*CR_Diff_LCRay[PID][t] + gammat_j*dt*CRay_LY0[PID][t];
+               CRay_Yjm2[PID][t] = Yjm1;
+            }
+         }
+      } // for (int PID=0; PID<NReal; PID++)
+
+      b_jm2 = b_jm1;
+      b_jm1 = b_j;
+   } // for (int j=1; j<=NStage; j++)
+
+
+// 4. update the total energy density
+#  pragma omp parallel for schedule( static )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      const real *CRay = amr->patch[SaveSg_Flu][lv][PID]->fluid[CRAY][0][0];
+            real *Engy = amr->patch[SaveSg_Flu][lv][PID]->fluid[ENGY][0][0];
+
+      for (int t=0; t<CUBE(PS1); t++)  Engy[t] += CRay[t] - CRay_Y0[PID][t];
+   }
+
+
+// 5. free memory
+   delete [] CRay_Y0;
+   delete [] CRay_LY0;
+   delete [] CRay_Yjm2;
+   delete [] CR_Diff_LCRay;   CR_Diff_LCRay = NULL;
+
+} // FUNCTION : CR_Diff_AdvanceDt
+
+
+
+#endif // #ifdef CR_DIFFUSION
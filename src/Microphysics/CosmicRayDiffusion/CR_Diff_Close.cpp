@@ -0,0 +1,56 @@
+#include "GAMER.h"
+
+#ifdef CR_DIFFUSION
+
+
+// RKL2 working array for storing the diffusion operator of each real patch
+// --> defined in CR_Diff_AdvanceDt.cpp
+extern real (*CR_Diff_LCRay)[ CUBE(PS1) ];
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CR_Diff_Close
+// Description :  Closing step for the RKL2 cosmic-ray diffusion solver
+//
+// Note        :  1. Store the diffusion operator L(e_cr) in CR_Diff_LCRay[] instead of updating the patch data
+//                   --> Patch data cannot be updated here since the preparation step of other patch groups
+//                       may still need the un-updated data as ghost zones
+//                   --> The RKL2 stages are combined by CR_Diff_AdvanceDt() after all patch groups are done
+//                2. CR_Diff_LCRay[] is indexed by the real patch index PID
+//
+// Parameter   :  lv                  : Target refinement level
+//                h_CR_Diff_Array_Out : Host array storing the diffusion operator
+//                NPG                 : Number of patch groups updated at a time
+//                PID0_List           : List recording the target patch indices with LocalID==0
+//-------------------------------------------------------------------------------------------------------
+void CR_Diff_Close( const int lv, const real h_CR_Diff_Array_Out[][ CUBE(PS2) ], const int NPG, const int *PID0_List )
+{
+
+#  pragma omp parallel for schedule( static )
+   for (int TID=0; TID<NPG; TID++)
+   {
+      const int PID0 = PID0_List[TID];
+
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const int PID = PID0 + LocalID;
+         const int Disp_i = TABLE_02( LocalID, 'x', 0, PS1 );
+         const int Disp_j = TABLE_02( LocalID, 'y', 0, PS1 );
+         const int Disp_k = TABLE_02( LocalID, 'z', 0, PS1 );
+
+         int idx_out = 0;
+
+         for (int k=Disp_k; k<Disp_k+PS1; k++)
+         for (int j=Disp_j; j<Disp_j+PS1; j++)
+         for (int i=Disp_i; i<Disp_i+PS1; i++)
+            CR_Diff_LCRay[PID][ idx_out ++ ] = h_CR_Diff_Array_Out[TID][ IDX321( i, j, k, PS2, PS2 ) ];
+      }
+   } // for (int TID=0; TID<NPG; TID++)
+
+} // FUNCTION : CR_Diff_Close
+
+
+
+#endif // #ifdef CR_DIFFUSION
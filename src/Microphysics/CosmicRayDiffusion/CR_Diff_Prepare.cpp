@@ -0,0 +1,60 @@
+#include "GAMER.h"
+
+#ifdef CR_DIFFUSION
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CR_Diff_Prepare
+// Description :  Prepare the input arrays h_CR_Diff_Array_In[] and h_CR_Diff_Mag_In[] for the RKL2
+//                cosmic-ray diffusion solver
+//
+// Note        :  1. Always prepare the latest FluSg and MagSg data
+//                2. Prepare the cosmic-ray energy density and all B field components with CR_DIFF_GHOST_SIZE
+//                   ghost zones
+//                3. Use patch groups as the basic unit
+//
+// Parameter   :  lv                 : Target refinement level
+//                PrepTime           : Target physical time to prepare the data
+//                h_CR_Diff_Array_In : Host array to store the prepared cosmic-ray energy density
+//                h_CR_Diff_Mag_In   : Host array to store the prepared B field
+//                NPG                : Number of patch groups prepared at a time
+//                PID0_List          : List recording the target patch indices with LocalID==0
+//-------------------------------------------------------------------------------------------------------
+void CR_Diff_Prepare( const int lv, const double PrepTime,
+                      real h_CR_Diff_Array_In[][ CUBE(CR_DIFF_NXT) ],
+                      real h_CR_Diff_Mag_In[][NCOMP_MAG][ CR_DIFF_NXT_P1*SQR(CR_DIFF_NXT) ],
+                      const int NPG, const int *PID0_List )
+{
+
+// check
+// assuming we are always preparing the lastest data
+#  ifdef GAMER_DEBUG
+   if ( PrepTime != amr->FluSgTime[lv][ amr->FluSg[lv] ] )
+      Aux_Error( ERROR_INFO, "PrepTime (%13.7e) != FluSgTime (%13.7e) !!\n",
+                 PrepTime, amr->FluSgTime[lv][ amr->FluSg[lv] ] );
+
+   if ( PrepTime != amr->MagSgTime[lv][ amr->MagSg[lv] ] )
+      Aux_Error( ERROR_INFO, "PrepTime (%13.7e) != MagSgTime (%13.7e) !!\n",
+                 PrepTime, amr->MagSgTime[lv][ amr->MagSg[lv] ] );
+#  endif
+
+
+   const bool IntPhase_No       = false;
+   const real MinDens_No        = -1.0;
+   const real MinPres_No        = -1.0;
+   const real MinTemp_No        = -1.0;
+   const real MinEntr_No        = -1.0;
+   const bool DE_Consistency_No = false;
+
+   Prepare_PatchData( lv, PrepTime, h_CR_Diff_Array_In[0], h_CR_Diff_Mag_In[0][0],
+                      CR_DIFF_GHOST_SIZE, NPG, PID0_List, _CRAY, _MAG,
+                      OPT__FLU_INT_SCHEME, OPT__MAG_INT_SCHEME, UNIT_PATCHGROUP, NSIDE_26, IntPhase_No,
+                      OPT__BC_FLU, BC_POT_NONE, MinDens_No, MinPres_No, MinTemp_No, MinEntr_No, DE_Consistency_No );
+
+} // FUNCTION : CR_Diff_Prepare
+
+
+
+#endif // #ifdef CR_DIFFUSION
@@ -0,0 +1,35 @@
+#include "GAMER.h"
+
+#ifdef CR_DIFFUSION
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  End_MemFree_CR_Diff
+// Description :  Free memory previously allocated by Init_MemAllocate_CR_Diff()
+//
+// Note        :  1. Work even when GPU is enabled
+//                2. Invoked by End_MemFree()
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void End_MemFree_CR_Diff()
+{
+
+// nothing to do if the RKL2 solver is disabled
+   if ( !CR_DIFF_RKL2 )    return;
+
+
+   for (int t=0; t<2; t++)
+   {
+      delete [] h_CR_Diff_Array_In [t];   h_CR_Diff_Array_In [t] = NULL;
+      delete [] h_CR_Diff_Mag_In   [t];   h_CR_Diff_Mag_In   [t] = NULL;
+      delete [] h_CR_Diff_Array_Out[t];   h_CR_Diff_Array_Out[t] = NULL;
+   }
+
+} // FUNCTION : End_MemFree_CR_Diff
+
+
+
+#endif // #ifdef CR_DIFFUSION
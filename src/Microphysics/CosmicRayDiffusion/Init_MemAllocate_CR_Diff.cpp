@@ -0,0 +1,35 @@
+#include "GAMER.h"
+
+#ifdef CR_DIFFUSION
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Init_MemAllocate_CR_Diff
+// Description :  Allocate the CPU memory for the RKL2 cosmic-ray diffusion solver
+//
+// Note        :  1. Work even when GPU is enabled
+//                2. Invoked by Init_MemAllocate()
+//
+// Parameter   :  CR_Diff_NPG : Number of patch groups to be evaluated at a time
+//-------------------------------------------------------------------------------------------------------
+void Init_MemAllocate_CR_Diff( const int CR_Diff_NPG )
+{
+
+// nothing to do if the RKL2 solver is disabled
+   if ( !CR_DIFF_RKL2 )    return;
+
+
+   for (int t=0; t<2; t++)
+   {
+      h_CR_Diff_Array_In [t] = new real [CR_Diff_NPG][ CUBE(CR_DIFF_NXT) ];
+      h_CR_Diff_Mag_In   [t] = new real [CR_Diff_NPG][NCOMP_MAG][ CR_DIFF_NXT_P1*SQR(CR_DIFF_NXT) ];
+      h_CR_Diff_Array_Out[t] = new real [CR_Diff_NPG][ CUBE(PS2) ];
+   }
+
+} // FUNCTION : Init_MemAllocate_CR_Diff
+
+
+
+#endif // #ifdef CR_DIFFUSION
@@ -31,6 +31,7 @@ void Microphysics_Init()
    MicroPhy.CR_diff_coeff_para = CR_DIFF_PARA;
    MicroPhy.CR_diff_coeff_perp = CR_DIFF_PERP;
    MicroPhy.CR_diff_min_b      = CR_DIFF_MIN_B;
+   MicroPhy.CR_diff_rkl2       = CR_DIFF_RKL2;
 #  endif // #ifdef CR_DIFFUSION
 
    MicroPhy_Initialized = true;
@@ -0,0 +1,311 @@
+#include "GAMER.h"
+
+
+// parameters of the adaptive memory pool (OPT__MEMORY_POOL == MEMORY_POOL_AUTO)
+#define POOL_GROWTH           1.5   // pool capacity = POOL_GROWTH*(high-water mark of the number of active patches)
+#define POOL_LOW_USAGE        3.0   // low usage <--> capacity > POOL_LOW_USAGE*(number of active patches)
+#define POOL_RELEASE_NCHECK   16    // number of consecutive low-usage checks before releasing memory
+
+static int  HighWater [NLEVEL];     // high-water mark of the number of active patches
+static int  WindowMax [NLEVEL];     // maximum number of active patches during the current low-usage period
+static int  LowCount  [NLEVEL];     // number of consecutive low-usage checks
+static int  LastCap   [NLEVEL];     // pool capacity at the end of the previous check
+static long NGrow     [NLEVEL];     // accumulated number of preallocated patches
+static long NRelease  [NLEVEL];     // accumulated number of released patches
+static bool Initialized = false;
+
+static int  GetPoolCapacity( const int lv );
+static void AllocatePatchField( patch_t *Patch );
+static void TouchPatchField( patch_t *Patch );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_AdjustMemoryPool
+// Description :  Grow or shrink the pool of inactive patches at all levels according to the observed usage
+//
+// Note        :  1. Invoked by main() after every root-level step when OPT__MEMORY_POOL == MEMORY_POOL_AUTO
+//                2. The pool of a level consists of the inactive patches reserved by OPT__REUSE_MEMORY, which
+//                   are stored in amr->patch[][lv][ amr->num[lv] ... Capacity-1 ]
+//                3. High-water mark
+//                   --> Maximum number of active patches observed at the end of each root-level step
+//                   --> Patches allocated on demand during the step (i.e., pool capacity exceeding the capacity
+//                       after the previous check) indicate that all pool patches have been in use, in which case
+//                       the capacity is also adopted as the high-water mark
+//                4. Grow the pool geometrically to POOL_GROWTH*HighWater when the number of inactive patches drops
+//                   below half of the target headroom
+//                   --> New patches are allocated and first touched by the OpenMP thread that processes the same PID
+//                       in "omp for schedule(static)" loops over all patches on this level, which places their
+//                       memory on the NUMA node of that thread
+//                   --> Allocate the field arrays serially for OPT__PATCH_SLAB since Mis_PatchSlab_New() is not
+//                       thread-safe
+//                5. Release the inactive patches exceeding POOL_GROWTH*WindowMax when the capacity exceeds
+//                   POOL_LOW_USAGE times the number of active patches for POOL_RELEASE_NCHECK consecutive checks
+//                6. Each MPI rank manages its own pool independently
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Mis_AdjustMemoryPool()
+{
+
+   if ( !Initialized )
+   {
+      for (int lv=0; lv<NLEVEL; lv++)
+      {
+         HighWater[lv] = 0;
+         WindowMax[lv] = 0;
+         LowCount [lv] = 0;
+         LastCap  [lv] = GetPoolCapacity( lv );
+         NGrow    [lv] = 0;
+         NRelease [lv] = 0;
+      }
+
+      Initialized = true;
+   }
+
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int NActive = amr->num[lv];
+      const int Cap     = GetPoolCapacity( lv );
+
+//    1. update the high-water mark
+      HighWater[lv] = MAX( HighWater[lv], NActive );
+      if ( Cap > LastCap[lv] )   HighWater[lv] = MAX( HighWater[lv], Cap );
+
+
+//    2. grow the pool
+      const int Headroom = (int)( (POOL_GROWTH-1.0)*HighWater[lv] );
+      int       NewCap   = Cap;
+
+      if ( Cap - NActive < Headroom/2 )
+      {
+         NewCap = MIN( HighWater[lv] + Headroom, MAX_PATCH );
+
+//       2-1. allocate the patch objects without field arrays
+         for (int PID=Cap; PID<NewCap; PID++)
+         for (int Sg=0; Sg<2; Sg++)
+         {
+            amr->patch[Sg][lv][PID] = new patch_t( 0, 0, 0, -1, false, false, false, false, lv, Sg,
+                                                   amr->BoxScale, amr->BoxEdgeL, amr->dh[TOP_LEVEL] );
+            amr->patch[Sg][lv][PID]->Active = false;
+         }
+
+//       2-2. allocate and first touch the field arrays by the thread processing the same PID in static loops
+//            --> with N=NewCap iterations and NT threads, "schedule(static)" assigns q+1 iterations to the first
+//                r threads and q iterations to the others, where q=N/NT and r=N%NT
+#        pragma omp parallel
+         {
+#           ifdef OPENMP
+            const int TID = omp_get_thread_num();
+            const int NT  = omp_get_num_threads();
+#           else
+            const int TID = 0;
+            const int NT  = 1;
+#           endif
+            const int q   = NewCap / NT;
+            const int r   = NewCap % NT;
+
+            for (int PID=Cap; PID<NewCap; PID++)
+            {
+               const int Owner = ( PID < r*(q+1) ) ? PID/(q+1) : r + (PID-r*(q+1))/q;
+
+               if ( Owner != TID )  continue;
+
+               for (int Sg=0; Sg<2; Sg++)
+               {
+                  patch_t *Patch = amr->patch[Sg][lv][PID];
+
+                  if ( OPT__PATCH_SLAB )
+                  {
+#                    pragma omp critical
+                     AllocatePatchField( Patch );
+                  }
+
+                  else
+                     AllocatePatchField( Patch );
+
+                  TouchPatchField( Patch );
+               }
+            } // for (int PID=Cap; PID<NewCap; PID++)
+         } // OpenMP parallel region
+
+         NGrow[lv] += NewCap - Cap;
+         WindowMax[lv] = 0;
+         LowCount [lv] = 0;
+      } // if ( Cap - NActive < Headroom/2 )
+
+
+//    3. release the pool after sustained low usage
+      else if ( Cap > POOL_LOW_USAGE*NActive )
+      {
+         WindowMax[lv] = MAX( WindowMax[lv], NActive );
+         LowCount [lv] ++;
+
+         if ( LowCount[lv] >= POOL_RELEASE_NCHECK )
+         {
+            NewCap = MAX(  NActive, MIN( Cap, (int)(POOL_GROWTH*WindowMax[lv]) )  );
+
+            for (int PID=NewCap; PID<Cap; PID++)
+            for (int Sg=0; Sg<2; Sg++)
+            {
+               delete amr->patch[Sg][lv][PID];
+               amr->patch[Sg][lv][PID] = NULL;
+            }
+
+            NRelease [lv] += Cap - NewCap;
+            HighWater[lv]  = WindowMax[lv];
+            WindowMax[lv]  = 0;
+            LowCount [lv]  = 0;
+         }
+      } // else if ( Cap > POOL_LOW_USAGE*NActive )
+
+      else
+      {
+         WindowMax[lv] = 0;
+         LowCount [lv] = 0;
+      }
+
+      LastCap[lv] = NewCap;
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+} // FUNCTION : Mis_AdjustMemoryPool
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_RecordMemoryPool
+// Description :  Record the statistics of the adaptive memory pool in the file "Record__MemoryPool"
+//
+// Note        :  1. Invoked by Aux_GetMemInfo() when OPT__MEMORY_POOL == MEMORY_POOL_AUTO
+//                2. Must be invoked by all MPI ranks
+//                3. Record the sums over all MPI ranks
+//
+// Parameter   :  None
+//-------------------------------------------------------------------------------------------------------
+void Mis_RecordMemoryPool()
+{
+
+   static bool FirstTime = true;
+
+   const int  NInfo = 5;   // NActive, NPool, HighWater, NGrow, NRelease
+   char FileName[2*MAX_STRING];
+   long Info_Local[NLEVEL][NInfo], Info_Sum[NLEVEL][NInfo];
+
+   sprintf( FileName, "%s/Record__MemoryPool", OUTPUT_DIR );
+
+
+// 1. collect the statistics from all ranks
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      Info_Local[lv][0] = amr->num[lv];
+      Info_Local[lv][1] = GetPoolCapacity( lv ) - amr->num[lv];
+      Info_Local[lv][2] = ( Initialized ) ? HighWater[lv] : 0;
+      Info_Local[lv][3] = ( Initialized ) ? NGrow    [lv] : 0;
+      Info_Local[lv][4] = ( Initialized ) ? NRelease [lv] : 0;
+   }
+
+   MPI_Reduce( Info_Local[0], Info_Sum[0], NLEVEL*NInfo, MPI_LONG, MPI_SUM, 0, MPI_COMM_WORLD );
+
+
+// 2. record the statistics
+   if ( MPI_Rank == 0 )
+   {
+//    memory of a pair of patches (Sg=0/1) in MB
+      double PatchMB = NCOMP_TOTAL*CUBE(PS1);
+#     ifdef MHD
+      PatchMB += NCOMP_MAG*PS1P1*SQR(PS1);
+#     endif
+#     ifdef GRAVITY
+      PatchMB += CUBE(PS1);
+#     endif
+      PatchMB *= 2.0*sizeof(real)/( 1024.0*1024.0 );
+
+      if ( FirstTime )
+      {
+         if ( Aux_CheckFileExist(FileName) )
+            Aux_Message( stderr, "WARNING : file \"%s\" already exists !!\n", FileName );
+
+         FirstTime = false;
+
+         FILE *File = fopen( FileName, "a" );
+         fprintf( File, "# NActive   : number of active patches summed over all ranks\n" );
+         fprintf( File, "# NPool     : number of inactive patches in the memory pool summed over all ranks\n" );
+         fprintf( File, "# HighWater : high-water mark of the number of active patches summed over all ranks\n" );
+         fprintf( File, "# NGrow     : accumulated number of preallocated patches summed over all ranks\n" );
+         fprintf( File, "# NRelease  : accumulated number of released patches summed over all ranks\n" );
+         fprintf( File, "# Pool      : field data memory of the inactive patches summed over all ranks\n" );
+         fprintf( File, "#------------------------------------------------------------------------------------------\n\n" );
+         fprintf( File, "#%13s%14s%4s%14s%14s%14s%14s%14s%14s\n",
+                  "Time", "Step", "Lv", "NActive", "NPool", "HighWater", "NGrow", "NRelease", "Pool (MB)" );
+         fclose( File );
+      }
+
+      FILE *File = fopen( FileName, "a" );
+      for (int lv=0; lv<NLEVEL; lv++)
+         fprintf( File, "%14.7e%14ld%4d%14ld%14ld%14ld%14ld%14ld%14.2f\n",
+                  Time[0], Step, lv, Info_Sum[lv][0], Info_Sum[lv][1], Info_Sum[lv][2], Info_Sum[lv][3],
+                  Info_Sum[lv][4], Info_Sum[lv][1]*PatchMB );
+      fclose( File );
+   } // if ( MPI_Rank == 0 )
+
+} // FUNCTION : Mis_RecordMemoryPool
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetPoolCapacity
+// Description :  Return the total number of active and inactive patches at the target level
+//
+// Note        :  1. Inactive patches are stored contiguously right after the active patches
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+int GetPoolCapacity( const int lv )
+{
+
+   int Cap = amr->num[lv];
+
+   while ( Cap < MAX_PATCH  &&  amr->patch[0][lv][Cap] != NULL )    Cap ++;
+
+   return Cap;
+
+} // FUNCTION : GetPoolCapacity
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  AllocatePatchField / TouchPatchField
+// Description :  Allocate/initialize the field arrays of an inactive patch in the memory pool
+//
+// Note        :  1. TouchPatchField() initializes the entire arrays to zero so that all their memory pages
+//                   are first touched by the calling thread
+//
+// Parameter   :  Patch : Target patch
+//-------------------------------------------------------------------------------------------------------
+void AllocatePatchField( patch_t *Patch )
+{
+
+   Patch->hnew();
+#  ifdef MHD
+   Patch->mnew();
+#  endif
+#  ifdef GRAVITY
+   Patch->gnew();
+#  endif
+
+} // FUNCTION : AllocatePatchField
+
+void TouchPatchField( patch_t *Patch )
+{
+
+   memset( Patch->fluid,    0, NCOMP_TOTAL*CUBE(PS1)*sizeof(real) );
+#  ifdef MHD
+   memset( Patch->magnetic, 0, NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) );
+#  endif
+#  ifdef GRAVITY
+   memset( Patch->pot,      0, CUBE(PS1)*sizeof(real) );
+#  endif
+
+} // FUNCTION : TouchPatchField
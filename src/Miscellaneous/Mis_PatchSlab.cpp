@@ -0,0 +1,435 @@
+#include "GAMER.h"
+#include <sys/mman.h>
+
+
+// slab block of the patch field arrays
+// --> each block stores the arrays of a single field type on a single level and sandglass (i.e., an "arena")
+// --> blocks are aligned with and padded to SLAB_BLOCK_SIZE so that they can be backed by huge pages
+#define SLAB_BLOCK_SIZE    ( 2L*1024L*1024L )   // 2 MB
+#define SLAB_ALIGN         64                   // alignment of each array in a block
+#define SLAB_MIN_NCHUNK    8                    // minimum number of arrays in a block
+#define SLAB_NTYPE         3                    // number of field types (SLAB_FLU/MAG/POT)
+
+struct SlabBlock_t
+{
+   char  *Base;      // starting address of the block
+   long   Size;      // size of the block in bytes
+   int    Type;      // field type
+   int    lv;        // refinement level
+   int    Sg;        // sandglass
+   int    NChunk;    // total number of arrays in the block
+   int    NUsed;     // number of arrays in use
+   bool   Retired;   // true --> no longer used for new allocations (see Mis_PatchSlab_Repack())
+   ulong *Used;      // bitmap of the arrays in use
+};
+
+static SlabBlock_t **Block     = NULL;             // all blocks sorted by their starting addresses
+static int           NBlock    = 0;
+static int           MaxBlock  = 0;
+static int           ChunkSize[SLAB_NTYPE];        // size of a single array of each field type (padded to SLAB_ALIGN)
+static bool          Initialized = false;
+
+static void         PatchSlab_Init();
+static SlabBlock_t *PatchSlab_NewBlock( const int Type, const int lv, const int Sg );
+static void         PatchSlab_DeleteBlock( const int BlockIdx );
+static int          PatchSlab_FindBlock( const void *Ptr );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_PatchSlab_New
+// Description :  Allocate a patch field array from the slab blocks of the target level and sandglass
+//
+// Note        :  1. Invoked by patch_t::hnew(), patch_t::mnew(), and patch_t::gnew()
+//                2. Return NULL if OPT__PATCH_SLAB is off, in which case the caller should allocate the array
+//                   by itself
+//                3. Always return the free array with the lowest address in this arena
+//                   --> Arrays allocated in the order of PID are contiguous in memory
+//                4. The returned array is NOT touched so that the first-touch NUMA policy places its memory
+//                   on the node of the thread writing it first
+//                5. NOT thread-safe
+//
+// Parameter   :  Type : SLAB_FLU/SLAB_MAG/SLAB_POT
+//                lv   : Target refinement level
+//                Sg   : Target sandglass
+//
+// Return      :  Pointer to the allocated array or NULL
+//-------------------------------------------------------------------------------------------------------
+real *Mis_PatchSlab_New( const PatchSlab_t Type, const int lv, const int Sg )
+{
+
+   if ( !OPT__PATCH_SLAB )    return NULL;
+
+   if ( !Initialized )  PatchSlab_Init();
+
+
+// 1. find the block with free arrays in this arena
+//    --> Block[] is sorted by address, so just pick the first non-full one
+   SlabBlock_t *TBlock = NULL;
+
+   for (int b=0; b<NBlock; b++)
+   {
+      SlabBlock_t *B = Block[b];
+
+      if ( B->Type == Type  &&  B->lv == lv  &&  B->Sg == Sg  &&  !B->Retired  &&  B->NUsed < B->NChunk )
+      {
+         TBlock = B;
+         break;
+      }
+   }
+
+   if ( TBlock == NULL )   TBlock = PatchSlab_NewBlock( Type, lv, Sg );
+
+
+// 2. find the free array with the lowest address in this block
+   const int NWord = ( TBlock->NChunk + 63 ) / 64;
+
+   for (int w=0; w<NWord; w++)
+   {
+      if ( TBlock->Used[w] == ~0UL )   continue;
+
+      const int Chunk = 64*w + __builtin_ctzl( ~TBlock->Used[w] );
+
+      TBlock->Used[w] |= 1UL << ( Chunk % 64 );
+      TBlock->NUsed ++;
+
+      return (real*)( TBlock->Base + (long)Chunk*ChunkSize[Type] );
+   }
+
+   Aux_Error( ERROR_INFO, "cannot find any free array in a non-full slab block (NUsed %d, NChunk %d) !!\n",
+              TBlock->NUsed, TBlock->NChunk );
+
+   return NULL;
+
+} // FUNCTION : Mis_PatchSlab_New
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_PatchSlab_Delete
+// Description :  Return a patch field array to its slab block
+//
+// Note        :  1. Invoked by patch_t::hdelete(), patch_t::mdelete(), and patch_t::gdelete()
+//                2. Return false if OPT__PATCH_SLAB is off or Ptr == NULL, in which case the caller should
+//                   deallocate the array by itself
+//                3. The owner block is found by address so that arrays can be freely swapped between patches,
+//                   levels, and sandglasses
+//                4. Deallocate the block when it becomes empty unless it is the last active block of its arena
+//                5. NOT thread-safe
+//
+// Parameter   :  Ptr : Pointer to the array to be deallocated
+//
+// Return      :  true  --> Ptr has been returned to its slab block
+//                false --> Ptr is not handled by the slab allocator
+//-------------------------------------------------------------------------------------------------------
+bool Mis_PatchSlab_Delete( void *Ptr )
+{
+
+   if ( !OPT__PATCH_SLAB  ||  Ptr == NULL  ||  !Initialized )   return false;
+
+   const int BlockIdx = PatchSlab_FindBlock( Ptr );
+
+   if ( BlockIdx < 0 )  Aux_Error( ERROR_INFO, "array %p is not allocated by the slab allocator !!\n", Ptr );
+
+   SlabBlock_t *B     = Block[BlockIdx];
+   const long   Disp  = (char*)Ptr - B->Base;
+   const int    Chunk = (int)( Disp / ChunkSize[B->Type] );
+
+#  ifdef GAMER_DEBUG
+   if ( Disp % ChunkSize[B->Type] != 0 )
+      Aux_Error( ERROR_INFO, "array %p is misaligned in the slab block %p !!\n", Ptr, B->Base );
+
+   if (  !( B->Used[ Chunk/64 ] & ( 1UL << (Chunk%64) ) )  )
+      Aux_Error( ERROR_INFO, "array %p has been deallocated already !!\n", Ptr );
+#  endif
+
+   B->Used[ Chunk/64 ] &= ~( 1UL << (Chunk%64) );
+   B->NUsed --;
+
+
+// deallocate empty blocks
+   if ( B->NUsed == 0 )
+   {
+      bool LastActive = !B->Retired;
+
+      if ( LastActive )
+      for (int b=0; b<NBlock; b++)
+      {
+         const SlabBlock_t *B2 = Block[b];
+
+         if ( B2 != B  &&  B2->Type == B->Type  &&  B2->lv == B->lv  &&  B2->Sg == B->Sg  &&  !B2->Retired )
+         {
+            LastActive = false;
+            break;
+         }
+      }
+
+      if ( !LastActive )   PatchSlab_DeleteBlock( BlockIdx );
+   }
+
+   return true;
+
+} // FUNCTION : Mis_PatchSlab_Delete
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_PatchSlab_Repack
+// Description :  Reallocate the field arrays of all patches on the target level contiguously in the order of PID
+//
+// Note        :  1. Invoked by LB_Init_LoadBalance() after redistributing and sorting the real patches
+//                   --> Real patches are ordered by LB_Idx when OPT__SORT_PATCH_BY_LBIDX is on
+//                2. Include the inactive patches reserved by OPT__REUSE_MEMORY, which are placed after all
+//                   active patches
+//                3. All existing blocks of this level are retired and deallocated once they become empty
+//                4. Data are copied in parallel with the same static schedule as the loops over PID so that
+//                   each page is first touched by the OpenMP thread owning it
+//
+// Parameter   :  lv : Target refinement level
+//-------------------------------------------------------------------------------------------------------
+void Mis_PatchSlab_Repack( const int lv )
+{
+
+   if ( !OPT__PATCH_SLAB  ||  !Initialized )    return;
+
+
+// 1. count the number of allocated patches (including inactive patches)
+   int NPatch = 0;
+   while ( NPatch < MAX_PATCH  &&  amr->patch[0][lv][NPatch] != NULL )   NPatch ++;
+
+   if ( NPatch == 0 )   return;
+
+
+// 2. retire all existing blocks on this level
+   for (int b=0; b<NBlock; b++)
+      if ( Block[b]->lv == lv )  Block[b]->Retired = true;
+
+
+// 3. allocate new arrays in the order of PID without touching them
+   void *(*OldPtr)[SLAB_NTYPE] = new void* [NPatch][SLAB_NTYPE];
+   void *(*NewPtr)[SLAB_NTYPE] = new void* [NPatch][SLAB_NTYPE];
+
+   for (int Sg=0; Sg<2; Sg++)
+   {
+      for (int PID=0; PID<NPatch; PID++)
+      {
+         patch_t *Patch = amr->patch[Sg][lv][PID];
+
+         OldPtr[PID][SLAB_FLU] = Patch->fluid;
+#        ifdef MHD
+         OldPtr[PID][SLAB_MAG] = Patch->magnetic;
+#        else
+         OldPtr[PID][SLAB_MAG] = NULL;
+#        endif
+#        ifdef GRAVITY
+         OldPtr[PID][SLAB_POT] = Patch->pot;
+#        else
+         OldPtr[PID][SLAB_POT] = NULL;
+#        endif
+
+         for (int t=0; t<SLAB_NTYPE; t++)
+            NewPtr[PID][t] = ( OldPtr[PID][t] == NULL ) ? NULL : Mis_PatchSlab_New( t, lv, Sg );
+      }
+
+
+//    4. copy data
+#     pragma omp parallel for schedule( static )
+      for (int PID=0; PID<NPatch; PID++)
+      for (int t=0; t<SLAB_NTYPE; t++)
+      {
+         const long Size = ( t == SLAB_FLU ) ? NCOMP_TOTAL*CUBE(PS1)*sizeof(real) :
+                           ( t == SLAB_MAG ) ? NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real) :
+                                               CUBE(PS1)*sizeof(real);
+
+         if ( NewPtr[PID][t] != NULL )    memcpy( NewPtr[PID][t], OldPtr[PID][t], Size );
+      }
+
+
+//    5. replace and deallocate the old arrays
+      for (int PID=0; PID<NPatch; PID++)
+      {
+         patch_t *Patch = amr->patch[Sg][lv][PID];
+
+         Patch->fluid    = ( real (*)[PS1][PS1][PS1]    )NewPtr[PID][SLAB_FLU];
+#        ifdef MHD
+         Patch->magnetic = ( real (*)[ PS1P1*SQR(PS1) ] )NewPtr[PID][SLAB_MAG];
+#        endif
+#        ifdef GRAVITY
+         Patch->pot      = ( real (*)[PS1][PS1]         )NewPtr[PID][SLAB_POT];
+#        endif
+
+         for (int t=0; t<SLAB_NTYPE; t++)    Mis_PatchSlab_Delete( OldPtr[PID][t] );
+      }
+   } // for (int Sg=0; Sg<2; Sg++)
+
+   delete [] OldPtr;
+   delete [] NewPtr;
+
+} // FUNCTION : Mis_PatchSlab_Repack
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Mis_PatchSlab_Free
+// Description :  Deallocate all slab blocks
+//
+// Note        :  1. Invoked by End_MemFree() after deleting all patches
+//-------------------------------------------------------------------------------------------------------
+void Mis_PatchSlab_Free()
+{
+
+   while ( NBlock > 0 )    PatchSlab_DeleteBlock( NBlock-1 );
+
+   delete [] Block;
+   Block       = NULL;
+   MaxBlock    = 0;
+   Initialized = false;
+
+} // FUNCTION : Mis_PatchSlab_Free
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchSlab_Init
+// Description :  Set the array size of each field type
+//-------------------------------------------------------------------------------------------------------
+void PatchSlab_Init()
+{
+
+   const long Size[SLAB_NTYPE] = { NCOMP_TOTAL*CUBE(PS1)*sizeof(real),
+                                   NCOMP_MAG*PS1P1*SQR(PS1)*sizeof(real),
+                                   CUBE(PS1)*sizeof(real) };
+
+   for (int t=0; t<SLAB_NTYPE; t++)
+      ChunkSize[t] = (int)(  ( Size[t] + SLAB_ALIGN - 1 ) / SLAB_ALIGN * SLAB_ALIGN  );
+
+   Initialized = true;
+
+} // FUNCTION : PatchSlab_Init
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchSlab_NewBlock
+// Description :  Allocate a new slab block and insert it into Block[] sorted by address
+//
+// Note        :  1. The block is aligned with SLAB_BLOCK_SIZE and advised to be backed by transparent huge pages
+//                2. The block is NOT touched here (see Mis_PatchSlab_New())
+//
+// Parameter   :  Type : Target field type
+//                lv   : Target refinement level
+//                Sg   : Target sandglass
+//
+// Return      :  Pointer to the new block
+//-------------------------------------------------------------------------------------------------------
+SlabBlock_t *PatchSlab_NewBlock( const int Type, const int lv, const int Sg )
+{
+
+// 1. allocate memory
+   const long NBlockSize = ( (long)SLAB_MIN_NCHUNK*ChunkSize[Type] + SLAB_BLOCK_SIZE - 1 ) / SLAB_BLOCK_SIZE;
+   const long Size       = NBlockSize*SLAB_BLOCK_SIZE;
+   void      *Base       = NULL;
+
+   if (  posix_memalign( &Base, SLAB_BLOCK_SIZE, Size ) != 0  )
+      Aux_Error( ERROR_INFO, "cannot allocate a slab block of %ld bytes !!\n", Size );
+
+#  ifdef MADV_HUGEPAGE
+   madvise( Base, Size, MADV_HUGEPAGE );
+#  endif
+
+
+// 2. initialize the block
+   SlabBlock_t *B = new SlabBlock_t;
+
+   B->Base    = (char*)Base;
+   B->Size    = Size;
+   B->Type    = Type;
+   B->lv      = lv;
+   B->Sg      = Sg;
+   B->NChunk  = (int)( Size / ChunkSize[Type] );
+   B->NUsed   = 0;
+   B->Retired = false;
+   B->Used    = new ulong [ (B->NChunk+63)/64 ];
+
+   for (int w=0; w<(B->NChunk+63)/64; w++)   B->Used[w] = 0UL;
+
+// mark the padded bits in the last word as in use
+   if ( B->NChunk % 64 != 0 )    B->Used[ B->NChunk/64 ] = ~0UL << ( B->NChunk % 64 );
+
+
+// 3. insert it into Block[]
+   if ( NBlock == MaxBlock )
+   {
+      MaxBlock = MAX( 2*MaxBlock, 64 );
+
+      SlabBlock_t **NewList = new SlabBlock_t* [MaxBlock];
+      for (int b=0; b<NBlock; b++)  NewList[b] = Block[b];
+
+      delete [] Block;
+      Block = NewList;
+   }
+
+   int Idx = NBlock;
+   while ( Idx > 0  &&  Block[Idx-1]->Base > B->Base )
+   {
+      Block[Idx] = Block[Idx-1];
+      Idx --;
+   }
+
+   Block[Idx] = B;
+   NBlock ++;
+
+   return B;
+
+} // FUNCTION : PatchSlab_NewBlock
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchSlab_DeleteBlock
+// Description :  Deallocate a slab block and remove it from Block[]
+//
+// Parameter   :  BlockIdx : Index of the target block in Block[]
+//-------------------------------------------------------------------------------------------------------
+void PatchSlab_DeleteBlock( const int BlockIdx )
+{
+
+   free( Block[BlockIdx]->Base );
+   delete [] Block[BlockIdx]->Used;
+   delete Block[BlockIdx];
+
+   for (int b=BlockIdx; b<NBlock-1; b++)  Block[b] = Block[b+1];
+
+   NBlock --;
+
+} // FUNCTION : PatchSlab_DeleteBlock
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  PatchSlab_FindBlock
+// Description :  Find the slab block containing the target address by binary search
+//
+// Parameter   :  Ptr : Target address
+//
+// Return      :  Index of the block in Block[] or -1 if not found
+//-------------------------------------------------------------------------------------------------------
+int PatchSlab_FindBlock( const void *Ptr )
+{
+
+   const char *P = (const char*)Ptr;
+   int Left = 0, Right = NBlock-1;
+
+   while ( Left <= Right )
+   {
+      const int Mid = ( Left + Right ) / 2;
+
+      if      ( P <  Block[Mid]->Base                    )  Right = Mid - 1;
+      else if ( P >= Block[Mid]->Base + Block[Mid]->Size )  Left  = Mid + 1;
+      else                                                  return Mid;
+   }
+
+   return -1;
+
+} // FUNCTION : PatchSlab_FindBlock
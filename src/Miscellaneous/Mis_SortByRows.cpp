@@ -10,7 +10,7 @@ static void SortByRows( T const* const* Array, long *IdxTable, const long NSort,
 // Function    :  Mis_SortByRows
 // Description :  Indirectly sort the columns of a 2D array using a sequence of sorting rows.
 //
-// Note        :  1. Invoked by Par_MassAssignment() and FB_AdvanceDt()
+// Note        :  1. Invoked by Par_SortParList(), Par_LB_CollectParticle2OneLevel(), and FB_AdvanceDt()
 //                2. Example:
 //
 //                   int  NOrder         = 2;
@@ -81,6 +81,9 @@ real GetMaxVelocity( const int lv, const bool ExcludeWaveCells )
    _dh  = (real)1.0/amr->dh[lv];
    _dh2 = (real)0.5*_dh;
 
+// cells with wave counterparts are looked up from the cache to avoid traversing the global tree for each cell
+   if ( ExcludeWaveCells )    ELBDM_UpdateWaveCounterpartCache( lv, GlobalTree );
+
 #  pragma omp parallel private( Flu_Array, V, GradS, im, ip, jm, jp, km, kp, I, J, K )
    {
       Flu_Array = new real [NPG][NComp1][Size_Flu][Size_Flu][Size_Flu];
@@ -100,17 +103,8 @@ real GetMaxVelocity( const int lv, const bool ExcludeWaveCells )
          for (int i=NGhost; i<Size_Flu-NGhost; i++)    {  im = i - 1;    ip = i + 1;   I = i - NGhost;
 
 //          skip velocities of cells that have a wave counterpart on the refined levels
-            long GID0                   = GlobalTree->PID2GID( PID0, lv );
-            bool DoNotCalculateVelocity = false;
-            if ( ExcludeWaveCells )
-            {
-//             in principle, we only need to check the single patch (I, J, K) belongs to
-//             however, ELBDM_HasWaveCounterpart automatically returns False if (I, J, K) is outside of the patch GID0 + LocalID
-               for (int LocalID=0; LocalID<8; LocalID++ )
-               {
-                  DoNotCalculateVelocity |= ELBDM_HasWaveCounterpart( I, J, K, GID0, GID0 + LocalID, *GlobalTree );
-               }
-            }
+            const bool DoNotCalculateVelocity = ( ExcludeWaveCells ) ? ELBDM_GetCachedWaveCounterpart( lv, PID0, I, J, K )
+                                                                     : false;
 
             if ( !DoNotCalculateVelocity ) {
 
@@ -0,0 +1,257 @@
+#include "GAMER.h"
+
+#if ( ELBDM_SCHEME == ELBDM_HYBRID )
+
+
+// cache of the wave-counterpart bitmasks of all real patch groups at each level
+// --> each patch group stores one bit per cell of the HYB_NXT^3 array prepared by Prepare_PatchData_HasWaveCounterpart()
+// --> the cache of a level is rebuilt only when the global tree, the number of real patches, or amr->use_wave_flag[]
+//     differs from those adopted when building it
+#define WCC_NWORD    ( ( CUBE(HYB_NXT) + 63 )/64 )   // number of 64-bit words per patch group
+#define WCC_BATCH    256                            // number of patch groups prepared at a time when building the cache
+
+static long    Cache_Version [NLEVEL];              // GlobalTree->GetVersion() adopted by the cache (0 = not built yet)
+static int     Cache_NPG     [NLEVEL];              // number of real patch groups in the cache
+static bool    Cache_WaveFlag[NLEVEL][NLEVEL];      // amr->use_wave_flag[] adopted by the cache
+static ulong (*Cache_Mask    [NLEVEL])[WCC_NWORD];  // wave-counterpart bitmasks
+static bool   *Cache_Refined [NLEVEL];              // whether each patch group is completely refined
+
+static bool CacheIsValid( const int lv, const LB_GlobalTree *GlobalTree );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ELBDM_UpdateWaveCounterpartCache
+// Description :  Rebuild the cache of the wave-counterpart bitmasks and the completely-refined flags of all real
+//                patch groups at the target level if it is outdated
+//
+// Note        :  1. The answers of ELBDM_HasWaveCounterpart() change only when the global tree is reconstructed
+//                   (i.e., after Refine(), LB_Refine(), and LB_Init_LoadBalance()) or when amr->use_wave_flag[]
+//                   is changed (e.g., by Sync_UseWaveFlag())
+//                   --> Traverse the global tree for each cell only once after these operations instead of in
+//                       every fluid update
+//                2. The completely-refined flags are cached only for levels with amr->use_wave_flag[lv] == false
+//                   --> Patches on these levels are refined only when the global tree is reconstructed
+//                3. NOT thread-safe --> must be invoked outside OpenMP parallel regions
+//
+// Parameter   :  lv         : Target refinement level
+//                GlobalTree : LB_GlobalTree object for indexing patches with their GID
+//-------------------------------------------------------------------------------------------------------
+void ELBDM_UpdateWaveCounterpartCache( const int lv, LB_GlobalTree *GlobalTree )
+{
+
+   if ( CacheIsValid(lv, GlobalTree) )  return;
+
+
+// 1. allocate the cache
+   const int NPG = amr->NPatchComma[lv][1] / 8;
+
+   if ( NPG != Cache_NPG[lv]  ||  Cache_Mask[lv] == NULL )
+   {
+      delete [] Cache_Mask   [lv];
+      delete [] Cache_Refined[lv];
+
+      Cache_Mask   [lv] = new ulong [ MAX(NPG,1) ][WCC_NWORD];
+      Cache_Refined[lv] = new bool  [ MAX(NPG,1) ];
+      Cache_NPG    [lv] = NPG;
+   }
+
+
+// 2. prepare the boolean arrays of WCC_BATCH patch groups at a time and pack them into bitmasks
+   bool (*HasWaveCounterpart)[ CUBE(HYB_NXT) ] = new bool [WCC_BATCH][ CUBE(HYB_NXT) ];
+   int   *PID0_List                            = new int  [WCC_BATCH];
+
+   for (int PG0=0; PG0<NPG; PG0+=WCC_BATCH)
+   {
+      const int NBatch = MIN( WCC_BATCH, NPG-PG0 );
+
+      for (int t=0; t<NBatch; t++)  PID0_List[t] = 8*( PG0 + t );
+
+      Prepare_PatchData_HasWaveCounterpart( lv, HasWaveCounterpart, HYB_GHOST_SIZE, NBatch, PID0_List, NSIDE_26, GlobalTree );
+
+#     pragma omp parallel for schedule( static )
+      for (int t=0; t<NBatch; t++)
+      {
+         const int PG   = PG0 + t;
+         ulong    *Mask = Cache_Mask[lv][PG];
+
+         for (int w=0; w<WCC_NWORD; w++)  Mask[w] = 0UL;
+
+         for (int i=0; i<CUBE(HYB_NXT); i++)
+            if ( HasWaveCounterpart[t][i] )  Mask[ i>>6 ] |= 1UL << ( i&63 );
+
+         bool IsCompletelyRefined = true;
+         for (int LocalID=0; LocalID<8; LocalID++)
+         {
+            if ( amr->patch[0][lv][ 8*PG+LocalID ]->son == -1 )
+            {
+               IsCompletelyRefined = false;
+               break;
+            }
+         }
+
+         Cache_Refined[lv][PG] = IsCompletelyRefined;
+      } // for (int t=0; t<NBatch; t++)
+   } // for (int PG0=0; PG0<NPG; PG0+=WCC_BATCH)
+
+   delete [] HasWaveCounterpart;
+   delete [] PID0_List;
+
+
+// 3. record the state adopted by the cache
+   Cache_Version[lv] = GlobalTree->GetVersion();
+   for (int t=0; t<NLEVEL; t++)  Cache_WaveFlag[lv][t] = amr->use_wave_flag[t];
+
+} // FUNCTION : ELBDM_UpdateWaveCounterpartCache
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ELBDM_PrepareWaveCounterpart
+// Description :  Prepare h_IsCompletelyRefined[] and h_HasWaveCounterpart[] of the target patch groups from
+//                the cached bitmasks
+//
+// Note        :  1. Invoked by Flu_Prepare() for levels with amr->use_wave_flag[lv] == false
+//                2. Equivalent to computing h_IsCompletelyRefined[] directly and invoking
+//                   Prepare_PatchData_HasWaveCounterpart() with GhostSize = HYB_GHOST_SIZE and NSide = NSIDE_26
+//                3. Patches stored in PID0_List must be real patches
+//
+// Parameter   :  lv                    : Target refinement level
+//                h_IsCompletelyRefined : Host array to store which patch groups are completely refined
+//                h_HasWaveCounterpart  : Host array to store which cells have wave counterparts
+//                NPG                   : Number of patch groups prepared at a time
+//                PID0_List             : List recording the patch indices with LocalID==0 to be prepared
+//                GlobalTree            : LB_GlobalTree object for indexing patches with their GID
+//-------------------------------------------------------------------------------------------------------
+void ELBDM_PrepareWaveCounterpart( const int lv, bool h_IsCompletelyRefined[], bool h_HasWaveCounterpart[][ CUBE(HYB_NXT) ],
+                                   const int NPG, const int *PID0_List, LB_GlobalTree *GlobalTree )
+{
+
+   if ( NPG == 0 )   return;
+
+   ELBDM_UpdateWaveCounterpartCache( lv, GlobalTree );
+
+#  pragma omp parallel for schedule( runtime )
+   for (int TID=0; TID<NPG; TID++)
+   {
+      const int    PG   = PID0_List[TID] / 8;
+      const ulong *Mask = Cache_Mask[lv][PG];
+
+      h_IsCompletelyRefined[TID] = Cache_Refined[lv][PG];
+
+      for (int w=0; w<WCC_NWORD; w++)
+      {
+         const ulong Word = Mask[w];
+         const int   NBit = MIN( 64, CUBE(HYB_NXT)-64*w );
+         bool       *Out  = h_HasWaveCounterpart[TID] + 64*w;
+
+         for (int b=0; b<NBit; b++)    Out[b] = ( Word >> b ) & 1UL;
+      }
+   }
+
+
+// verify the cache against the direct tree traversal
+#  ifdef GAMER_DEBUG
+   bool (*HasWaveCounterpart_Check)[ CUBE(HYB_NXT) ] = new bool [NPG][ CUBE(HYB_NXT) ];
+
+   Prepare_PatchData_HasWaveCounterpart( lv, HasWaveCounterpart_Check, HYB_GHOST_SIZE, NPG, PID0_List, NSIDE_26, GlobalTree );
+
+   for (int TID=0; TID<NPG; TID++)
+   {
+      for (int i=0; i<CUBE(HYB_NXT); i++)
+      {
+         if ( h_HasWaveCounterpart[TID][i] != HasWaveCounterpart_Check[TID][i] )
+            Aux_Error( ERROR_INFO, "outdated wave-counterpart cache (lv %d, PID0 %d, cell %d) !!\n", lv, PID0_List[TID], i );
+      }
+
+      bool IsCompletelyRefined = true;
+      for (int LocalID=0; LocalID<8; LocalID++)
+         if ( amr->patch[0][lv][ PID0_List[TID]+LocalID ]->son == -1 )   IsCompletelyRefined = false;
+
+      if ( h_IsCompletelyRefined[TID] != IsCompletelyRefined )
+         Aux_Error( ERROR_INFO, "outdated completely-refined cache (lv %d, PID0 %d) !!\n", lv, PID0_List[TID] );
+   }
+
+   delete [] HasWaveCounterpart_Check;
+#  endif
+
+} // FUNCTION : ELBDM_PrepareWaveCounterpart
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ELBDM_GetCachedWaveCounterpart
+// Description :  Return whether the cell [I, J, K] of the target patch group has a wave counterpart on refined
+//                levels using the cache
+//
+// Note        :  1. Must invoke ELBDM_UpdateWaveCounterpartCache() in advance
+//                2. Equivalent to ELBDM_HasWaveCounterpart( I, J, K, GID0, GID0+LocalID, *GlobalTree ), where
+//                   GID0+LocalID is the patch containing the target cell
+//                3. Thread-safe
+//
+// Parameter   :  lv    : Target refinement level
+//                PID0  : Patch index with LocalID==0 of the target real patch group
+//                I/J/K : Cell indices relative to the patch group (in the range [0 ... PS2-1])
+//
+// Return      :  true/false
+//-------------------------------------------------------------------------------------------------------
+bool ELBDM_GetCachedWaveCounterpart( const int lv, const int PID0, const int I, const int J, const int K )
+{
+
+   const int Idx = IDX321( I+HYB_GHOST_SIZE, J+HYB_GHOST_SIZE, K+HYB_GHOST_SIZE, HYB_NXT, HYB_NXT );
+
+   return (  Cache_Mask[lv][ PID0/8 ][ Idx>>6 ] >> ( Idx&63 )  ) & 1UL;
+
+} // FUNCTION : ELBDM_GetCachedWaveCounterpart
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ELBDM_FreeWaveCounterpartCache
+// Description :  Free the cache of the wave-counterpart bitmasks
+//
+// Note        :  1. Invoked by End_MemFree()
+//-------------------------------------------------------------------------------------------------------
+void ELBDM_FreeWaveCounterpartCache()
+{
+
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      delete [] Cache_Mask   [lv];   Cache_Mask   [lv] = NULL;
+      delete [] Cache_Refined[lv];   Cache_Refined[lv] = NULL;
+
+      Cache_Version[lv] = 0;
+      Cache_NPG    [lv] = 0;
+   }
+
+} // FUNCTION : ELBDM_FreeWaveCounterpartCache
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  CacheIsValid
+// Description :  Check whether the cache of the target level is up to date
+//
+// Parameter   :  lv         : Target refinement level
+//                GlobalTree : Current global tree
+//
+// Return      :  true/false
+//-------------------------------------------------------------------------------------------------------
+bool CacheIsValid( const int lv, const LB_GlobalTree *GlobalTree )
+{
+
+   if ( Cache_Mask[lv] == NULL  ||  Cache_Version[lv] != GlobalTree->GetVersion() )   return false;
+
+   if ( Cache_NPG[lv] != amr->NPatchComma[lv][1]/8 )  return false;
+
+   for (int t=0; t<NLEVEL; t++)
+      if ( Cache_WaveFlag[lv][t] != amr->use_wave_flag[t] )   return false;
+
+   return true;
+
+} // FUNCTION : CacheIsValid
+
+
+
+#endif // #if ( ELBDM_SCHEME == ELBDM_HYBRID )
@@ -441,7 +441,9 @@ void CPU_FluidSolver_MHM(
                                     MinDens, MinPres, PassiveFloor, &EoS );
 
 //       add cosmic-ray fluxes
+//       --> skipped when cosmic-ray diffusion is integrated separately by the RKL2 super-time-stepping solver
 #        ifdef CR_DIFFUSION
+         if ( !MicroPhy.CR_diff_rkl2 )
          CR_AddDiffuseFlux_HalfStep( g_Flu_Array_In[P], g_Flux_Half_1PG, g_Mag_Array_In[P], g_PriVar_1PG+MAG_OFFSET, dh, &MicroPhy );
 #        endif
 
@@ -537,6 +539,7 @@ void CPU_FluidSolver_MHM(
 
 //          add cosmic-ray fluxes
 #           ifdef CR_DIFFUSION
+            if ( !MicroPhy.CR_diff_rkl2 )
             CR_AddDiffuseFlux_FullStep( g_PriVar_Half_1PG, g_FC_Flux_1PG, g_FC_Mag_Half_1PG, N_FL_FLUX, dh, &MicroPhy );
 #           endif
 
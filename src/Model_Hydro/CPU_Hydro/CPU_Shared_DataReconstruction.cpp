@@ -53,8 +53,23 @@ void MHD_UpdateMagnetic_Half(       real fc[][NCOMP_LR],
 
 
 // internal functions (GPU_DEVICE is defined in CUFLU.h)
+template <LR_Limiter_t LR_Limiter>
 GPU_DEVICE
-static void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_Limiter_t LR_Limiter,
+static void Hydro_DataReconstruction_Limiter( const real g_ConVar   [][ CUBE(FLU_NXT) ],
+                                              const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
+                                                    real g_PriVar   [][ CUBE(FLU_NXT) ],
+                                                    real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                                                    real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
+                                                    real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
+                                              const bool Con2Pri, const real MinMod_Coeff,
+                                              const real dt, const real dh,
+                                              const real MinDens, const real MinPres, const real MinEint,
+                                              const long PassiveFloor, const bool FracPassive, const int NFrac,
+                                              const int FracIdx[], const bool JeansMinPres, const real JeansMinPres_Coeff,
+                                              const EoS_t *EoS );
+template <LR_Limiter_t LR_Limiter>
+GPU_DEVICE
+static void Hydro_LimitSlope( const real L[], const real C[], const real R[],
                               const real MinMod_Coeff, const int XYZ,
                               const real LEigenVec[][NWAVE], const real REigenVec[][NWAVE], real Slope_Limiter[],
                               const EoS_t *EoS );
@@ -109,12 +124,70 @@ static void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, cons
 
 
 
-#if ( LR_SCHEME == PLM )
 //-------------------------------------------------------------------------------------------------------
 // Function    :  Hydro_DataReconstruction
+// Description :  Reconstruct the face-centered variables by either PLM or PPM
+//
+// Note        :  1. Select the instance of Hydro_DataReconstruction_Limiter() specialized for the slope limiter
+//                   "LR_Limiter" once per patch group
+//                   --> The per-cell slope limiter branches are resolved at compile time
+//                2. Only the limiters accepted by Aux_Check_Parameter() are instantiated
+//                   --> LR_LIMITER_ATHENA is only supported by PPM
+//
+// Parameter   :  See Hydro_DataReconstruction_Limiter()
+//-------------------------------------------------------------------------------------------------------
+GPU_DEVICE
+void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
+                               const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
+                                     real g_PriVar   [][ CUBE(FLU_NXT) ],
+                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                                     real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
+                                     real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
+                               const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
+                               const real dt, const real dh,
+                               const real MinDens, const real MinPres, const real MinEint,
+                               const long PassiveFloor, const bool FracPassive, const int NFrac, const int FracIdx[],
+                               const bool JeansMinPres, const real JeansMinPres_Coeff,
+                               const EoS_t *EoS )
+{
+
+#  define RECONSTRUCT( Limiter )                                                                            \
+      Hydro_DataReconstruction_Limiter<Limiter>( g_ConVar, g_FC_B, g_PriVar, g_FC_Var, g_Slope_PPM, g_EC_Ele,  \
+                                                 Con2Pri, MinMod_Coeff, dt, dh, MinDens, MinPres, MinEint,     \
+                                                 PassiveFloor, FracPassive, NFrac, FracIdx,                    \
+                                                 JeansMinPres, JeansMinPres_Coeff, EoS )
+
+   switch ( LR_Limiter )
+   {
+      case LR_LIMITER_VANLEER    :  RECONSTRUCT( LR_LIMITER_VANLEER    );   break;
+      case LR_LIMITER_GMINMOD    :  RECONSTRUCT( LR_LIMITER_GMINMOD    );   break;
+      case LR_LIMITER_ALBADA     :  RECONSTRUCT( LR_LIMITER_ALBADA     );   break;
+      case LR_LIMITER_VL_GMINMOD :  RECONSTRUCT( LR_LIMITER_VL_GMINMOD );   break;
+      case LR_LIMITER_CENTRAL    :  RECONSTRUCT( LR_LIMITER_CENTRAL    );   break;
+#     if ( LR_SCHEME == PPM )
+      case LR_LIMITER_ATHENA     :  RECONSTRUCT( LR_LIMITER_ATHENA     );   break;
+#     endif
+
+      default :
+#        ifdef GAMER_DEBUG
+         printf( "ERROR : incorrect parameter %s = %d !!\n", "LR_Limiter", LR_Limiter );
+#        endif
+         return;
+   }
+
+#  undef RECONSTRUCT
+
+} // FUNCTION : Hydro_DataReconstruction
+
+
+
+#if ( LR_SCHEME == PLM )
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Hydro_DataReconstruction_Limiter
 // Description :  Reconstruct the face-centered variables by the piecewise-linear method (PLM)
 //
-// Note        :  1. Use the parameter "LR_Limiter" to choose different slope limiters
+// Note        :  1. The slope limiter "LR_Limiter" is a template parameter
+//                   --> Invoked by Hydro_DataReconstruction(), which selects the instance at runtime
 //                2. Input data can be either conserved or primitive variables
 //                   --> If the input data are conserved variables, one must provide g_ConVar[] and enable "Con2Pri"
 //                       --> Primitive variables will be calculated by this function and stored in g_PriVar[]
@@ -126,6 +199,7 @@ static void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, cons
 //                3. Output data are always conserved variables
 //                   --> Because Hydro_HancockPredict() only works with conserved variables
 //                4. PLM and PPM data reconstruction functions share the same function name
+//                   --> Hydro_DataReconstruction() works for both
 //                5. Face-centered variables will be advanced by half time-step for the MHM and CTU schemes
 //                6. Data reconstruction can be applied to characteristic variables by
 //                   defining "CHAR_RECONSTRUCTION" in the header CUFLU.h
@@ -173,6 +247,7 @@ static void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, cons
 //                                          with the index "(i-NGhost,j-NGhost,k-NGhost)"
 //                LR_Limiter         : Slope limiter for the data reconstruction in the MHM/MHM_RP/CTU schemes
 //                                     (0/1/2/3) = (vanLeer/generalized MinMod/vanAlbada/vanLeer+generalized MinMod) limiter
+//                                     --> Template parameter
 //                MinMod_Coeff       : Coefficient of the generalized MinMod limiter
 //                dt                 : Time interval to advance solution (for the CTU scheme)
 //                dh                 : Cell size
@@ -185,19 +260,20 @@ static void Hydro_Char2Pri( real InOut[], const real Dens, const real Pres, cons
 //                JeansMinPres_Coeff : Coefficient used by JeansMinPres = G*(Jeans_NCell*Jeans_dh)^2/(Gamma*pi);
 //                EoS                : EoS object
 //------------------------------------------------------------------------------------------------------
+template <LR_Limiter_t LR_Limiter>
 GPU_DEVICE
-void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
-                               const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
-                                     real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-                                     real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
-                                     real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
-                               const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-                               const real dt, const real dh,
-                               const real MinDens, const real MinPres, const real MinEint,
-                               const long PassiveFloor, const bool FracPassive, const int NFrac, const int FracIdx[],
-                               const bool JeansMinPres, const real JeansMinPres_Coeff,
-                               const EoS_t *EoS )
+void Hydro_DataReconstruction_Limiter( const real g_ConVar   [][ CUBE(FLU_NXT) ],
+                                       const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
+                                             real g_PriVar   [][ CUBE(FLU_NXT) ],
+                                             real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                                             real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
+                                             real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
+                                       const bool Con2Pri, const real MinMod_Coeff,
+                                       const real dt, const real dh,
+                                       const real MinDens, const real MinPres, const real MinEint,
+                                       const long PassiveFloor, const bool FracPassive, const int NFrac,
+                                       const int FracIdx[], const bool JeansMinPres, const real JeansMinPres_Coeff,
+                                       const EoS_t *EoS )
 {
 
 //###NOTE: temporary solution to the bug in cuda 10.1 and 10.2 that incorrectly overwrites didx_cc[]
@@ -400,8 +476,8 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
             cc_R[v] = g_PriVar[v][idx_ccR];
          }
 
-         Hydro_LimitSlope( cc_L, cc_C, cc_R, LR_Limiter, MinMod_Coeff, d,
-                           LEigenVec, REigenVec, Slope_Limiter, EoS );
+         Hydro_LimitSlope<LR_Limiter>( cc_L, cc_C, cc_R, MinMod_Coeff, d,
+                                       LEigenVec, REigenVec, Slope_Limiter, EoS );
 
 
 //       3. get the face-centered primitive variables
@@ -686,33 +762,34 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 #  endif // #if ( FLU_SCHEME == MHM  &&  defined MHD )
 
-} // FUNCTION : Hydro_DataReconstruction (PLM)
+} // FUNCTION : Hydro_DataReconstruction_Limiter (PLM)
 #endif // #if ( LR_SCHEME == PLM )
 
 
 
 #if ( LR_SCHEME == PPM )
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Hydro_DataReconstruction
+// Function    :  Hydro_DataReconstruction_Limiter
 // Description :  Reconstruct the face-centered variables by the piecewise-parabolic method (PPM)
 //
 // Note        :  See the PLM routine
 //
 // Parameter   :  See the PLM routine
 //------------------------------------------------------------------------------------------------------
+template <LR_Limiter_t LR_Limiter>
 GPU_DEVICE
-void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
-                               const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
-                                     real g_PriVar   [][ CUBE(FLU_NXT) ],
-                                     real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
-                                     real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
-                                     real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
-                               const bool Con2Pri, const LR_Limiter_t LR_Limiter, const real MinMod_Coeff,
-                               const real dt, const real dh,
-                               const real MinDens, const real MinPres, const real MinEint,
-                               const long PassiveFloor, const bool FracPassive, const int NFrac, const int FracIdx[],
-                               const bool JeansMinPres, const real JeansMinPres_Coeff,
-                               const EoS_t *EoS )
+void Hydro_DataReconstruction_Limiter( const real g_ConVar   [][ CUBE(FLU_NXT) ],
+                                       const real g_FC_B     [][ SQR(FLU_NXT)*FLU_NXT_P1 ],
+                                             real g_PriVar   [][ CUBE(FLU_NXT) ],
+                                             real g_FC_Var   [][NCOMP_TOTAL_PLUS_MAG][ CUBE(N_FC_VAR) ],
+                                             real g_Slope_PPM[][NCOMP_LR            ][ CUBE(N_SLOPE_PPM) ],
+                                             real g_EC_Ele   [][ CUBE(N_EC_ELE) ],
+                                       const bool Con2Pri, const real MinMod_Coeff,
+                                       const real dt, const real dh,
+                                       const real MinDens, const real MinPres, const real MinEint,
+                                       const long PassiveFloor, const bool FracPassive, const int NFrac,
+                                       const int FracIdx[], const bool JeansMinPres, const real JeansMinPres_Coeff,
+                                       const EoS_t *EoS )
 {
 
 //###NOTE: temporary solution to the bug in cuda 10.1 and 10.2 that incorrectly overwrites didx_cc[]
@@ -899,8 +976,8 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
                cc_R[v] = g_PriVar[v][idx_ccR];
             }
 
-            Hydro_LimitSlope( cc_L, cc_C, cc_R, LR_Limiter, MinMod_Coeff, d,
-                              LEigenVec, REigenVec, Slope_Limiter, EoS );
+            Hydro_LimitSlope<LR_Limiter>( cc_L, cc_C, cc_R, MinMod_Coeff, d,
+                                          LEigenVec, REigenVec, Slope_Limiter, EoS );
 
 //          store the results to g_Slope_PPM[]
             for (int v=0; v<NCOMP_LR; v++)   g_Slope_PPM[d][v][idx_slope] = Slope_Limiter[v];
@@ -1392,7 +1469,7 @@ void Hydro_DataReconstruction( const real g_ConVar   [][ CUBE(FLU_NXT) ],
 
 #  endif // #if ( FLU_SCHEME == MHM  &&  defined MHD )
 
-} // FUNCTION : Hydro_DataReconstruction (PPM)
+} // FUNCTION : Hydro_DataReconstruction_Limiter (PPM)
 #endif // #if ( LR_SCHEME == PPM )
 
 
@@ -1906,6 +1983,7 @@ void Hydro_GetEigenSystem( const real CC_Var[], real EigenVal[][NWAVE],
 //                R             : Element x+1
 //                LR_Limiter    : Slope limiter for the data reconstruction in the MHM/MHM_RP/CTU schemes
 //                                (0/1/2/3) = (vanLeer/generalized MinMod/vanAlbada/vanLeer+generalized MinMod) limiter
+//                                --> Template parameter
 //                MinMod_Coeff  : Coefficient of the generalized MinMod limiter
 //                XYZ           : Target spatial direction : (0/1/2) --> (x/y/z)
 //                                --> For CHAR_RECONSTRUCTION only
@@ -1914,8 +1992,9 @@ void Hydro_GetEigenSystem( const real CC_Var[], real EigenVal[][NWAVE],
 //                Slope_Limiter : Array to store the output monotonic slope
 //                EoS           : EoS object
 //-------------------------------------------------------------------------------------------------------
+template <LR_Limiter_t LR_Limiter>
 GPU_DEVICE
-void Hydro_LimitSlope( const real L[], const real C[], const real R[], const LR_Limiter_t LR_Limiter,
+void Hydro_LimitSlope( const real L[], const real C[], const real R[],
                        const real MinMod_Coeff, const int XYZ,
                        const real LEigenVec[][NWAVE], const real REigenVec[][NWAVE], real Slope_Limiter[],
                        const EoS_t *EoS )
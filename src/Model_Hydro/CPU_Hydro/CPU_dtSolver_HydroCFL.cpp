@@ -208,7 +208,9 @@ void CPU_dtSolver_HydroCFL  ( real g_dt_Array[], const real g_Flu_Array[][FLU_NI
 #     endif
 
 //    The CFL condition determined by the cosmic ray diffusion
+//    --> not applied when cosmic-ray diffusion is integrated by the RKL2 super-time-stepping solver
 #     ifdef CR_DIFFUSION
+      if ( !MicroPhy.CR_diff_rkl2 ) {
       MaxCFL=(real)0.0;
 
       CGPU_LOOP( t, CUBE(PS1) )
@@ -226,6 +228,7 @@ void CPU_dtSolver_HydroCFL  ( real g_dt_Array[], const real g_Flu_Array[][FLU_NI
       if ( threadIdx.x == 0 )
 #     endif // #ifdef __CUDACC__
       g_dt_Array[p] = ( dh2Safety/MaxCFL < g_dt_Array[p]) ? dh2Safety/MaxCFL : g_dt_Array[p];
+      } // if ( !MicroPhy.CR_diff_rkl2 )
 
 #     endif // #ifdef CR_DIFFUSION
 
@@ -126,6 +126,9 @@ void Output_DumpData( const int Stage )
          case OUTPUT_Z    :  sprintf( FileName_Temp, "Zline_x%.3f_y%.3f_%06d", OUTPUT_PART_X, OUTPUT_PART_Y, DumpID );  break;
          case OUTPUT_DIAG :  sprintf( FileName_Temp, "Diag_%06d", DumpID );   break;
          case OUTPUT_BOX  :  sprintf( FileName_Temp, "Box_%06d", DumpID );   break;
+         case OUTPUT_PROJ_XY :  sprintf( FileName_Temp, "XYproj_%06d", DumpID );   break;
+         case OUTPUT_PROJ_YZ :  sprintf( FileName_Temp, "YZproj_%06d", DumpID );   break;
+         case OUTPUT_PROJ_XZ :  sprintf( FileName_Temp, "XZproj_%06d", DumpID );   break;
          default :           Aux_Error( ERROR_INFO, "incorrect parameter %s = %d !!\n", "OPT__OUTPUT_PART", OPT__OUTPUT_PART );
       } // switch ( OPT__OUTPUT_PART )
 
@@ -137,6 +140,9 @@ void Output_DumpData( const int Stage )
       else
          strcat( FileName_Part, FileName_Temp );
 
+      if ( OPT__OUTPUT_PART_FORMAT == OUTPUT_PART_CBINARY )
+         strcat( FileName_Part, ".cbin" );
+
    } // if ( OPT__OUTPUT_PART )
 
    if ( OPT__OUTPUT_BASEPS )
@@ -278,8 +284,13 @@ void Output_DumpData( const int Stage )
 
 //    start dumping data
       if ( OPT__OUTPUT_TOTAL )            Output_DumpData_Total( FileName_Total );
-      if ( OPT__OUTPUT_PART  )            Output_DumpData_Part( OPT__OUTPUT_PART, OPT__OUTPUT_BASE, OUTPUT_PART_X,
+      if ( OPT__OUTPUT_PART  &&  OPT__OUTPUT_PART_FORMAT == OUTPUT_PART_TEXT )
+                                          Output_DumpData_Part( OPT__OUTPUT_PART, OPT__OUTPUT_BASE, OUTPUT_PART_X,
                                                                 OUTPUT_PART_Y, OUTPUT_PART_Z, FileName_Part );
+      if ( OPT__OUTPUT_PART  &&  OPT__OUTPUT_PART_FORMAT == OUTPUT_PART_CBINARY )
+                                          Output_DumpData_Part_Binary( OPT__OUTPUT_PART, OPT__OUTPUT_BASE, OUTPUT_PART_X,
+                                                                       OUTPUT_PART_Y, OUTPUT_PART_Z, OUTPUT_PART_PROJ_LV,
+                                                                       FileName_Part );
       if ( OPT__OUTPUT_USER )
       {
          if ( Output_User_Ptr != NULL )   Output_User_Ptr();
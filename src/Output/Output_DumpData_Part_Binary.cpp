@@ -0,0 +1,524 @@
+#include "GAMER.h"
+
+// maximum number of output fields
+#define NFIELD_PART_MAX    ( NCOMP_TOTAL + NCOMP_MAG + 1 )
+
+static int  GetFieldList( char (*Label)[MAX_STRING] );
+static void GetCellField( real Out[], const int lv, const int PID, const int i, const int j, const int k );
+static long ExtractPatch( const OptOutputPart_t Part, const int lv, const int PID, const double x, const double y,
+                          const double z, const int NField, const long NCellLocal, const long Offset,
+                          double *Coord, real *Field );
+static void WriteSlice( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
+                        const double z, const char *FileName );
+static void WriteProjection( const OptOutputPart_t Part, const bool BaseOnly, const int ProjLv, const char *FileName );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Output_DumpData_Part_Binary
+// Description :  Output part of data or its projection in the binary form
+//
+// Note        :  1. Used for the runtime option "OPT__OUTPUT_PART" with "OPT__OUTPUT_PART_FORMAT == OUTPUT_PART_CBINARY"
+//                   --> Cheap alternative to Output_DumpData_Part() for frequent in-situ monitoring
+//                2. Lines, slices, diagonal, and box (OUTPUT_XY ~ OUTPUT_BOX)
+//                   --> Each rank extracts its own intersecting leaf cells with OpenMP, computes its file offset
+//                       by a prefix sum over all ranks, and then all ranks write their data concurrently
+//                       with MPI-IO
+//                   --> Output the same cells as Output_DumpData_Part() but only the stored fields:
+//                       all fluid fields, cell-centered B field (MHD), and potential (OPT__OUTPUT_POT)
+//                3. Projections (OUTPUT_PROJ_XY/YZ/XZ)
+//                   --> Integrate all output fields along the line of sight (i.e., sum of value*dh) on a uniform
+//                       image with the cell size on ProjLv
+//                   --> Leaf cells coarser than ProjLv are spread over multiple pixels and leaf cells finer
+//                       than ProjLv are area-averaged into one pixel
+//                   --> Images of all ranks are reduced onto the root rank, which writes the file
+//                4. File layout:
+//                      int    : Part
+//                      int    : Number of fields (NField)
+//                      int    : Number of bytes per field value (sizeof(real) for slices and 8 for projections)
+//                      long   : Number of cells (slices) or pixels (projections) (NData)
+//                      char   : Field labels [NField][MAX_STRING]
+//                      --> Slices
+//                      double : Cell-center coordinates and cell sizes [4][NData] (x, y, z, dh)
+//                      real   : Fields [NField][NData]
+//                      --> Projections
+//                      int    : Image size [2] (NPix0, NPix1) along the first and second image axes
+//                      double : Pixel size
+//                      double : Projected fields [NField][NPix1][NPix0]
+//                   --> Data of all cells with a selected field are dumped consecutively, followed by the next
+//                       field, so on and so forth (same as Par_Output_BinaryFile())
+//
+// Parameter   :  Part     : OUTPUT_XY ~ OUTPUT_BOX : see Output_DumpData_Part()
+//                           OUTPUT_PROJ_XY         : projection along z
+//                           OUTPUT_PROJ_YZ         : projection along x
+//                           OUTPUT_PROJ_XZ         : projection along y
+//                BaseOnly : Only output the base-level data
+//                x/y/z    : Target coordinates of lines and slices
+//                ProjLv   : Target level of the projection image
+//                FileName : Name of the output file
+//-------------------------------------------------------------------------------------------------------
+void Output_DumpData_Part_Binary( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
+                                  const double z, const int ProjLv, const char *FileName )
+{
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d)    ...\n", __FUNCTION__, DumpID );
+
+
+// check the input parameters
+   if ( Part < OUTPUT_XY  ||  Part > OUTPUT_PROJ_XZ )
+      Aux_Error( ERROR_INFO, "unsupported option \"Part = %d\" [1 ~ 11] !!\n", Part );
+
+   if (  ( Part == OUTPUT_YZ  ||  Part == OUTPUT_Y  ||  Part == OUTPUT_Z )  &&
+         ( x < 0.0  ||  x >= amr->BoxSize[0] )  )
+      Aux_Error( ERROR_INFO, "incorrect x (out of range [0<=X<%lf]) !!\n", amr->BoxSize[0] );
+
+   if (  ( Part == OUTPUT_XZ  ||  Part == OUTPUT_X  ||  Part == OUTPUT_Z )  &&
+         ( y < 0.0  ||  y >= amr->BoxSize[1] )  )
+      Aux_Error( ERROR_INFO, "incorrect y (out of range [0<=Y<%lf]) !!\n", amr->BoxSize[1] );
+
+   if (  ( Part == OUTPUT_XY  ||  Part == OUTPUT_X  ||  Part == OUTPUT_Y )  &&
+         ( z < 0.0  ||  z >= amr->BoxSize[2] )  )
+      Aux_Error( ERROR_INFO, "incorrect z (out of range [0<=Z<%lf]) !!\n", amr->BoxSize[2] );
+
+   if ( Part == OUTPUT_DIAG  &&  ( amr->BoxSize[0] != amr->BoxSize[1] || amr->BoxSize[0] != amr->BoxSize[2] )  )
+      Aux_Error( ERROR_INFO, "simulation domain must be cubic for \"OUTPUT_DIAG\" !!\n" );
+
+   if (  ( Part == OUTPUT_PROJ_XY || Part == OUTPUT_PROJ_YZ || Part == OUTPUT_PROJ_XZ )  &&
+         ( ProjLv < 0  ||  ProjLv > TOP_LEVEL )  )
+      Aux_Error( ERROR_INFO, "incorrect ProjLv = %d (out of range [0 ~ %d]) !!\n", ProjLv, TOP_LEVEL );
+
+
+// check the synchronization
+   for (int lv=1; lv<NLEVEL; lv++)
+      if ( NPatchTotal[lv] != 0 )   Mis_CompareRealValue( Time[0], Time[lv], __FUNCTION__, true );
+
+
+// check if the file already exists
+   if ( MPI_Rank == 0  &&  Aux_CheckFileExist(FileName) )
+      Aux_Message( stderr, "WARNING : file \"%s\" already exists and will be overwritten !!\n", FileName );
+
+
+   if ( Part == OUTPUT_PROJ_XY  ||  Part == OUTPUT_PROJ_YZ  ||  Part == OUTPUT_PROJ_XZ )
+      WriteProjection( Part, BaseOnly, ProjLv, FileName );
+   else
+      WriteSlice( Part, BaseOnly, x, y, z, FileName );
+
+
+   if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s (DumpID = %d)    ... done\n", __FUNCTION__, DumpID );
+
+} // FUNCTION : Output_DumpData_Part_Binary
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteSlice
+// Description :  Extract and write lines, slices, diagonal, and box for Output_DumpData_Part_Binary()
+//
+// Note        :  1. Two-pass extraction with OpenMP: count the target cells of each patch, compute the
+//                   patch offsets by a prefix sum, and then fill in the output buffers in parallel
+//                2. The rank offsets are computed by MPI_Exscan() and all ranks write their data
+//                   concurrently by the collective MPI_File_write_at_all()
+//
+// Parameter   :  See Output_DumpData_Part_Binary()
+//-------------------------------------------------------------------------------------------------------
+void WriteSlice( const OptOutputPart_t Part, const bool BaseOnly, const double x, const double y,
+                 const double z, const char *FileName )
+{
+
+   const int NLv = ( BaseOnly ) ? 1 : NLEVEL;
+
+   char (*Label)[MAX_STRING] = new char [NFIELD_PART_MAX][MAX_STRING];
+   const int NField = GetFieldList( Label );
+
+
+// 1. collect the target patches
+   long NPatch = 0;
+   for (int lv=0; lv<NLv; lv++)  NPatch += amr->NPatchComma[lv][1];
+
+   int  (*PatchList)[2] = new int  [NPatch][2];
+   long  *NCellPatch    = new long [NPatch];
+   long  *OffsetPatch   = new long [NPatch];
+
+   NPatch = 0;
+   for (int lv=0; lv<NLv; lv++)
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   {
+      if ( amr->patch[0][lv][PID]->son == -1  ||  BaseOnly )
+      {
+         PatchList[NPatch][0] = lv;
+         PatchList[NPatch][1] = PID;
+         NPatch ++;
+      }
+   }
+
+
+// 2. count the target cells of each patch and compute the patch offsets
+#  pragma omp parallel for schedule( runtime )
+   for (long t=0; t<NPatch; t++)
+      NCellPatch[t] = ExtractPatch( Part, PatchList[t][0], PatchList[t][1], x, y, z, NField, 0, 0, NULL, NULL );
+
+   long NCellLocal = 0;
+   for (long t=0; t<NPatch; t++)
+   {
+      OffsetPatch[t] = NCellLocal;
+      NCellLocal    += NCellPatch[t];
+   }
+
+
+// 3. fill in the output buffers
+   double *Coord = new double [ 4*NCellLocal ];
+   real   *Field = new real   [ (long)NField*NCellLocal ];
+
+#  pragma omp parallel for schedule( runtime )
+   for (long t=0; t<NPatch; t++)
+   {
+      if ( NCellPatch[t] == 0 )  continue;
+
+      ExtractPatch( Part, PatchList[t][0], PatchList[t][1], x, y, z, NField, NCellLocal, OffsetPatch[t], Coord, Field );
+   }
+
+
+// 4. compute the rank offsets
+   long NCellTotal, OffsetRank=0;
+
+#  ifdef SERIAL
+   NCellTotal = NCellLocal;
+#  else
+   MPI_Allreduce( &NCellLocal, &NCellTotal, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
+   MPI_Exscan   ( &NCellLocal, &OffsetRank, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
+   if ( MPI_Rank == 0 )    OffsetRank = 0;  // MPI_Exscan() leaves the receive buffer undefined on rank 0
+
+   if ( NCellLocal > (long)__INT_MAX__ )
+      Aux_Error( ERROR_INFO, "number of local cells (%ld) exceeds the maximum integer (%d) !!\n", NCellLocal, __INT_MAX__ );
+#  endif
+
+
+// 5. write the file
+   const int  SizeOfFlt  = sizeof(real);
+   const long HeaderSize = 3*sizeof(int) + sizeof(long) + (long)NField*MAX_STRING;
+   const long CoordStart = HeaderSize;
+   const long FieldStart = CoordStart + 4*NCellTotal*sizeof(double);
+
+#  ifdef SERIAL
+   FILE *File = fopen( FileName, "wb" );
+
+   fwrite( &Part,       sizeof(int),  1,                 File );
+   fwrite( &NField,     sizeof(int),  1,                 File );
+   fwrite( &SizeOfFlt,  sizeof(int),  1,                 File );
+   fwrite( &NCellTotal, sizeof(long), 1,                 File );
+   fwrite( Label[0],    sizeof(char), NField*MAX_STRING, File );
+   fwrite( Coord,       sizeof(double), 4*NCellLocal,    File );
+   fwrite( Field,       sizeof(real),   (long)NField*NCellLocal, File );
+
+   fclose( File );
+
+#  else
+   MPI_File File;
+   MPI_File_open( MPI_COMM_WORLD, (char*)FileName, MPI_MODE_CREATE|MPI_MODE_WRONLY, MPI_INFO_NULL, &File );
+   MPI_File_set_size( File, 0 );
+
+   if ( MPI_Rank == 0 )
+   {
+      MPI_Offset Offset = 0;
+      MPI_File_write_at( File, Offset, &Part,       1, MPI_INT,  MPI_STATUS_IGNORE );  Offset += sizeof(int);
+      MPI_File_write_at( File, Offset, &NField,     1, MPI_INT,  MPI_STATUS_IGNORE );  Offset += sizeof(int);
+      MPI_File_write_at( File, Offset, &SizeOfFlt,  1, MPI_INT,  MPI_STATUS_IGNORE );  Offset += sizeof(int);
+      MPI_File_write_at( File, Offset, &NCellTotal, 1, MPI_LONG, MPI_STATUS_IGNORE );  Offset += sizeof(long);
+      MPI_File_write_at( File, Offset, Label[0], NField*MAX_STRING, MPI_CHAR, MPI_STATUS_IGNORE );
+   }
+
+   for (int b=0; b<4; b++)
+   {
+      const MPI_Offset Offset = CoordStart + ( b*NCellTotal + OffsetRank )*sizeof(double);
+      MPI_File_write_at_all( File, Offset, Coord+b*NCellLocal, (int)NCellLocal, MPI_DOUBLE, MPI_STATUS_IGNORE );
+   }
+
+   for (int v=0; v<NField; v++)
+   {
+      const MPI_Offset Offset = FieldStart + ( v*NCellTotal + OffsetRank )*sizeof(real);
+      MPI_File_write_at_all( File, Offset, Field+v*NCellLocal, (int)NCellLocal, MPI_GAMER_REAL, MPI_STATUS_IGNORE );
+   }
+
+   MPI_File_close( &File );
+#  endif // #ifdef SERIAL ... else ...
+
+
+   delete [] Label;
+   delete [] PatchList;
+   delete [] NCellPatch;
+   delete [] OffsetPatch;
+   delete [] Coord;
+   delete [] Field;
+
+} // FUNCTION : WriteSlice
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  WriteProjection
+// Description :  Project all output fields onto a uniform image and write it for Output_DumpData_Part_Binary()
+//
+// Note        :  1. OpenMP threads deposit to the same image with atomic updates
+//                2. Images are reduced onto the root rank one field at a time to limit the memory overhead
+//
+// Parameter   :  See Output_DumpData_Part_Binary()
+//-------------------------------------------------------------------------------------------------------
+void WriteProjection( const OptOutputPart_t Part, const bool BaseOnly, const int ProjLv, const char *FileName )
+{
+
+   const int    NLv    = ( BaseOnly ) ? 1 : NLEVEL;
+   const int    ImgLv  = ( BaseOnly ) ? 0 : ProjLv;
+   const int    ImgSc  = amr->scale[ImgLv];
+   const double ImgDh  = amr->dh[ImgLv];
+
+// image axes
+   int d0=-1, d1=-1;
+   switch ( Part )
+   {
+      case OUTPUT_PROJ_XY :   d0 = 0;  d1 = 1;  break;
+      case OUTPUT_PROJ_YZ :   d0 = 1;  d1 = 2;  break;
+      case OUTPUT_PROJ_XZ :   d0 = 0;  d1 = 2;  break;
+      default :               Aux_Error( ERROR_INFO, "unsupported option \"Part = %d\" !!\n", Part );
+   }
+
+   const int  NPix[2]   = { amr->BoxScale[d0]/ImgSc, amr->BoxScale[d1]/ImgSc };
+   const long NPixTotal = (long)NPix[0]*NPix[1];
+
+   if ( NPixTotal > (long)__INT_MAX__ )
+      Aux_Error( ERROR_INFO, "number of pixels (%ld) exceeds the maximum integer (%d) --> reduce OUTPUT_PART_PROJ_LV !!\n",
+                 NPixTotal, __INT_MAX__ );
+
+   char (*Label)[MAX_STRING] = new char [NFIELD_PART_MAX][MAX_STRING];
+   const int NField = GetFieldList( Label );
+
+   double *Image = new double [ (long)NField*NPixTotal ];
+   for (long t=0; t<(long)NField*NPixTotal; t++)   Image[t] = 0.0;
+
+
+// deposit all leaf cells
+   for (int lv=0; lv<NLv; lv++)
+   {
+      const int    scale = amr->scale[lv];
+      const double dh    = amr->dh[lv];
+
+//    coarse cells cover NCover^2 pixels; fine cells are area-averaged into one pixel
+      const int    NCover = ( scale >= ImgSc ) ? scale/ImgSc : 1;
+      const double Weight = ( scale >= ImgSc ) ? dh : dh*SQR( (double)scale/ImgSc );
+
+#     pragma omp parallel for schedule( runtime )
+      for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+      {
+         if ( amr->patch[0][lv][PID]->son != -1  &&  !BaseOnly )  continue;
+
+         const int *Corner = amr->patch[0][lv][PID]->corner;
+         real CellField[NFIELD_PART_MAX];
+         int  idx[3];
+
+         for (idx[2]=0; idx[2]<PS1; idx[2]++)
+         for (idx[1]=0; idx[1]<PS1; idx[1]++)
+         for (idx[0]=0; idx[0]<PS1; idx[0]++)
+         {
+            GetCellField( CellField, lv, PID, idx[0], idx[1], idx[2] );
+
+            const int p0 = ( Corner[d0] + idx[d0]*scale ) / ImgSc;
+            const int p1 = ( Corner[d1] + idx[d1]*scale ) / ImgSc;
+
+            for (int v=0; v<NField; v++)
+            {
+               const double dI   = (double)CellField[v]*Weight;
+               double      *Img  = Image + v*NPixTotal;
+
+               for (int q1=p1; q1<p1+NCover; q1++)
+               for (int q0=p0; q0<p0+NCover; q0++)
+               {
+#                 pragma omp atomic
+                  Img[ (long)q1*NPix[0] + q0 ] += dI;
+               }
+            }
+         } // i,j,k
+      } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   } // for (int lv=0; lv<NLv; lv++)
+
+
+// reduce onto the root rank and write the file one field at a time
+   const int SizeOfFlt = sizeof(double);
+   double   *Image_All = ( MPI_Rank == 0 ) ? new double [NPixTotal] : NULL;
+   FILE     *File      = NULL;
+
+   if ( MPI_Rank == 0 )
+   {
+      File = fopen( FileName, "wb" );
+
+      fwrite( &Part,      sizeof(int),    1,                 File );
+      fwrite( &NField,    sizeof(int),    1,                 File );
+      fwrite( &SizeOfFlt, sizeof(int),    1,                 File );
+      fwrite( &NPixTotal, sizeof(long),   1,                 File );
+      fwrite( Label[0],   sizeof(char),   NField*MAX_STRING, File );
+      fwrite( NPix,       sizeof(int),    2,                 File );
+      fwrite( &ImgDh,     sizeof(double), 1,                 File );
+   }
+
+   for (int v=0; v<NField; v++)
+   {
+      MPI_Reduce( Image+v*NPixTotal, Image_All, (int)NPixTotal, MPI_DOUBLE, MPI_SUM, 0, MPI_COMM_WORLD );
+
+      if ( MPI_Rank == 0 )    fwrite( Image_All, sizeof(double), NPixTotal, File );
+   }
+
+   if ( MPI_Rank == 0 )    fclose( File );
+
+
+   delete [] Label;
+   delete [] Image;
+   delete [] Image_All;
+
+} // FUNCTION : WriteProjection
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ExtractPatch
+// Description :  Count or extract the target cells of one patch for WriteSlice()
+//
+// Note        :  1. Adopt the same cell selection as Output_DumpData_Part()
+//                2. Only count the target cells if "Coord == NULL"
+//
+// Parameter   :  Part       : See Output_DumpData_Part_Binary()
+//                lv         : Target refinement level
+//                PID        : Target patch ID
+//                x/y/z      : Target coordinates
+//                NField     : Number of output fields
+//                NCellLocal : Total number of target cells on this rank (i.e., stride of Coord[] and Field[])
+//                Offset     : Offset of this patch in Coord[] and Field[]
+//                Coord      : Array to store the cell coordinates and sizes
+//                Field      : Array to store the cell fields
+//
+// Return      :  Number of target cells in this patch, Coord[], Field[]
+//-------------------------------------------------------------------------------------------------------
+long ExtractPatch( const OptOutputPart_t Part, const int lv, const int PID, const double x, const double y,
+                   const double z, const int NField, const long NCellLocal, const long Offset,
+                   double *Coord, real *Field )
+{
+
+   const double  dh      = amr->dh[lv];
+   const double  dh_min  = amr->dh[TOP_LEVEL];
+   const int     scale   = amr->scale[lv];
+   const int    *Corner  = amr->patch[0][lv][PID]->corner;
+   const double *EdgeL   = amr->patch[0][lv][PID]->EdgeL;
+   const double *EdgeR   = amr->patch[0][lv][PID]->EdgeR;
+   const bool    Check_x = ( Part == OUTPUT_YZ  ||  Part == OUTPUT_Y  ||  Part == OUTPUT_Z );
+   const bool    Check_y = ( Part == OUTPUT_XZ  ||  Part == OUTPUT_X  ||  Part == OUTPUT_Z );
+   const bool    Check_z = ( Part == OUTPUT_XY  ||  Part == OUTPUT_X  ||  Part == OUTPUT_Y );
+
+
+// check whether the patch is within the target range
+   if ( Part == OUTPUT_DIAG )
+   {
+      if ( Corner[0] != Corner[1]  ||  Corner[0] != Corner[2] )   return 0;
+   }
+
+   else
+   {
+      if (  Check_x  &&  !( EdgeL[0]<=x && EdgeR[0]>x )  )   return 0;
+      if (  Check_y  &&  !( EdgeL[1]<=y && EdgeR[1]>y )  )   return 0;
+      if (  Check_z  &&  !( EdgeL[2]<=z && EdgeR[2]>z )  )   return 0;
+   }
+
+
+// check whether the cell is within the target range
+   real CellField[NFIELD_PART_MAX];
+   long Count = 0;
+
+   for (int k=0; k<PS1; k++)  {  const int kk = Corner[2] + k*scale;  const double zz = kk*dh_min;
+                                 if ( Check_z && ( zz>z || zz+dh<=z ) )    continue;
+   for (int j=0; j<PS1; j++)  {  const int jj = Corner[1] + j*scale;  const double yy = jj*dh_min;
+                                 if ( Check_y && ( yy>y || yy+dh<=y ) )    continue;
+   for (int i=0; i<PS1; i++)  {  const int ii = Corner[0] + i*scale;  const double xx = ii*dh_min;
+                                 if ( Check_x && ( xx>x || xx+dh<=x ) )    continue;
+
+      if ( Part == OUTPUT_DIAG  &&  ( i != k  ||  j != k ) )   continue;
+
+      if ( Coord != NULL )
+      {
+         const long t = Offset + Count;
+
+         Coord[ 0*NCellLocal + t ] = xx + 0.5*dh;
+         Coord[ 1*NCellLocal + t ] = yy + 0.5*dh;
+         Coord[ 2*NCellLocal + t ] = zz + 0.5*dh;
+         Coord[ 3*NCellLocal + t ] = dh;
+
+         GetCellField( CellField, lv, PID, i, j, k );
+
+         for (int v=0; v<NField; v++)  Field[ v*NCellLocal + t ] = CellField[v];
+      }
+
+      Count ++;
+   }}}
+
+   return Count;
+
+} // FUNCTION : ExtractPatch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetFieldList
+// Description :  Set the labels of all output fields
+//
+// Parameter   :  Label : Array to store the field labels
+//
+// Return      :  Number of output fields, Label[]
+//-------------------------------------------------------------------------------------------------------
+int GetFieldList( char (*Label)[MAX_STRING] )
+{
+
+   int NField = 0;
+
+   memset( Label[0], 0, NFIELD_PART_MAX*MAX_STRING );
+
+   for (int v=0; v<NCOMP_TOTAL; v++)   strcpy( Label[ NField ++ ], FieldLabel[v] );
+
+#  ifdef MHD
+   for (int v=0; v<NCOMP_MAG; v++)     strcpy( Label[ NField ++ ], MagLabel[v] );
+#  endif
+
+#  ifdef GRAVITY
+   if ( OPT__OUTPUT_POT )              strcpy( Label[ NField ++ ], PotLabel );
+#  endif
+
+   return NField;
+
+} // FUNCTION : GetFieldList
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  GetCellField
+// Description :  Get all output fields of one cell in the order set by GetFieldList()
+//
+// Parameter   :  Out   : Array to store the output fields
+//                lv    : Target refinement level
+//                PID   : Target patch ID
+//                i/j/k : Cell indices within the patch
+//
+// Return      :  Out[]
+//-------------------------------------------------------------------------------------------------------
+void GetCellField( real Out[], const int lv, const int PID, const int i, const int j, const int k )
+{
+
+   int NField = 0;
+
+   for (int v=0; v<NCOMP_TOTAL; v++)   Out[ NField ++ ] = amr->patch[ amr->FluSg[lv] ][lv][PID]->fluid[v][k][j][i];
+
+#  ifdef MHD
+   real B[NCOMP_MAG];
+   MHD_GetCellCenteredBFieldInPatch( B, lv, PID, i, j, k, amr->MagSg[lv] );
+   for (int v=0; v<NCOMP_MAG; v++)     Out[ NField ++ ] = B[v];
+#  endif
+
+#  ifdef GRAVITY
+   if ( OPT__OUTPUT_POT )              Out[ NField ++ ] = amr->patch[ amr->PotSg[lv] ][lv][PID]->pot[k][j][i];
+#  endif
+
+} // FUNCTION : GetCellField
@@ -79,7 +79,7 @@ Procedure for outputting new variables:
 
 
 //-------------------------------------------------------------------------------------------------------
-// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2507)
+// Function    :  Output_DumpData_Total_HDF5 (FormatVersion = 2517)
 // Description :  Output all simulation data in the HDF5 format, which can be used as a restart file
 //                or loaded by YT
 //
@@ -286,6 +286,16 @@ Procedure for outputting new variables:
 //                                             GRACKLE_HYDROGEN_MFRAC, OPT__UNFREEZE_GRACKLE,
 //                                             OPT__OUTPUT_GRACKLE_TEMP, OPT__OUTPUT_GRACKLE_MU, OPT__OUTPUT_GRACKLE_TCOOL,
 //                                             DT__GRACKLE_COOLING, OPT__FLAG_COOLING_LEN, FlagTable_CoolingLen
+//                2508 : 2026/10/18 --> output OPT__OUTPUT_PART_FORMAT, OUTPUT_PART_PROJ_LV
+//                2509 : 2026/10/19 --> output OPT__FFTW_CACHE
+//                2510 : 2026/10/19 --> output OPT__UM_IC_MMAP
+//                2511 : 2026/10/19 --> output PAR_REORDER_STEP
+//                2512 : 2026/10/19 --> output CR_DIFF_RKL2
+//                2513 : 2026/10/19 --> output AUTO_REDUCE_DT_LOCAL
+//                2514 : 2026/10/19 --> output OPT__SINGLE_SANDGLASS
+//                2515 : 2026/10/19 --> output OPT__PATCH_SLAB
+//                2516 : 2026/10/19 --> output EXT_POT_TABLE_CACHE
+//                2517 : 2026/10/19 --> output INTERP_MASK_LOCAL
 //-------------------------------------------------------------------------------------------------------
 void Output_DumpData_Total_HDF5( const char *FileName )
 {
@@ -1752,7 +1762,7 @@ void FillIn_KeyInfo( KeyInfo_t &KeyInfo, const int NFieldStored )
 
    const time_t CalTime = time( NULL );   // calendar time
 
-   KeyInfo.FormatVersion        = 2507;
+   KeyInfo.FormatVersion        = 2517;
    KeyInfo.Model                = MODEL;
    KeyInfo.NLevel               = NLEVEL;
    KeyInfo.NCompFluid           = NCOMP_FLUID;
@@ -2302,6 +2312,12 @@ void FillIn_SymConst( SymConst_t &SymConst )
    SymConst.InterpMask           = 0;
 #  endif
 
+#  ifdef INTERP_MASK_LOCAL
+   SymConst.InterpMaskLocal      = 1;
+#  else
+   SymConst.InterpMaskLocal      = 0;
+#  endif
+
 #  ifdef FB_SEP_FLUOUT
    SymConst.FB_SepFluOut         = 1;
 #  else
@@ -2503,6 +2519,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Par_GhostSizeTracer     = amr->Par->GhostSizeTracer;
    InputPara.Par_TracerVelCorr       = amr->Par->TracerVelCorr;
    InputPara.Opt__ParInitCheck       = OPT__PAR_INIT_CHECK;
+   InputPara.Par_ReorderStep         = PAR_REORDER_STEP;
    for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)
    InputPara.ParAttFltLabel[v]       = ParAttFltLabel[v];
    for (int v=0; v<PAR_NATT_INT_TOTAL; v++)
@@ -2557,6 +2574,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
 #  if ( MODEL == HYDRO )
    InputPara.AutoReduceMinModFactor  = AUTO_REDUCE_MINMOD_FACTOR;
    InputPara.AutoReduceMinModMin     = AUTO_REDUCE_MINMOD_MIN;
+   InputPara.AutoReduceDtLocal       = AUTO_REDUCE_DT_LOCAL;
 #  endif
    InputPara.AutoReduceIntMonoFactor = AUTO_REDUCE_INT_MONO_FACTOR;
    InputPara.AutoReduceIntMonoMin    = AUTO_REDUCE_INT_MONO_MIN;
@@ -2630,6 +2648,8 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
 #  endif
    InputPara.Opt__ReuseMemory        = OPT__REUSE_MEMORY;
    InputPara.Opt__MemoryPool         = OPT__MEMORY_POOL;
+   InputPara.Opt__SingleSandglass    = OPT__SINGLE_SANDGLASS;
+   InputPara.Opt__PatchSlab          = OPT__PATCH_SLAB;
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -2758,6 +2778,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    for (int d=0; d<3; d++)
    InputPara.ExtPotTable_EdgeL[d]    = EXT_POT_TABLE_EDGEL[d];
    InputPara.ExtPotTable_Float8      = EXT_POT_TABLE_FLOAT8;
+   InputPara.ExtPotTable_Cache       = EXT_POT_TABLE_CACHE;
    InputPara.Opt__GravityExtraMass   = OPT__GRAVITY_EXTRA_MASS;
 #  endif
 
@@ -2820,6 +2841,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.CR_Diffusion_ParaCoeff  = CR_DIFF_PARA;
    InputPara.CR_Diffusion_PerpCoeff  = CR_DIFF_PERP;
    InputPara.CR_Diffusion_MinB       = CR_DIFF_MIN_B;
+   InputPara.CR_Diffusion_RKL2       = CR_DIFF_RKL2;
 #  endif
 #  endif // #ifdef COSMIC_RAY
 
@@ -2835,6 +2857,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Opt__UM_IC_Downgrade    = OPT__UM_IC_DOWNGRADE;
    InputPara.Opt__UM_IC_Refine       = OPT__UM_IC_REFINE;
    InputPara.Opt__UM_IC_LoadNRank    = OPT__UM_IC_LOAD_NRANK;
+   InputPara.Opt__UM_IC_MMap         = OPT__UM_IC_MMAP;
 
    if ( OPT__INIT == INIT_BY_FILE  &&  OPT__UM_IC_NLEVEL > 1  &&  UM_IC_RefineRegion != NULL )
    {
@@ -2864,6 +2887,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
 #  endif
 #  ifdef SUPPORT_FFTW
    InputPara.Opt__FFTW_Startup       = OPT__FFTW_STARTUP;
+   InputPara.Opt__FFTW_Cache         = OPT__FFTW_CACHE;
 #  endif
 
 // interpolation schemes
@@ -2908,6 +2932,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
 // data dump
    InputPara.Opt__Output_Total           = OPT__OUTPUT_TOTAL;
    InputPara.Opt__Output_Part            = OPT__OUTPUT_PART;
+   InputPara.Opt__Output_Part_Format     = OPT__OUTPUT_PART_FORMAT;
    InputPara.Opt__Output_User            = OPT__OUTPUT_USER;
 #  ifdef PARTICLE
    InputPara.Opt__Output_Par_Mode        = OPT__OUTPUT_PAR_MODE;
@@ -2955,6 +2980,7 @@ void FillIn_InputPara( InputPara_t &InputPara, const int NFieldStored, char Fiel
    InputPara.Output_PartX                = OUTPUT_PART_X;
    InputPara.Output_PartY                = OUTPUT_PART_Y;
    InputPara.Output_PartZ                = OUTPUT_PART_Z;
+   InputPara.Output_PartProjLv           = OUTPUT_PART_PROJ_LV;
    InputPara.InitDumpID                  = INIT_DUMPID;
 
 // libyt jupyter
@@ -3367,6 +3393,7 @@ void GetCompound_SymConst( hid_t &H5_TypeID )
    H5Tinsert( H5_TypeID, "BitRep_Electric",      HOFFSET(SymConst_t,BitRep_Electric     ), H5T_NATIVE_INT    );
 #  endif
    H5Tinsert( H5_TypeID, "InterpMask",           HOFFSET(SymConst_t,InterpMask          ), H5T_NATIVE_INT    );
+   H5Tinsert( H5_TypeID, "InterpMaskLocal",      HOFFSET(SymConst_t,InterpMaskLocal     ), H5T_NATIVE_INT    );
    H5Tinsert( H5_TypeID, "FB_SepFluOut",         HOFFSET(SymConst_t,FB_SepFluOut        ), H5T_NATIVE_INT    );
 
 #  if   ( MODEL == HYDRO )
@@ -3569,6 +3596,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Par_GhostSizeTracer",     HOFFSET(InputPara_t,Par_GhostSizeTracer    ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Par_TracerVelCorr",       HOFFSET(InputPara_t,Par_TracerVelCorr      ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__ParInitCheck",       HOFFSET(InputPara_t,Opt__ParInitCheck      ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Par_ReorderStep",         HOFFSET(InputPara_t,Par_ReorderStep        ), H5T_NATIVE_INT     );
 
 // store the name of all particle attributes
    for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)
@@ -3641,6 +3669,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 #  if ( MODEL == HYDRO )
    H5Tinsert( H5_TypeID, "AutoReduceMinModFactor",  HOFFSET(InputPara_t,AutoReduceMinModFactor ), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "AutoReduceMinModMin",     HOFFSET(InputPara_t,AutoReduceMinModMin    ), H5T_NATIVE_DOUBLE  );
+   H5Tinsert( H5_TypeID, "AutoReduceDtLocal",       HOFFSET(InputPara_t,AutoReduceDtLocal      ), H5T_NATIVE_INT     );
 #  endif
    H5Tinsert( H5_TypeID, "AutoReduceIntMonoFactor", HOFFSET(InputPara_t,AutoReduceIntMonoFactor), H5T_NATIVE_DOUBLE  );
    H5Tinsert( H5_TypeID, "AutoReduceIntMonoMin",    HOFFSET(InputPara_t,AutoReduceIntMonoMin   ), H5T_NATIVE_DOUBLE  );
@@ -3714,6 +3743,8 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 #  endif
    H5Tinsert( H5_TypeID, "Opt__ReuseMemory",        HOFFSET(InputPara_t,Opt__ReuseMemory       ), H5T_NATIVE_INT     );
    H5Tinsert( H5_TypeID, "Opt__MemoryPool",         HOFFSET(InputPara_t,Opt__MemoryPool        ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__SingleSandglass",    HOFFSET(InputPara_t,Opt__SingleSandglass   ), H5T_NATIVE_INT     );
+   H5Tinsert( H5_TypeID, "Opt__PatchSlab",          HOFFSET(InputPara_t,Opt__PatchSlab         ), H5T_NATIVE_INT     );
 
 // load balance
 #  ifdef LOAD_BALANCE
@@ -3850,6 +3881,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "ExtPotTable_dh",          HOFFSET(InputPara_t,ExtPotTable_dh         ), H5_TypeID_Arr_3Double       );
    H5Tinsert( H5_TypeID, "ExtPotTable_EdgeL",       HOFFSET(InputPara_t,ExtPotTable_EdgeL      ), H5_TypeID_Arr_3Double       );
    H5Tinsert( H5_TypeID, "ExtPotTable_Float8",      HOFFSET(InputPara_t,ExtPotTable_Float8     ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "ExtPotTable_Cache",       HOFFSET(InputPara_t,ExtPotTable_Cache      ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__GravityExtraMass",   HOFFSET(InputPara_t,Opt__GravityExtraMass  ), H5T_NATIVE_INT              );
 #  endif // #ifdef GRAVITY
 
@@ -3912,6 +3944,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "CR_Diffusion_ParaCoeff", HOFFSET(InputPara_t,CR_Diffusion_ParaCoeff ), H5T_NATIVE_DOUBLE            );
    H5Tinsert( H5_TypeID, "CR_Diffusion_PerpCoeff", HOFFSET(InputPara_t,CR_Diffusion_PerpCoeff ), H5T_NATIVE_DOUBLE            );
    H5Tinsert( H5_TypeID, "CR_Diffusion_MinB",      HOFFSET(InputPara_t,CR_Diffusion_MinB      ), H5T_NATIVE_DOUBLE            );
+   H5Tinsert( H5_TypeID, "CR_Diffusion_RKL2",      HOFFSET(InputPara_t,CR_Diffusion_RKL2      ), H5T_NATIVE_INT               );
 #  endif
 #  endif // #ifdef COSMIC_RAY
 
@@ -3927,6 +3960,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Opt__UM_IC_Downgrade",    HOFFSET(InputPara_t,Opt__UM_IC_Downgrade    ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__UM_IC_Refine",       HOFFSET(InputPara_t,Opt__UM_IC_Refine       ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__UM_IC_LoadNRank",    HOFFSET(InputPara_t,Opt__UM_IC_LoadNRank    ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__UM_IC_MMap",         HOFFSET(InputPara_t,Opt__UM_IC_MMap         ), H5T_NATIVE_INT              );
 #  if ( NLEVEL > 1 )
    H5Tinsert( H5_TypeID, "UM_IC_RefineRegion",      HOFFSET(InputPara_t,UM_IC_RefineRegion      ), H5_TypeID_Arr_NLvM1_6Int    );
 #  endif
@@ -3939,6 +3973,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 #  endif
 #  ifdef SUPPORT_FFTW
    H5Tinsert( H5_TypeID, "Opt__FFTW_Startup",       HOFFSET(InputPara_t,Opt__FFTW_Startup       ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__FFTW_Cache",         HOFFSET(InputPara_t,Opt__FFTW_Cache         ), H5T_NATIVE_INT              );
 #  endif
 
 // interpolation schemes
@@ -3983,6 +4018,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
 // data dump
    H5Tinsert( H5_TypeID, "Opt__Output_Total",           HOFFSET(InputPara_t,Opt__Output_Total          ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__Output_Part",            HOFFSET(InputPara_t,Opt__Output_Part           ), H5T_NATIVE_INT              );
+   H5Tinsert( H5_TypeID, "Opt__Output_Part_Format",     HOFFSET(InputPara_t,Opt__Output_Part_Format    ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "Opt__Output_User",            HOFFSET(InputPara_t,Opt__Output_User           ), H5T_NATIVE_INT              );
 #  ifdef PARTICLE
    H5Tinsert( H5_TypeID, "Opt__Output_Par_Mode",        HOFFSET(InputPara_t,Opt__Output_Par_Mode       ), H5T_NATIVE_INT              );
@@ -4030,6 +4066,7 @@ void GetCompound_InputPara( hid_t &H5_TypeID, const int NFieldStored )
    H5Tinsert( H5_TypeID, "Output_PartX",                HOFFSET(InputPara_t,Output_PartX               ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "Output_PartY",                HOFFSET(InputPara_t,Output_PartY               ), H5T_NATIVE_DOUBLE           );
    H5Tinsert( H5_TypeID, "Output_PartZ",                HOFFSET(InputPara_t,Output_PartZ               ), H5T_NATIVE_DOUBLE           );
+   H5Tinsert( H5_TypeID, "Output_PartProjLv",           HOFFSET(InputPara_t,Output_PartProjLv          ), H5T_NATIVE_INT              );
    H5Tinsert( H5_TypeID, "InitDumpID",                  HOFFSET(InputPara_t,InitDumpID                 ), H5T_NATIVE_INT              );
 
 // libyt jupyter
@@ -48,6 +48,9 @@ extern Timer_t *Timer_Par_MPI[NLEVEL][6];
 //                   --> Currently it does NOT work with the options SibBufPatch and FaSibBufPatch
 //                       --> It only counts particles for **real** patches at FaLv
 //                   --> Does NOT work with "PredictPos"
+//                8. For BITWISE_REPRODUCIBILITY, the particles collected for non-leaf real patches at FaLv are sorted
+//                   by their position (after prediction if PredictPos is on)
+//                   --> Required by Par_MassAssignment(), which does not sort the input particles
 //
 // Parameter   :  FaLv          : Father's refinement level
 //                FltAttBitIdx  : Bitwise indices of the target particle floating-point attributes (e.g., _PAR_MASS | _PAR_VELX)
@@ -640,6 +643,53 @@ void Par_LB_CollectParticle2OneLevel( const int FaLv, const long FltAttBitIdx, c
    } // for (int FaPID=0; FaPID<amr->NPatchComma[FaLv][1]; FaPID++)
 
 
+// 4-4. sort particles by position for bitwise reproducibility
+//      --> the order of the received particles depends on the domain decomposition
+//      --> Par_MassAssignment() deposits particles in the order of ParAttFlt_Copy[] and ParAttInt_Copy[] directly
+#  ifdef BITWISE_REPRODUCIBILITY
+   if ( !JustCountNPar  &&  ( FltAttBitIdx & _PAR_POS ) == _PAR_POS )
+   {
+#     pragma omp parallel for schedule( PAR_OMP_SCHED, PAR_OMP_SCHED_CHUNK )
+      for (int FaPID=0; FaPID<amr->NPatchComma[FaLv][1]; FaPID++)
+      {
+         const int NPar_Copy = amr->patch[0][FaLv][FaPID]->NPar_Copy;
+
+         if ( amr->patch[0][FaLv][FaPID]->son == -1  ||  NPar_Copy < 2 )   continue;
+
+         real_par      **ParAttFlt_Copy = amr->patch[0][FaLv][FaPID]->ParAttFlt_Copy;
+         long_par      **ParAttInt_Copy = amr->patch[0][FaLv][FaPID]->ParAttInt_Copy;
+         const real_par *Pos[3]         = { ParAttFlt_Copy[PAR_POSX], ParAttFlt_Copy[PAR_POSY], ParAttFlt_Copy[PAR_POSZ] };
+         const int       Sort_Order[3]  = { 0, 1, 2 };
+         long           *Sort_IdxTable  = new long     [NPar_Copy];
+         real_par       *Tmp_Flt        = new real_par [NPar_Copy];
+         long_par       *Tmp_Int        = new long_par [NPar_Copy];
+
+         Mis_SortByRows( Pos, Sort_IdxTable, (long)NPar_Copy, Sort_Order, 3 );
+
+         for (int v=0; v<NAttFlt; v++)
+         {
+            real_par *Att = ParAttFlt_Copy[ FltAttIntIdx[v] ];
+
+            for (int p=0; p<NPar_Copy; p++)  Tmp_Flt[p] = Att[ Sort_IdxTable[p] ];
+            for (int p=0; p<NPar_Copy; p++)  Att[p]     = Tmp_Flt[p];
+         }
+
+         for (int v=0; v<NAttInt; v++)
+         {
+            long_par *Att = ParAttInt_Copy[ IntAttIntIdx[v] ];
+
+            for (int p=0; p<NPar_Copy; p++)  Tmp_Int[p] = Att[ Sort_IdxTable[p] ];
+            for (int p=0; p<NPar_Copy; p++)  Att[p]     = Tmp_Int[p];
+         }
+
+         delete [] Sort_IdxTable;
+         delete [] Tmp_Flt;
+         delete [] Tmp_Int;
+      } // for (int FaPID=0; FaPID<amr->NPatchComma[FaLv][1]; FaPID++)
+   } // if ( !JustCountNPar  &&  ... )
+#  endif // #ifdef BITWISE_REPRODUCIBILITY
+
+
 
 // 5. check if we do collect all particles at levels >= FaLv
 #  ifdef DEBUG_PARTICLE
@@ -279,6 +279,11 @@ void Par_LB_ExchangeParticleBetweenPatch( const int lv,
       amr->patch[0][lv][PID]->AddParticle( NParThisPatch, NewParIDList, &amr->Par->NPar_Lv[lv],
                                            PType );
 #     endif
+
+//    4-4. sort particles for bitwise reproducibility
+#     ifdef BITWISE_REPRODUCIBILITY
+      Par_SortParList( lv, PID );
+#     endif
    } // for (int t=0; t<Recv_NPatchTotal; t++)
 
 
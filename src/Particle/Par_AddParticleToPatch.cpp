@@ -0,0 +1,131 @@
+#include "GAMER.h"
+
+#ifdef PARTICLE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_AddNewParticleToPatch
+// Description :  Add new particles staged patch by patch to the particle repository and associate them with
+//                their home patches
+//
+// Note        :  1. New particles must be stored contiguously in the order of their home patch indices
+//                   --> Particles of patch PID are stored in [ sum_{P<PID} NNewPar_EachPatch[P] ... ]
+//                   --> Both particle IDs and the order in ParList[] are deterministic and independent of
+//                       the number of OpenMP threads
+//                2. The particle repository is reallocated at most once
+//                   --> Replace calling amr->Par->AddOneParticle() and amr->patch[0][lv][PID]->AddParticle()
+//                       within an OpenMP critical section
+//                3. Invoked by SF_CreateStar_AGORA()
+//                   --> Can also be used by feedback routines creating new particles
+//                4. NOT thread-safe --> must be invoked outside OpenMP parallel regions
+//                5. Does NOT update amr->Par->NPar_Active_AllRank
+//
+// Parameter   :  lv                : Target refinement level
+//                NNewPar_EachPatch : Number of new particles in each real patch on lv
+//                NewParAttFlt      : Floating-point attributes of new particles
+//                NewParAttInt      : Integer        attributes of new particles
+//
+// Return      :  1. amr->Par
+//                2. NPar, ParListSize, and ParList[] of all real patches on lv
+//-------------------------------------------------------------------------------------------------------
+void Par_AddNewParticleToPatch( const int lv, const int *NNewPar_EachPatch,
+                                const real_par (*NewParAttFlt)[PAR_NATT_FLT_TOTAL],
+                                const long_par (*NewParAttInt)[PAR_NATT_INT_TOTAL] )
+{
+
+// 1. get the total number of new particles
+   long NNewPar = 0;
+
+   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)   NNewPar += NNewPar_EachPatch[PID];
+
+   if ( NNewPar == 0 )  return;
+
+
+// 2. add particles to the particle repository
+   long *NewParID = new long [NNewPar];
+
+   amr->Par->AddParticles( NNewPar, NewParAttFlt, NewParAttInt, NewParID );
+
+
+// 3. add particles to their home patches
+   Par_AddParticleToPatch( lv, NNewPar_EachPatch, NewParID );
+
+   delete [] NewParID;
+
+} // FUNCTION : Par_AddNewParticleToPatch
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_AddParticleToPatch
+// Description :  Associate particles already stored in the particle repository with their home patches
+//
+// Note        :  1. Particle IDs must be stored contiguously in the order of their home patch indices
+//                   --> IDs of patch PID are stored in NewParID[ sum_{P<PID} NNewPar_EachPatch[P] ... ]
+//                2. Patches are processed in parallel, and amr->Par->NPar_Lv[lv] is updated only once
+//                3. Sort ParList[] of the updated patches for BITWISE_REPRODUCIBILITY
+//                4. Invoked by Par_AddNewParticleToPatch() and Par_FindHomePatch_UniformGrid()
+//                   --> The latter is used by Par_AddParticleAfterInit()
+//                5. NOT thread-safe --> must be invoked outside OpenMP parallel regions
+//
+// Parameter   :  lv                : Target refinement level
+//                NNewPar_EachPatch : Number of new particles in each real patch on lv
+//                NewParID          : Particle IDs sorted by their home patch indices
+//
+// Return      :  NPar, ParListSize, and ParList[] of all real patches on lv and amr->Par->NPar_Lv[lv]
+//-------------------------------------------------------------------------------------------------------
+void Par_AddParticleToPatch( const int lv, const int *NNewPar_EachPatch, const long *NewParID )
+{
+
+   const int NReal = amr->NPatchComma[lv][1];
+
+
+// 1. prefix sum to get the first new particle of each patch
+   long *NewParIdx0 = new long [NReal];
+
+   if ( NReal > 0 )  NewParIdx0[0] = 0;
+
+   for (int PID=1; PID<NReal; PID++)   NewParIdx0[PID] = NewParIdx0[PID-1] + NNewPar_EachPatch[PID-1];
+
+
+// 2. add particles to each patch
+// --> use a thread-private counter for amr->Par->NPar_Lv[lv] to avoid data race
+   long NPar_Lv_New = 0;
+
+#  pragma omp parallel for reduction( +:NPar_Lv_New ) schedule( PAR_OMP_SCHED, PAR_OMP_SCHED_CHUNK )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      if ( NNewPar_EachPatch[PID] == 0 )  continue;
+
+      const long_par *PType = amr->Par->Type;
+      long NPar_Lv_ThisPatch = 0;
+
+#     ifdef DEBUG_PARTICLE
+      const real_par *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+
+      amr->patch[0][lv][PID]->AddParticle( NNewPar_EachPatch[PID], NewParID+NewParIdx0[PID], &NPar_Lv_ThisPatch,
+                                           PType, ParPos, amr->Par->NPar_AcPlusInac, __FUNCTION__ );
+#     else
+      amr->patch[0][lv][PID]->AddParticle( NNewPar_EachPatch[PID], NewParID+NewParIdx0[PID], &NPar_Lv_ThisPatch,
+                                           PType );
+#     endif
+
+      NPar_Lv_New += NPar_Lv_ThisPatch;
+
+//    sort particles for bitwise reproducibility
+#     ifdef BITWISE_REPRODUCIBILITY
+      Par_SortParList( lv, PID );
+#     endif
+   } // for (int PID=0; PID<NReal; PID++)
+
+   amr->Par->NPar_Lv[lv] += NPar_Lv_New;
+
+   delete [] NewParIdx0;
+
+} // FUNCTION : Par_AddParticleToPatch
+
+
+
+#endif // #ifdef PARTICLE
@@ -655,11 +655,7 @@ void Par_EquilibriumIC::printArrays()
 // Note        :  1. Must call constructedDistribution() in advance
 //                2. Limitation: Particle construction is not parallelized
 //                   This function assumes that only the root rank constructs all particles to be scattered later
-//
-//                   TODO: Support parallel construction
-//                   The particle count for each rank needs to be passed as an argument to this function
-//                   Different ranks need different random seeds to construct their own particles within the same cloud
-//                   One possible way to ensure reproducibility is to set per-particle seeds based on the particle indices
+//                   --> Use constructParticlesInRange() instead to construct particles in parallel
 //
 // Parameter   :  Mass_AllRank : An array of all particles' masses
 //                Pos_AllRank  : An array of all particles' position vectors
@@ -683,10 +679,7 @@ void Par_EquilibriumIC::constructParticles( real_par *Mass_AllRank, real_par *Po
    if ( MPI_Rank == 0 )   Aux_Message( stdout, "Constructing the particles in Par_EquilibriumIC ...\n" );
 
 // determine the total enclosed mass within the maximum radius
-   const double TotCloudMass_Analytical = getAnalEnclosedMass( Cloud_MaxR );
-   TotCloudMass                         = ExtendedInterpolatedTable( Cloud_MaxR, RNPoints, RArray_R, RArray_M_Enc );
-   ParticleMass                         = TotCloudMass/Cloud_Par_Num;
-   TotCloudMassError                    = ( TotCloudMass - TotCloudMass_Analytical )/TotCloudMass_Analytical;
+   setParticleMass();
 
 // set the random number generator
    Random_Num_Gen = new RandomNumber_t( 1 );
@@ -700,20 +693,8 @@ void Par_EquilibriumIC::constructParticles( real_par *Mass_AllRank, real_par *Po
 // loop through each particle in the cloud
    for (long p=Par_Idx0; p<Par_Idx0+Cloud_Par_Num; p++)
    {
-//    randomly sample the enclosed mass
-      const double RandomSampleM = TotCloudMass*Random_Num_Gen->GetValue( 0, 0.0, 1.0 );
-
-//    randomly sample the radius from the enclosed mass profile with linear interpolation
-      const double RandomSampleR = Mis_InterpolateFromTable( RNPoints, RArray_M_Enc, RArray_R, RandomSampleM );
-
-//    randomly set the position vector with a given radius
-      getRandomVector_GivenLength( RandomSampleR, RandomVectorR );
-
-//    randomly sample the velocity magnitude from the distribution function
-      const double RandomSampleV = getRandomSampleVelocity( RandomSampleR );
-
-//    randomly set the velocity vector with the given magnitude
-      getRandomVector_GivenLength( RandomSampleV, RandomVectorV );
+//    randomly sample the position and velocity vectors
+      getRandomParticle( RandomVectorR, RandomVectorV, Random_Num_Gen, 0, CumulProbaDistr_GivenRadius );
 
 //    set the particle attributes
       Mass_AllRank[p] = ParticleMass;
@@ -738,6 +719,170 @@ void Par_EquilibriumIC::constructParticles( real_par *Mass_AllRank, real_par *Po
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  constructParticlesInRange
+// Description :  Set the particle's initial conditions (IC) for a range of particles in a cloud that is in an
+//                equilibrium state
+//
+// Note        :  1. Must call constructedDistribution() in advance
+//                2. Each particle draws random numbers from its own stream of a counter-based random number
+//                   generator keyed by ( Cloud_RSeed, particle index in the cloud )
+//                   --> Each MPI rank can construct only the particles it owns, and the results are bitwise
+//                       identical regardless of the numbers of MPI ranks and OpenMP threads
+//                   --> But they differ from the results of constructParticles() adopting a single random
+//                       number stream for the entire cloud
+//                3. Particles are constructed in parallel with OpenMP
+//                4. Particle [Cloud_ParIdx_Start+i] in the cloud is stored in [Par_Idx0+i] of the input arrays
+//
+// Parameter   :  Mass_ThisRank      : An array of particles' masses
+//                Pos_ThisRank       : An array of particles' position vectors
+//                Vel_ThisRank       : An array of particles' velocity vectors
+//                Par_Idx0           : Array index to store the first constructed particle
+//                Cloud_ParIdx_Start : Index of the first particle to be constructed in this cloud
+//                Cloud_ParIdx_End   : Index of the last particle to be constructed in this cloud plus one
+//
+// Return      :  Mass_ThisRank
+//                Pos_ThisRank
+//                Vel_ThisRank
+//-------------------------------------------------------------------------------------------------------
+void Par_EquilibriumIC::constructParticlesInRange( real_par *Mass_ThisRank, real_par *Pos_ThisRank[3], real_par *Vel_ThisRank[3],
+                                                   const long Par_Idx0, const long Cloud_ParIdx_Start, const long Cloud_ParIdx_End )
+{
+// verify the status of the action
+   if ( !hasConstructedDistribution )
+      Aux_Error( ERROR_INFO, "Must call constructedDistribution() before constructParticlesInRange() in Par_EquilibriumIC !!\n" );
+
+   if ( !hasSetCenterAndBulkVel )
+      Aux_Error( ERROR_INFO, "Must call setCenterAndBulkVel() before constructParticlesInRange() in Par_EquilibriumIC !!\n" );
+
+   if ( Cloud_ParIdx_Start < 0  ||  Cloud_ParIdx_Start > Cloud_ParIdx_End  ||  Cloud_ParIdx_End > Cloud_Par_Num )
+      Aux_Error( ERROR_INFO, "incorrect particle index range [%ld, %ld) (number of particles in the cloud = %ld) !!\n",
+                 Cloud_ParIdx_Start, Cloud_ParIdx_End, Cloud_Par_Num );
+
+// start
+   if ( MPI_Rank == 0 )   Aux_Message( stdout, "Constructing the particles in parallel in Par_EquilibriumIC ...\n" );
+
+// determine the total enclosed mass within the maximum radius
+   setParticleMass();
+
+// set one counter-based random number generator for each OpenMP thread
+   int NT;
+#  ifdef OPENMP
+#  pragma omp parallel
+#  pragma omp master
+   {  NT = omp_get_num_threads();  }
+#  else
+   {  NT = 1;                      }
+#  endif
+
+   CounterRandomNumber_t RNG( NT );
+
+// loop through each particle in the target range
+#  pragma omp parallel
+   {
+#     ifdef OPENMP
+      const int TID = omp_get_thread_num();
+#     else
+      const int TID = 0;
+#     endif
+
+      double  RandomVectorR[3];
+      double  RandomVectorV[3];
+      double *CumulProbaDistr = new double [ENPoints];
+
+#     pragma omp for schedule( static )
+      for (long c=Cloud_ParIdx_Start; c<Cloud_ParIdx_End; c++)
+      {
+         const long p = Par_Idx0 + c - Cloud_ParIdx_Start;
+
+//       randomly sample the position and velocity vectors using the random number stream of this particle
+         RNG.SetSeed( TID, Cloud_RSeed, c );
+
+         getRandomParticle( RandomVectorR, RandomVectorV, &RNG, TID, CumulProbaDistr );
+
+//       set the particle attributes
+         Mass_ThisRank[p] = ParticleMass;
+         for (int d=0; d<3; d++)   Pos_ThisRank[d][p] = Cloud_Center[d]  + RandomVectorR[d];
+         for (int d=0; d<3; d++)   Vel_ThisRank[d][p] = Cloud_BulkVel[d] + RandomVectorV[d];
+
+//       check the periodicity
+         for (int d=0; d<3; d++)
+            if ( OPT__BC_FLU[d*2] == BC_FLU_PERIODIC )   Pos_ThisRank[d][p] = fmod( (double)Pos_ThisRank[d][p]+amr->BoxSize[d], amr->BoxSize[d] );
+      } // for (long c=Cloud_ParIdx_Start; c<Cloud_ParIdx_End; c++)
+
+      delete [] CumulProbaDistr;
+   } // OpenMP parallel region
+
+// end
+   if ( MPI_Rank == 0 )   Aux_Message( stdout, "Constructing the particles in parallel in Par_EquilibriumIC ... done\n" );
+
+// set the action flag
+   hasConstructedParticles = true;
+
+} // FUNCTION : constructParticlesInRange
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  setParticleMass
+// Description :  Set the total cloud mass and the mass of each particle
+//
+// Note        :  1. Called by constructParticles() and constructParticlesInRange()
+//
+// Parameter   :  None
+//
+// Return      :  TotCloudMass, ParticleMass, TotCloudMassError
+//-------------------------------------------------------------------------------------------------------
+void Par_EquilibriumIC::setParticleMass()
+{
+   const double TotCloudMass_Analytical = getAnalEnclosedMass( Cloud_MaxR );
+   TotCloudMass                         = ExtendedInterpolatedTable( Cloud_MaxR, RNPoints, RArray_R, RArray_M_Enc );
+   ParticleMass                         = TotCloudMass/Cloud_Par_Num;
+   TotCloudMassError                    = ( TotCloudMass - TotCloudMass_Analytical )/TotCloudMass_Analytical;
+
+} // FUNCTION : setParticleMass
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  getRandomParticle
+// Description :  Randomly sample the position and velocity vectors of a particle relative to the cloud center
+//                and bulk velocity
+//
+// Note        :  1. Called by constructParticles() and constructParticlesInRange()
+//                2. RNG_t can be RandomNumber_t or CounterRandomNumber_t
+//
+// Parameter   :  RandomVectorR   : Array to store the position vector
+//                RandomVectorV   : Array to store the velocity vector
+//                RNG             : Random number generator
+//                TID             : Target RNG ID
+//                CumulProbaDistr : Array with ENPoints elements to store the cumulative probability distribution
+//
+// Return      :  RandomVectorR, RandomVectorV
+//-------------------------------------------------------------------------------------------------------
+template <typename RNG_t>
+void Par_EquilibriumIC::getRandomParticle( double RandomVectorR[3], double RandomVectorV[3], RNG_t *RNG, const int TID,
+                                           double *CumulProbaDistr )
+{
+// randomly sample the enclosed mass
+   const double RandomSampleM = TotCloudMass*RNG->GetValue( TID, 0.0, 1.0 );
+
+// randomly sample the radius from the enclosed mass profile with linear interpolation
+   const double RandomSampleR = Mis_InterpolateFromTable( RNPoints, RArray_M_Enc, RArray_R, RandomSampleM );
+
+// randomly set the position vector with a given radius
+   getRandomVector_GivenLength( RandomSampleR, RandomVectorR, RNG, TID );
+
+// randomly sample the velocity magnitude from the distribution function
+   const double RandomSampleV = getRandomSampleVelocity( RandomSampleR, RNG, TID, CumulProbaDistr );
+
+// randomly set the velocity vector with the given magnitude
+   getRandomVector_GivenLength( RandomSampleV, RandomVectorV, RNG, TID );
+
+} // FUNCTION : getRandomParticle
+
+
+
 //-------------------------------------------------------------------------------------------------------
 // Function    :  getDensity
 // Description :  Get the density of this cloud at radius r
@@ -876,10 +1021,14 @@ double Par_EquilibriumIC::getExternalPotential( const double r )
 //                5. E is in the range  0 <= E <= Psi(r)
 //
 // Parameter   :  r                    : Radius
+//                RNG                  : Random number generator
+//                TID                  : Target RNG ID
+//                CumulProbaDistr      : Array with ENPoints elements to store the cumulative probability distribution
 //
 // Return      :  RandomSampleVelocity : Magnitude of velocity for a particle at radius r
 //-------------------------------------------------------------------------------------------------------
-double Par_EquilibriumIC::getRandomSampleVelocity( const double r )
+template <typename RNG_t>
+double Par_EquilibriumIC::getRandomSampleVelocity( const double r, RNG_t *RNG, const int TID, double *CumulProbaDistr )
 {
 // the relative potential at this radius
    const double Psi = -ExtendedInterpolatedTable( r, RNPoints, RArray_R, RArray_Phi );
@@ -890,19 +1039,19 @@ double Par_EquilibriumIC::getRandomSampleVelocity( const double r )
 //                        where Psi - 1/2 v_max^2 = E_min
    double Probability;
 
-   CumulProbaDistr_GivenRadius[0] = 0.0;
+   CumulProbaDistr[0] = 0.0;
    for (int i=1; i<ENPoints; i++)
    {
       if ( EArray_E[i] > Psi )   Probability = ( EArray_E[i-1] > Psi ) ? 0.0 : 0.5*EArray_DFunc[i-1]*sqrt(2.0*(Psi-EArray_E[i-1]))*(Psi-EArray_E[i-1]);
       else                       Probability = 0.5*( EArray_DFunc[i-1]*sqrt(2.0*(Psi-EArray_E[i-1])) +
                                                      EArray_DFunc[i  ]*sqrt(2.0*(Psi-EArray_E[i  ])) )*EArray_dE;
 
-      CumulProbaDistr_GivenRadius[i] = CumulProbaDistr_GivenRadius[i-1] + Probability;
+      CumulProbaDistr[i] = CumulProbaDistr[i-1] + Probability;
    }
 
-   const double TotalProbability        = CumulProbaDistr_GivenRadius[ELastIdx];
-   const double RandomSampleProbability = TotalProbability*Random_Num_Gen->GetValue( 0, 0.0, 1.0 );
-   const double RandomSampleE           = Mis_InterpolateFromTable( ENPoints, CumulProbaDistr_GivenRadius, EArray_E, RandomSampleProbability );
+   const double TotalProbability        = CumulProbaDistr[ELastIdx];
+   const double RandomSampleProbability = TotalProbability*RNG->GetValue( TID, 0.0, 1.0 );
+   const double RandomSampleE           = Mis_InterpolateFromTable( ENPoints, CumulProbaDistr, EArray_E, RandomSampleProbability );
 
 // v^2 = 2*(Psi-E)
    const double RandomSampleVelocity = ( RandomSampleE > Psi ) ? 0.0 : sqrt( 2.0*(Psi-RandomSampleE) );
@@ -972,14 +1121,17 @@ double Par_EquilibriumIC::getIntegratedDistributionFunction( const double E )
 //
 // Parameter   :  Length       : Input vector length
 //                RandomVector : Array to store the random 3D vector
+//                RNG          : Random number generator
+//                TID          : Target RNG ID
 //
 // Return      :  RandomVector
 //-------------------------------------------------------------------------------------------------------
-void Par_EquilibriumIC::getRandomVector_GivenLength( const double Length, double RandomVector[3] )
+template <typename RNG_t>
+void Par_EquilibriumIC::getRandomVector_GivenLength( const double Length, double RandomVector[3], RNG_t *RNG, const int TID )
 {
    do
    {
-      for (int d=0; d<3; d++)   RandomVector[d] = Random_Num_Gen->GetValue( 0, -1.0, +1.0 );
+      for (int d=0; d<3; d++)   RandomVector[d] = RNG->GetValue( TID, -1.0, +1.0 );
    }
    while ( SQR(RandomVector[0]) + SQR(RandomVector[1]) + SQR(RandomVector[2]) > 1.0 );
 
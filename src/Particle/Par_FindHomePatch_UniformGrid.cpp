@@ -69,7 +69,6 @@ void Par_FindHomePatch_UniformGrid( const int lv, const bool OldParOnly, const l
    const long      NewParID0  = NOldPar;
    const long      NTarPar    = amr->Par->NPar_AcPlusInac - NOldPar;
    const real_par *Pos[3]     = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
-   const long_par *PType      = amr->Par->Type;
    const int       NReal      = amr->NPatchComma[lv][1];
 
    real_par TParPos[3];
@@ -152,19 +151,26 @@ void Par_FindHomePatch_UniformGrid( const int lv, const bool OldParOnly, const l
 // 4. associate particles with their home patches
    if ( OldParOnly )    amr->Par->NPar_Lv[lv] = 0;
 
-// no OpenMP since AddParticle() will modify amr->Par->NPar_Lv[]
-   for (long t=0; t<NTarPar; t++)
-   {
-      const long ParID = NewParID0 + t;
-      const int  PID   = HomePID[t];
+// 4-1. sort particle IDs by their home patch indices while preserving the order of particles in each patch
+   int  *NTarPar_EachPatch = new int  [NReal];
+   long *TarParIdx0        = new long [NReal];
+   long *TarParID          = new long [NTarPar];
 
-#     ifdef DEBUG_PARTICLE
-      amr->patch[0][lv][PID]->AddParticle( 1, &ParID, &amr->Par->NPar_Lv[lv], PType,
-                                           Pos, amr->Par->NPar_AcPlusInac, __FUNCTION__ );
-#     else
-      amr->patch[0][lv][PID]->AddParticle( 1, &ParID, &amr->Par->NPar_Lv[lv], PType );
-#     endif
-   }
+   for (int PID=0; PID<NReal; PID++)   NTarPar_EachPatch[PID] = 0;
+   for (long t=0; t<NTarPar; t++)      NTarPar_EachPatch[ HomePID[t] ] ++;
+
+   if ( NReal > 0 )  TarParIdx0[0] = 0;
+   for (int PID=1; PID<NReal; PID++)   TarParIdx0[PID] = TarParIdx0[PID-1] + NTarPar_EachPatch[PID-1];
+
+   for (long t=0; t<NTarPar; t++)      TarParID[ TarParIdx0[ HomePID[t] ]++ ] = NewParID0 + t;
+
+// 4-2. add particles to all patches at once
+// --> also sort particles for bitwise reproducibility
+   Par_AddParticleToPatch( lv, NTarPar_EachPatch, TarParID );
+
+   delete [] NTarPar_EachPatch;
+   delete [] TarParIdx0;
+   delete [] TarParID;
 
 
    delete [] HomeLBIdx;
@@ -185,6 +191,9 @@ void Par_FindHomePatch_UniformGrid( const int lv, const bool OldParOnly, const l
 // Note        :  1. amr->LB->CutPoint[lv][] must be set in advance (e.g., by calling LB_SetCutPoint())
 //                2. Invoked by Par_FindHomePatch_UniformGrid()
 //                3. Inactive particles will NOT be redistributed
+//                4. Particles are exchanged in chunks of at most PAR_CHUNK_SIZE particles per rank
+//                   --> Bound the size of the MPI send buffer
+//                   --> The order of particles received from each rank is the same as exchanging all particles at once
 //
 // Parameter   :  lv           : Target level
 //                OldParOnly   : true  --> only redistribute particles already exist in the current repository
@@ -264,7 +273,35 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly, const long NNew
 
 
 // 2. construct the MPI send and recv data list
-   MPI_Alltoall( Send_Count, 1, MPI_LONG, Recv_Count, 1, MPI_LONG, MPI_COMM_WORLD );
+//    --> particles are exchanged in chunks of at most PAR_CHUNK_SIZE particles per rank to bound the size of
+//        the MPI send buffer
+//    --> all ranks must perform the same number of exchanges
+   const long NChunk_ThisRank = ( NTarPar + PAR_CHUNK_SIZE - 1 ) / PAR_CHUNK_SIZE;
+   long NChunk;
+
+   MPI_Allreduce( &NChunk_ThisRank, &NChunk, 1, MPI_LONG, MPI_MAX, MPI_COMM_WORLD );
+
+   long *Send_Count_Chunk = new long [ NChunk*MPI_NRank ];
+   long *Recv_Count_Chunk = new long [ NChunk*MPI_NRank ];
+
+   for (long c=0; c<NChunk; c++)
+   {
+      long *Send_Count_c = Send_Count_Chunk + c*MPI_NRank;
+      long *Recv_Count_c = Recv_Count_Chunk + c*MPI_NRank;
+
+      for (int r=0; r<MPI_NRank; r++)  Send_Count_c[r] = 0L;
+
+      for (long ParID=c*PAR_CHUNK_SIZE; ParID<MIN( (c+1)*PAR_CHUNK_SIZE, NTarPar ); ParID++)
+         if ( TRank[ParID] != -1 )  Send_Count_c[ TRank[ParID] ] ++;
+
+      MPI_Alltoall( Send_Count_c, 1, MPI_LONG, Recv_Count_c, 1, MPI_LONG, MPI_COMM_WORLD );
+   }
+
+   for (int r=0; r<MPI_NRank; r++)
+   {
+      Recv_Count[r] = 0L;
+      for (long c=0; c<NChunk; c++)    Recv_Count[r] += Recv_Count_Chunk[ c*MPI_NRank + r ];
+   }
 
    Send_Disp[0] = 0L;
    Recv_Disp[0] = 0L;
@@ -284,15 +321,16 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly, const long NNew
 #  endif
 
 
-// 3. redistribute particle attributes (one attribute at a time to save memory)
+// 3. redistribute particle attributes (one attribute and one chunk at a time to save memory)
    const long NOldPar            = ( OldParOnly ) ?       NULL_INT : amr->Par->NPar_AcPlusInac;
    const long UpdatedParListSize = ( OldParOnly ) ? Recv_Count_Sum : amr->Par->NPar_AcPlusInac + Recv_Count_Sum;
+   const long SendBufSize        = MAX( 1L, MIN(PAR_CHUNK_SIZE, NTarPar) );
 
-   long Offset[MPI_NRank];
+   long Offset[MPI_NRank], Send_Disp_c[MPI_NRank], Recv_Disp_c[MPI_NRank];
 
-   real_par *SendBuf_Flt = new real_par [Send_Count_Sum];
+   real_par *SendBuf_Flt = new real_par [SendBufSize];
    real_par *RecvBuf_Flt = NULL;
-   long_par *SendBuf_Int = new long_par [Send_Count_Sum];
+   long_par *SendBuf_Int = new long_par [SendBufSize];
    long_par *RecvBuf_Int = NULL;
 
 // 3-1. record attribute pointers
@@ -314,18 +352,9 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly, const long NNew
 // 3-2. redistribute floating-point data
    for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)
    {
-//    3-2-1. initialize the array offsets of all target ranks
-      for (int r=0; r<MPI_NRank; r++)  Offset[r] = Send_Disp[r];
-
-//    3-2-2. prepare send buffer (skip inactive particles)
-      for (long ParID=0; ParID<NTarPar; ParID++)
-         if ( TRank[ParID] != -1 )  SendBuf_Flt[ Offset[TRank[ParID]] ++ ] = SendAttFltPtr[v][ParID];
-
-//    3-2-3. free/allocate the old/new particle arrays and set the recv buffer
+//    3-2-1. allocate the new particle arrays and set the recv buffer
       if ( OldParOnly )
       {
-         free( SendAttFltPtr[v] );
-
          *(OldAttFltPtrPtr[v]) = (real_par*)malloc( UpdatedParListSize*sizeof(real_par) );
          RecvBuf_Flt           = *(OldAttFltPtrPtr[v]);
       }
@@ -336,25 +365,39 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly, const long NNew
          RecvBuf_Flt           = *(OldAttFltPtrPtr[v]) + NOldPar;
       }
 
-//    3-2-4. redistribute data
-      MPI_Alltoallv_GAMER( SendBuf_Flt, Send_Count, Send_Disp, MPI_GAMER_REAL_PAR, RecvBuf_Flt, Recv_Count, Recv_Disp, MPI_GAMER_REAL_PAR, MPI_COMM_WORLD );
+      for (int r=0; r<MPI_NRank; r++)  Recv_Disp_c[r] = Recv_Disp[r];
+
+      for (long c=0; c<NChunk; c++)
+      {
+         long *Send_Count_c = Send_Count_Chunk + c*MPI_NRank;
+         long *Recv_Count_c = Recv_Count_Chunk + c*MPI_NRank;
+
+//       3-2-2. initialize the array offsets of all target ranks
+         Send_Disp_c[0] = 0L;
+         for (int r=1; r<MPI_NRank; r++)  Send_Disp_c[r] = Send_Disp_c[r-1] + Send_Count_c[r-1];
+         for (int r=0; r<MPI_NRank; r++)  Offset     [r] = Send_Disp_c[r];
+
+//       3-2-3. prepare send buffer (skip inactive particles)
+         for (long ParID=c*PAR_CHUNK_SIZE; ParID<MIN( (c+1)*PAR_CHUNK_SIZE, NTarPar ); ParID++)
+            if ( TRank[ParID] != -1 )  SendBuf_Flt[ Offset[TRank[ParID]] ++ ] = SendAttFltPtr[v][ParID];
+
+//       3-2-4. redistribute data
+//              --> data received from each rank are appended right after those received in the previous chunks
+         MPI_Alltoallv_GAMER( SendBuf_Flt, Send_Count_c, Send_Disp_c, MPI_GAMER_REAL_PAR, RecvBuf_Flt, Recv_Count_c, Recv_Disp_c, MPI_GAMER_REAL_PAR, MPI_COMM_WORLD );
+
+         for (int r=0; r<MPI_NRank; r++)  Recv_Disp_c[r] += Recv_Count_c[r];
+      } // for (long c=0; c<NChunk; c++)
+
+//    3-2-5. free the old particle arrays
+      if ( OldParOnly )    free( SendAttFltPtr[v] );
    } // for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)
 
 // 3-3. redistribute integer data
    for (int v=0; v<PAR_NATT_INT_TOTAL; v++)
    {
-//    3-3-1. initialize the array offsets of all target ranks
-      for (int r=0; r<MPI_NRank; r++)  Offset[r] = Send_Disp[r];
-
-//    3-3-2. prepare send buffer (skip inactive particles)
-      for (long ParID=0; ParID<NTarPar; ParID++)
-         if ( TRank[ParID] != -1 )  SendBuf_Int[ Offset[TRank[ParID]] ++ ] = SendAttIntPtr[v][ParID];
-
-//    3-3-3. free/allocate the old/new particle arrays and set the recv buffer
+//    3-3-1. allocate the new particle arrays and set the recv buffer
       if ( OldParOnly )
       {
-         free( SendAttIntPtr[v] );
-
          *(OldAttIntPtrPtr[v]) = (long_par*)malloc( UpdatedParListSize*sizeof(long_par) );
          RecvBuf_Int           = *(OldAttIntPtrPtr[v]);
       }
@@ -365,8 +408,30 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly, const long NNew
          RecvBuf_Int           = *(OldAttIntPtrPtr[v]) + NOldPar;
       }
 
-//    3-3-4. redistribute data
-      MPI_Alltoallv_GAMER( SendBuf_Int, Send_Count, Send_Disp, MPI_GAMER_LONG_PAR, RecvBuf_Int, Recv_Count, Recv_Disp, MPI_GAMER_LONG_PAR, MPI_COMM_WORLD );
+      for (int r=0; r<MPI_NRank; r++)  Recv_Disp_c[r] = Recv_Disp[r];
+
+      for (long c=0; c<NChunk; c++)
+      {
+         long *Send_Count_c = Send_Count_Chunk + c*MPI_NRank;
+         long *Recv_Count_c = Recv_Count_Chunk + c*MPI_NRank;
+
+//       3-3-2. initialize the array offsets of all target ranks
+         Send_Disp_c[0] = 0L;
+         for (int r=1; r<MPI_NRank; r++)  Send_Disp_c[r] = Send_Disp_c[r-1] + Send_Count_c[r-1];
+         for (int r=0; r<MPI_NRank; r++)  Offset     [r] = Send_Disp_c[r];
+
+//       3-3-3. prepare send buffer (skip inactive particles)
+         for (long ParID=c*PAR_CHUNK_SIZE; ParID<MIN( (c+1)*PAR_CHUNK_SIZE, NTarPar ); ParID++)
+            if ( TRank[ParID] != -1 )  SendBuf_Int[ Offset[TRank[ParID]] ++ ] = SendAttIntPtr[v][ParID];
+
+//       3-3-4. redistribute data
+         MPI_Alltoallv_GAMER( SendBuf_Int, Send_Count_c, Send_Disp_c, MPI_GAMER_LONG_PAR, RecvBuf_Int, Recv_Count_c, Recv_Disp_c, MPI_GAMER_LONG_PAR, MPI_COMM_WORLD );
+
+         for (int r=0; r<MPI_NRank; r++)  Recv_Disp_c[r] += Recv_Count_c[r];
+      } // for (long c=0; c<NChunk; c++)
+
+//    3-3-5. free the old particle arrays
+      if ( OldParOnly )    free( SendAttIntPtr[v] );
    } // for (int v=0; v<PAR_NATT_INT_TOTAL; v++)
 
 
@@ -429,6 +494,8 @@ void SendParticle2HomeRank( const int lv, const bool OldParOnly, const long NNew
    delete [] TRank;
    delete [] SendBuf_Flt;
    delete [] SendBuf_Int;
+   delete [] Send_Count_Chunk;
+   delete [] Recv_Count_Chunk;
 
 } // FUNCTION : SendParticle2HomeRank
 
@@ -71,6 +71,8 @@ void Par_Init_ByFile()
 // Description :  Initialize particle attributes from a file
 //
 // Note        :  1. Refer to the "Note" section in "Particle/Par_Init_ByFile.cpp -> Par_Init_ByFile()"
+//                2. Load at most PAR_CHUNK_SIZE particles at a time by a single fread() per chunk
+//                   --> Data are converted and stored into the particle repository directly with OpenMP
 //
 // Parameter   :  None
 //
@@ -129,117 +131,142 @@ void Par_Init_ByFile_Default()
       Aux_Error( ERROR_INFO, "total number of particles found (%ld) != expect (%ld) !!\n", NPar_Check, NParAllRank );
 
 
-// load data
+// map the attribute indices on the disk to that in Par->AttributeFlt/Int[]
+// --> assuming that the orders of the particle attributes stored on the disk and in Par->AttributeFlt/Int[] are the same
+// --> no need to skip acceleration and time since they are always put at the end of the attribute list
+   int AttFltIdx[NParAttFlt], AttIntIdx[NParAttInt];
+
+   for (int v_in=0, v_out=0; v_in<NParAttFlt; v_in++, v_out++)
+   {
+      if ( SingleParMass  &&  v_out == PAR_MASS )  v_out ++;
+
+      AttFltIdx[v_in] = v_out;
+   }
+
+   for (int v_in=0, v_out=0; v_in<NParAttInt; v_in++, v_out++)
+   {
+      if ( SingleParType  &&  v_out == PAR_TYPE )  v_out ++;
+
+      AttIntIdx[v_in] = v_out;
+   }
+
+
+// load data and store them into the particle repository directly
+// --> load at most PAR_CHUNK_SIZE particles at a time to bound the size of the temporary buffer
+// --> each chunk is loaded by a single fread() and converted with OpenMP
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Loading data ... " );
 
-// allocate buffer for loading PAR_IC
-   char* ParFltData_ThisRank = new char [ NParThisRank*NParAttFlt*load_data_size_flt ];
-   char* ParIntData_ThisRank = new char [ NParThisRank*NParAttInt*load_data_size_int ];
+   const long ParSize    = long(NParAttFlt)*load_data_size_flt + long(NParAttInt)*load_data_size_int;
+   const long NChunkPar  = MAX( 1L, MIN(PAR_CHUNK_SIZE, NParThisRank) );
+   char      *ChunkData  = new char [ NChunkPar*ParSize ];
 
 // note that fread() may fail for large files if sizeof(size_t) == 4 instead of 8
    FILE *File = fopen( FileName, "rb" );
 
+// [id][att]
    if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT )
    {
-      for (int r=0; r<MPI_Rank; r++)   FileOffset += NPar_EachRank[r]*( long(NParAttFlt)*load_data_size_flt + long(NParAttInt)*load_data_size_int );
+      for (int r=0; r<MPI_Rank; r++)   FileOffset += NPar_EachRank[r]*ParSize;
 
       fseek( File, FileOffset, SEEK_SET );
 
-      for (long p=0; p<NParThisRank; p++)
+      for (long p0=0; p0<NParThisRank; p0+=NChunkPar)
       {
-         fread( ParFltData_ThisRank+p*NParAttFlt*load_data_size_flt, load_data_size_flt, long(NParAttFlt), File );
-         fread( ParIntData_ThisRank+p*NParAttInt*load_data_size_int, load_data_size_int, long(NParAttInt), File );
-      }
-   }
-
+         const long NPar = MIN( NChunkPar, NParThisRank-p0 );
+
+         if ( (long)fread( ChunkData, ParSize, NPar, File ) != NPar )
+            Aux_Error( ERROR_INFO, "failed to load particles %ld -- %ld from the file \"%s\" on rank %d !!\n",
+                       p0, p0+NPar-1, FileName, MPI_Rank );
+
+#        pragma omp parallel for schedule( static )
+         for (long p=0; p<NPar; p++)
+         {
+            const char *FltPtr = ChunkData + p*ParSize;
+            const char *IntPtr = FltPtr + NParAttFlt*load_data_size_flt;
+
+            if ( PAR_IC_FLOAT8 )
+               for (int v=0; v<NParAttFlt; v++) amr->Par->AttributeFlt[ AttFltIdx[v] ][ p0+p ] = (real_par)( (const double*)FltPtr )[v];
+            else
+               for (int v=0; v<NParAttFlt; v++) amr->Par->AttributeFlt[ AttFltIdx[v] ][ p0+p ] = (real_par)( (const float* )FltPtr )[v];
+
+            if ( PAR_IC_INT8 )
+               for (int v=0; v<NParAttInt; v++) amr->Par->AttributeInt[ AttIntIdx[v] ][ p0+p ] = (long_par)( (const long*  )IntPtr )[v];
+            else
+               for (int v=0; v<NParAttInt; v++) amr->Par->AttributeInt[ AttIntIdx[v] ][ p0+p ] = (long_par)( (const int*   )IntPtr )[v];
+         }
+      } // for (long p0=0; p0<NParThisRank; p0+=NChunkPar)
+   } // if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT )
+
+// [att][id]
    else
    {
-      for (int r=0; r<MPI_Rank; r++)   FileOffset += NPar_EachRank[r]*load_data_size_flt;
+      long FileOffset_Flt = 0, FileOffset_Int = NParAllRank*NParAttFlt*load_data_size_flt;
 
-      for (int v=0; v<NParAttFlt; v++)
+      for (int r=0; r<MPI_Rank; r++)
       {
-         fseek( File, FileOffset, SEEK_SET );
-         fread( ParFltData_ThisRank+v*NParThisRank*load_data_size_flt, load_data_size_flt, NParThisRank, File );
-         FileOffset += NParAllRank*load_data_size_flt;
+         FileOffset_Flt += NPar_EachRank[r]*load_data_size_flt;
+         FileOffset_Int += NPar_EachRank[r]*load_data_size_int;
       }
 
-      for (int v=0; v<NParAttInt; v++)
+      for (int v=0; v<NParAttFlt+NParAttInt; v++)
       {
-         fseek( File, FileOffset, SEEK_SET );
-         fread( ParIntData_ThisRank+v*NParThisRank*load_data_size_int, load_data_size_int, NParThisRank, File );
-         FileOffset += NParAllRank*load_data_size_int;
-      }
+         const bool   IsFlt     = ( v < NParAttFlt );
+         const size_t DataSize  = ( IsFlt ) ? load_data_size_flt : load_data_size_int;
+         const long   VarOffset = ( IsFlt ) ? FileOffset_Flt + v*NParAllRank*load_data_size_flt
+                                            : FileOffset_Int + (v-NParAttFlt)*NParAllRank*load_data_size_int;
+
+         fseek( File, VarOffset, SEEK_SET );
+
+         for (long p0=0; p0<NParThisRank; p0+=NChunkPar)
+         {
+            const long NPar = MIN( NChunkPar, NParThisRank-p0 );
+
+            if ( (long)fread( ChunkData, DataSize, NPar, File ) != NPar )
+               Aux_Error( ERROR_INFO, "failed to load particles %ld -- %ld from the file \"%s\" on rank %d !!\n",
+                          p0, p0+NPar-1, FileName, MPI_Rank );
+
+            if ( IsFlt )
+            {
+               real_par *Att = amr->Par->AttributeFlt[ AttFltIdx[v] ] + p0;
+
+               if ( PAR_IC_FLOAT8 )
+#                 pragma omp parallel for schedule( static )
+                  for (long p=0; p<NPar; p++)   Att[p] = (real_par)( (const double*)ChunkData )[p];
+               else
+#                 pragma omp parallel for schedule( static )
+                  for (long p=0; p<NPar; p++)   Att[p] = (real_par)( (const float* )ChunkData )[p];
+            }
+
+            else
+            {
+               long_par *Att = amr->Par->AttributeInt[ AttIntIdx[v-NParAttFlt] ] + p0;
+
+               if ( PAR_IC_INT8 )
+#                 pragma omp parallel for schedule( static )
+                  for (long p=0; p<NPar; p++)   Att[p] = (long_par)( (const long*  )ChunkData )[p];
+               else
+#                 pragma omp parallel for schedule( static )
+                  for (long p=0; p<NPar; p++)   Att[p] = (long_par)( (const int*   )ChunkData )[p];
+            }
+         } // for (long p0=0; p0<NParThisRank; p0+=NChunkPar)
+      } // for (int v=0; v<NParAttFlt+NParAttInt; v++)
    } // if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT ) ... else ...
 
    fclose( File );
 
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
-
-
-// store data into the particle repository
-   if ( MPI_Rank == 0 )    Aux_Message( stdout, "   Storing data into particle repository ... " );
+   delete [] ChunkData;
 
-   real_par *ParFltData1 = new real_par [NParAttFlt];
-   long_par *ParIntData1 = new long_par [NParAttInt];
 
+// set the attributes not stored on the disk
+#  pragma omp parallel for schedule( static )
    for (long p=0; p<NParThisRank; p++)
    {
-//    collect data for the target particle
-//    [id][att]
-      if ( amr->Par->ParICFormat == PAR_IC_FORMAT_ID_ATT )
-      {
-         if ( PAR_IC_FLOAT8 )
-            for (int v=0; v<NParAttFlt; v++) ParFltData1[v] = (real_par)( *((double*)(ParFltData_ThisRank+(p*NParAttFlt+v)*load_data_size_flt)) );
-         else
-            for (int v=0; v<NParAttFlt; v++) ParFltData1[v] = (real_par)( *((float* )(ParFltData_ThisRank+(p*NParAttFlt+v)*load_data_size_flt)) );
-
-         if ( PAR_IC_INT8 )
-            for (int v=0; v<NParAttInt; v++) ParIntData1[v] = (long_par)( *((long*  )(ParIntData_ThisRank+(p*NParAttInt+v)*load_data_size_int)) );
-         else
-            for (int v=0; v<NParAttInt; v++) ParIntData1[v] = (long_par)( *((int*   )(ParIntData_ThisRank+(p*NParAttInt+v)*load_data_size_int)) );
-      }
-
-//    [att][id]
-      else
-      {
-         if ( PAR_IC_FLOAT8 )
-            for (int v=0; v<NParAttFlt; v++) ParFltData1[v] = (real_par)( *((double*)(ParFltData_ThisRank+(v*NParThisRank+p)*load_data_size_flt)) );
-         else
-            for (int v=0; v<NParAttFlt; v++) ParFltData1[v] = (real_par)( *((float* )(ParFltData_ThisRank+(v*NParThisRank+p)*load_data_size_flt)) );
-
-         if ( PAR_IC_INT8 )
-            for (int v=0; v<NParAttInt; v++) ParIntData1[v] = (long_par)( *((long*  )(ParIntData_ThisRank+(v*NParThisRank+p)*load_data_size_int)) );
-         else
-            for (int v=0; v<NParAttInt; v++) ParIntData1[v] = (long_par)( *((int*   )(ParIntData_ThisRank+(v*NParThisRank+p)*load_data_size_int)) );
-      }
-
-//    assuming that the orders of the particle attributes stored on the disk and in Par->AttributeFlt/Int[] are the same
-//    --> no need to skip acceleration and time since they are always put at the end of the attribute list
-      for (int v_in=0, v_out=0; v_in<NParAttFlt; v_in++, v_out++)
-      {
-         if ( SingleParMass  &&  v_out == PAR_MASS )  v_out ++;
-
-         amr->Par->AttributeFlt[v_out][p] = ParFltData1[v_in];
-      }
-
-      for (int v_in=0, v_out=0; v_in<NParAttInt; v_in++, v_out++)
-      {
-         if ( SingleParType  &&  v_out == PAR_TYPE )  v_out ++;
-
-         amr->Par->AttributeInt[v_out][p] = ParIntData1[v_in];
-      }
-
       if ( SingleParMass )    amr->Par->Mass[p] = amr->Par->ParICMass;
       if ( SingleParType )    amr->Par->Type[p] = amr->Par->ParICType;
 
 //    synchronize all particles to the physical time at the base level
       amr->Par->Time[p] = Time[0];
-   } // for (long p=0; p<NParThisRank; p++)
-
-   delete [] ParFltData_ThisRank;
-   delete [] ParIntData_ThisRank;
-   delete [] ParFltData1;
-   delete [] ParIntData1;
+   }
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "done\n" );
 
@@ -34,13 +34,24 @@ static bool FarAwayParticle( real_par ParPosX, real_par ParPosY, real_par ParPos
 //                           mass to Rho[] (in other words, each target particle may contribute to more than one cell
 //                           even with the NGP scheme), which is not considered here!
 //                   --> This is the reason for the check "if ( Periodic[d]  &&  RhoSize > PeriodicSize[d] ) ..."
-//                6. For bitwise reproducibility, particles are sorted by their position before mass deposition
-//                   --> Also refer to the note of the routine Mis_SortByRows()
+//                6. For bitwise reproducibility, particles are deposited in the order of the input list, which
+//                   must already be sorted in a canonical order
+//                   --> ParList[] of each patch is kept sorted by particle position by Par_SortParList()
+//                       when enabling BITWISE_REPRODUCIBILITY
+//                   --> ParList_Copy[] of non-leaf patches concatenates the ParList[] of descendants in a fixed order
+//                       (see Par_CollectParticle2OneLevel())
+//                   --> ParAttFlt_Copy[] and ParAttInt_Copy[] of non-leaf patches are sorted by particle position
+//                       in Par_LB_CollectParticle2OneLevel(), and those of leaf buffer patches follow the
+//                       ParList[] of the corresponding real patches
+//                   --> So we do not need to copy and sort particles here
 //                   --> Sorting by velocity may be necessary for STAR_FORMATION, where the new star particles
 //                       created at different time but the same position may still have the same position for a
 //                       while if velocity*dt is on the order of round-off errors
 //                       --> Not supported yet since we may not have the velocity information (e.g., when adopting
 //                           UseInputMassPos)
+//                7. CIC and TSC process particles in batches of PAR_MASS_ASSIGN_BATCH so that the cell indices and
+//                   weights can be computed in vectorizable loops
+//                   --> Mass is still deposited particle by particle in the order of the input list
 //
 // Parameter   :  ParList         : List of target particle IDs
 //                NPar            : Number of particles
@@ -124,11 +135,15 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
    if ( NPar == 0 )  return;
 
 
-// 2. set up attribute arrays, copy particle position since they might be modified during the position prediction
-   real_par *Mass   = NULL;
-   real_par *Pos[3] = { NULL, NULL, NULL };
-   long_par *PType  = NULL;
-   long  ParID, Idx;
+// 2. set up attribute arrays
+//    --> access the particle repository directly through ParList[] when UseInputMassPos is off
+//    --> particle position will be copied to ParPos[] before prediction so that the repository is not modified
+   const bool      PredictPos_Now = ( PredictPos  &&  !OPT__FREEZE_PAR );
+   const real_par *Mass           = NULL;
+   const real_par *Pos[3]         = { NULL, NULL, NULL };
+   const long_par *PType          = NULL;
+   long     Idx;
+   real_par ParPos[3];
 
    if ( UseInputMassPos )
    {
@@ -141,40 +156,15 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
 
    else
    {
-      Mass = new real_par [NPar];
-
-      for (int d=0; d<3; d++)    Pos[d] = new real_par [NPar];
-
-      PType = new long_par [NPar];
-
-      for (long p=0; p<NPar; p++)
-      {
-         ParID = ParList[p];
-
-         Mass  [p] = amr->Par->Mass[ParID];
-         Pos[0][p] = amr->Par->PosX[ParID];
-         Pos[1][p] = amr->Par->PosY[ParID];
-         Pos[2][p] = amr->Par->PosZ[ParID];
-         PType [p] = amr->Par->Type[ParID];
-      }
+      Mass   = amr->Par->Mass;
+      Pos[0] = amr->Par->PosX;
+      Pos[1] = amr->Par->PosY;
+      Pos[2] = amr->Par->PosZ;
+      PType  = amr->Par->Type;
    }
 
 
-// 3. predict particle position
-   if ( PredictPos  &&  ! OPT__FREEZE_PAR )  Par_PredictPos( NPar, ParList, Pos[0], Pos[1], Pos[2], TargetTime );
-
-
-// 3-1/2: sort particles by their position to fix the order of mass assignment
-//        --> necessary for achieving bitwise reproducibility
-#  ifdef BITWISE_REPRODUCIBILITY
-   long *Sort_IdxTable = new long [NPar];
-   const int Sort_Order[3] = { 0, 1, 2 };
-
-   Mis_SortByRows( Pos, Sort_IdxTable, (long)NPar, Sort_Order, 3 );
-#  endif
-
-
-// 4. deposit particle mass
+// 3. deposit particle mass
    const double _dh       = 1.0 / dh;
    const double _dh3      = CUBE(_dh);
    const double Ghost_Phy = amr->Par->GhostSize*dh;
@@ -198,31 +188,32 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
 
    switch ( IntScheme )
    {
-//    4.1 NGP
+//    3.1 NGP
       case ( PAR_INTERP_NGP ):
       {
          for (long p=0; p<NPar; p++)
          {
-#           ifdef BITWISE_REPRODUCIBILITY
-            Idx = Sort_IdxTable[p];
-#           else
-            Idx = p;
-#           endif
+            Idx = ( UseInputMassPos ) ? p : ParList[p];
 
-//          4.1.0 ignore tracer particles
+//          3.1.0 ignore tracer particles
 //                --> but still keep massless particles (i.e., with Mass[Idx]==0.0) for the option "UnitDens"
             if ( PType[Idx] == PTYPE_TRACER )
                continue;
 
-//          4.1.1 discard particles far away from the target region
-            if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
+//          3.1.1 predict particle position
+            for (int d=0; d<3; d++)    ParPos[d] = Pos[d][Idx];
+
+            if ( PredictPos_Now )   Par_PredictPos( 1, &Idx, ParPos+0, ParPos+1, ParPos+2, TargetTime );
+
+//          3.1.2 discard particles far away from the target region
+            if (  CheckFarAway  &&  FarAwayParticle( ParPos[0], ParPos[1], ParPos[2],
                                                      Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
                continue;
 
-//          4.1.2 calculate the nearest grid index
+//          3.1.3 calculate the nearest grid index
             for (int d=0; d<3; d++)
             {
-               idxRho[d] = (int)FLOOR( ( Pos[d][Idx] - EdgeL[d] )*_dh );
+               idxRho[d] = (int)FLOOR( ( ParPos[d] - EdgeL[d] )*_dh );
 
 //             periodicity
                if ( Periodic[d] )
@@ -237,7 +228,7 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
                }
             }
 
-//          4.1.3 assign mass if within Rho[]
+//          3.1.4 assign mass if within Rho[]
 //          check inactive particles (which have negative mass)
 #           ifdef DEBUG_PARTICLE
             if ( Mass[Idx] < (real_par)0.0 )
@@ -254,174 +245,158 @@ void Par_MassAssignment( const long *ParList, const long NPar, const ParInterp_t
       break;
 
 
-//    4.2 CIC
+//    3.2 CIC and 3.3 TSC
+//    --> particles are processed in batches of PAR_MASS_ASSIGN_BATCH
+//        (1) collect the position and density of particles with potential contribution to Rho[]
+//        (2) compute the cell indices and weights of all particles in a batch together, which involves no branch
+//            and can be vectorized by the compiler
+//        (3) scatter mass to Rho[] particle by particle in the order of the input list for bitwise reproducibility
+//            --> boundary checks are skipped for particles whose stencil lies entirely within Rho[]
+//    --> same arithmetic as depositing particles one by one, so the results are identical
       case ( PAR_INTERP_CIC ):
+      case ( PAR_INTERP_TSC ):
       {
-         int    idxLR[2][3];     // array index of the left (idxLR[0][d]) and right (idxLR[1][d]) cells
-         double dr      [3];     // distance to the center of the left cell
-         double Frac [2][3];     // weighting of the left (Frac[0][d]) and right (Frac[1][d]) cells
-
-         for (long p=0; p<NPar; p++)
+         const bool   TSC      = ( IntScheme == PAR_INTERP_TSC );
+         const int    NStencil = ( TSC ) ? 3 : 2;
+         const double dr_Shift = ( TSC ) ? 0.0 : 0.5;  // CIC: distance to the center of the left cell
+                                                       // TSC: distance to the left edge of the central cell
+         const int    idx_Left = ( TSC ) ? -1 : 0;     // left cell index relative to the one containing dr
+
+         int      idxStencil[3][3];                              // array index of cells in the stencil
+         real_par BatchPos [3][PAR_MASS_ASSIGN_BATCH];           // particle position
+         real     BatchDens   [PAR_MASS_ASSIGN_BATCH];           // mass density of the cloud
+         int      BatchIdxL[3][PAR_MASS_ASSIGN_BATCH];           // array index of the leftmost cell in the stencil
+         double   BatchFrac[3][3][PAR_MASS_ASSIGN_BATCH];        // weighting of the stencil cells [d][cell][particle]
+
+         for (long p0=0; p0<NPar; p0+=PAR_MASS_ASSIGN_BATCH)
          {
-#           ifdef BITWISE_REPRODUCIBILITY
-            Idx = Sort_IdxTable[p];
-#           else
-            Idx = p;
-#           endif
+            const long p1 = MIN( p0+PAR_MASS_ASSIGN_BATCH, NPar );
+            int NBatch = 0;
 
-//          4.2.0 ignore tracer particles
-//                --> but still keep massless particles (i.e., with Mass[Idx]==0.0) for the option "UnitDens"
-            if ( PType[Idx] == PTYPE_TRACER )
-               continue;
+//          3.2.1 collect particles
+            for (long p=p0; p<p1; p++)
+            {
+               Idx = ( UseInputMassPos ) ? p : ParList[p];
 
-//          4.2.1 discard particles far away from the target region
-            if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
-                                                     Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
-               continue;
+//             ignore tracer particles
+//             --> but still keep massless particles (i.e., with Mass[Idx]==0.0) for the option "UnitDens"
+               if ( PType[Idx] == PTYPE_TRACER )
+                  continue;
 
-            for (int d=0; d<3; d++)
-            {
-//             4.2.2 calculate the array index of the left and right cells
-               dr      [d]  = (double)( Pos[d][Idx] - (real_par)EdgeL[d] )*_dh - 0.5;
-               idxLR[0][d]  = (int)FLOOR( dr[d] );
-               idxLR[1][d]  = idxLR[0][d] + 1;
-               dr      [d] -= (double)idxLR[0][d];
+//             predict particle position
+               for (int d=0; d<3; d++)    ParPos[d] = Pos[d][Idx];
 
-//             periodicity
-               if ( Periodic[d] )
-               {
-                  for (int t=0; t<2; t++)
-                  {
-                     idxLR[t][d] = ( idxLR[t][d] + PeriodicSize[d] ) % PeriodicSize[d];
+               if ( PredictPos_Now )   Par_PredictPos( 1, &Idx, ParPos+0, ParPos+1, ParPos+2, TargetTime );
 
-#                    ifdef DEBUG_PARTICLE
-                     if ( idxLR[t][d] < 0  ||  idxLR[t][d] >= PeriodicSize[d] )
-                        Aux_Error( ERROR_INFO, "incorrect idxLR[%d][%d] = %d (PeriodicSize = %d) !!\n",
-                                   t, d, idxLR[t][d], PeriodicSize[d] );
-#                    endif
-                  }
-               }
+//             discard particles far away from the target region
+               if (  CheckFarAway  &&  FarAwayParticle( ParPos[0], ParPos[1], ParPos[2],
+                                                        Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
+                  continue;
 
-//             4.2.3 get the weighting of the nearby 8 cells
-               Frac[0][d] = 1.0 - dr[d];
-               Frac[1][d] =       dr[d];
-            } // for (int d=0; d<3; d++)
+//             check inactive particles (which have negative mass)
+#              ifdef DEBUG_PARTICLE
+               if ( Mass[Idx] < (real_par)0.0 )
+                  Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
+#              endif
 
-//          4.2.4 assign mass if within Rho[]
-//          check inactive particles (which have negative mass)
-#           ifdef DEBUG_PARTICLE
-            if ( Mass[Idx] < (real_par)0.0 )
-               Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
-#           endif
+               for (int d=0; d<3; d++)    BatchPos[d][NBatch] = ParPos[d];
 
-            if ( UnitDens )   ParDens = (real)1.0;
-            else              ParDens = (real)Mass[Idx]*_dh3;
+               if ( UnitDens )   BatchDens[NBatch] = (real)1.0;
+               else              BatchDens[NBatch] = (real)Mass[Idx]*_dh3;
 
-            for (int k=0; k<2; k++) {  idxRho[2] = idxLR[k][2];
-            for (int j=0; j<2; j++) {  idxRho[1] = idxLR[j][1];
-            for (int i=0; i<2; i++) {  idxRho[0] = idxLR[i][0];
+               NBatch ++;
+            } // for (long p=p0; p<p1; p++)
 
-               if (  WithinRho( idxRho, RhoSize )  )
-                  Rho3D[ idxRho[2] ][ idxRho[1] ][ idxRho[0] ] += ParDens*Frac[i][0]*Frac[j][1]*Frac[k][2];
 
-            }}}
-         } // for (long p=0; p<NPar; p++)
-      } // PAR_INTERP_CIC
-      break;
+//          3.2.2 calculate the array index of the leftmost cell and the weighting of the nearby 8/27 cells
+            for (int d=0; d<3; d++)
+            {
+               const real_par EdgeL_d = (real_par)EdgeL[d];
 
+               for (int n=0; n<NBatch; n++)
+               {
+                  double dr = (double)( BatchPos[d][n] - EdgeL_d )*_dh - dr_Shift;
+                  const int idx = (int)FLOOR( dr );
 
-//    4.3 TSC
-      case ( PAR_INTERP_TSC ):
-      {
-         int    idxLCR[3][3];    // array index of the left (idxLCR[0][d]), central (idxLCR[1][d]) and right (idxLCR[2][d]) cells
-         double dr       [3];    // distance to the left edge of the central cell
-         double Frac  [3][3];    // weighting of the left (Frac[0][d]), central (Frac[1][d]) and right (Frac[2][d]) cells
+                  dr -= (double)idx;
+                  BatchIdxL[d][n] = idx + idx_Left;
 
-         for (long p=0; p<NPar; p++)
-         {
-#           ifdef BITWISE_REPRODUCIBILITY
-            Idx = Sort_IdxTable[p];
-#           else
-            Idx = p;
-#           endif
+                  if ( TSC )
+                  {
+                     BatchFrac[d][0][n] = 0.5*SQR( 1.0 - dr );
+                     BatchFrac[d][1][n] = 0.5*( 1.0 + 2.0*dr - 2.0*SQR(dr) );
+                     BatchFrac[d][2][n] = 0.5*SQR( dr );
+                  }
 
-//          4.3.0 ignore tracer particles
-//                --> but still keep massless particles (i.e., with Mass[Idx]==0.0) for the option "UnitDens"
-            if ( PType[Idx] == PTYPE_TRACER )
-               continue;
+                  else
+                  {
+                     BatchFrac[d][0][n] = 1.0 - dr;
+                     BatchFrac[d][1][n] =       dr;
+                  }
+               } // for (int n=0; n<NBatch; n++)
+            } // for (int d=0; d<3; d++)
 
-//          4.3.1 discard particles far away from the target region
-            if (  CheckFarAway  &&  FarAwayParticle( Pos[0][Idx], Pos[1][Idx], Pos[2][Idx],
-                                                     Periodic, PeriodicSize_Phy, EdgeWithGhostL, EdgeWithGhostR )  )
-               continue;
 
-            for (int d=0; d<3; d++)
+//          3.2.3 assign mass
+            for (int n=0; n<NBatch; n++)
             {
-//             4.3.2 calculate the array index of the left, central, and right cells
-               dr       [d]  = (double)( Pos[d][Idx] - (real_par)EdgeL[d] )*_dh;
-               idxLCR[1][d]  = (int)FLOOR( dr[d] );
-               idxLCR[0][d]  = idxLCR[1][d] - 1;
-               idxLCR[2][d]  = idxLCR[1][d] + 1;
-               dr       [d] -= (double)idxLCR[1][d];
+               const real Dens     = BatchDens[n];
+               bool       Interior = true;
 
-//             periodicity
-               if ( Periodic[d] )
+               for (int d=0; d<3; d++)
+                  if ( BatchIdxL[d][n] < 0  ||  BatchIdxL[d][n]+NStencil > RhoSize )   Interior = false;
+
+//             (a) entire stencil lies within Rho[]
+//                 --> no periodicity correction is required since RhoSize <= PeriodicSize
+               if ( Interior )
                {
-                  for (int t=0; t<3; t++)
-                  {
-                     idxLCR[t][d] = ( idxLCR[t][d] + PeriodicSize[d] ) % PeriodicSize[d];
+                  for (int k=0; k<NStencil; k++) {  const int kk = BatchIdxL[2][n] + k;
+                  for (int j=0; j<NStencil; j++) {  const int jj = BatchIdxL[1][n] + j;
+                  for (int i=0; i<NStencil; i++) {  const int ii = BatchIdxL[0][n] + i;
 
-#                    ifdef DEBUG_PARTICLE
-                     if ( idxLCR[t][d] < 0  ||  idxLCR[t][d] >= PeriodicSize[d] )
-                        Aux_Error( ERROR_INFO, "incorrect idxLCR[%d][%d] = %d (PeriodicSize = %d) !!\n",
-                                   t, d, idxLCR[t][d], PeriodicSize[d] );
-#                    endif
-                  }
-               }
+                     Rho3D[kk][jj][ii] += Dens*BatchFrac[0][i][n]*BatchFrac[1][j][n]*BatchFrac[2][k][n];
 
-//             4.3.3 get the weighting of the nearby 27 cells
-               Frac[0][d] = 0.5*SQR( 1.0 - dr[d] );
-               Frac[1][d] = 0.5*( 1.0 + 2.0*dr[d] - 2.0*SQR(dr[d]) );
-               Frac[2][d] = 0.5*SQR( dr[d] );
-            } // for (int d=0; d<3; d++)
+                  }}}
+               }
 
-//          4.3.4 assign mass if within Rho[]
-//          check inactive particles (which have negative mass)
-#           ifdef DEBUG_PARTICLE
-            if ( Mass[Idx] < (real)0.0 )
-               Aux_Error( ERROR_INFO, "Mass[%ld] = %14.7e < 0.0 !!\n", Idx, Mass[Idx] );
-#           endif
+//             (b) stencil crosses the boundary of Rho[]
+               else
+               {
+                  for (int d=0; d<3; d++)
+                  for (int t=0; t<NStencil; t++)
+                  {
+                     idxStencil[t][d] = BatchIdxL[d][n] + t;
+
+//                   periodicity
+                     if ( Periodic[d] )
+                     {
+                        idxStencil[t][d] = ( idxStencil[t][d] + PeriodicSize[d] ) % PeriodicSize[d];
+
+#                       ifdef DEBUG_PARTICLE
+                        if ( idxStencil[t][d] < 0  ||  idxStencil[t][d] >= PeriodicSize[d] )
+                           Aux_Error( ERROR_INFO, "incorrect idxStencil[%d][%d] = %d (PeriodicSize = %d) !!\n",
+                                      t, d, idxStencil[t][d], PeriodicSize[d] );
+#                       endif
+                     }
+                  }
 
-            if ( UnitDens )   ParDens = (real)1.0;
-            else              ParDens = (real)Mass[Idx]*_dh3;
+                  for (int k=0; k<NStencil; k++) {  idxRho[2] = idxStencil[k][2];
+                  for (int j=0; j<NStencil; j++) {  idxRho[1] = idxStencil[j][1];
+                  for (int i=0; i<NStencil; i++) {  idxRho[0] = idxStencil[i][0];
 
-            for (int k=0; k<3; k++) {  idxRho[2] = idxLCR[k][2];
-            for (int j=0; j<3; j++) {  idxRho[1] = idxLCR[j][1];
-            for (int i=0; i<3; i++) {  idxRho[0] = idxLCR[i][0];
+                     if (  WithinRho( idxRho, RhoSize )  )
+                        Rho3D[ idxRho[2] ][ idxRho[1] ][ idxRho[0] ] += Dens*BatchFrac[0][i][n]*BatchFrac[1][j][n]*BatchFrac[2][k][n];
 
-               if (  WithinRho( idxRho, RhoSize )  )
-                  Rho3D[ idxRho[2] ][ idxRho[1] ][ idxRho[0] ] += ParDens*Frac[i][0]*Frac[j][1]*Frac[k][2];
-            }}}
-         } // for (long p=0; p<NPar; p++)
-      } // PAR_INTERP_TSC
+                  }}}
+               } // if ( Interior ) ... else ...
+            } // for (int n=0; n<NBatch; n++)
+         } // for (long p0=0; p0<NPar; p0+=PAR_MASS_ASSIGN_BATCH)
+      } // PAR_INTERP_CIC and PAR_INTERP_TSC
       break;
 
       default: Aux_Error( ERROR_INFO, "unsupported particle interpolation scheme !!\n" );
    } // switch ( IntScheme )
 
-
-// 5. free memory
-   if ( !UseInputMassPos )
-   {
-      delete [] Mass;
-      delete [] PType;
-      for (int d=0; d<3; d++)    delete [] Pos[d];
-   }
-
-#  ifdef BITWISE_REPRODUCIBILITY
-   delete [] Sort_IdxTable;
-#  endif
-
 } // FUNCTION : Par_MassAssignment
 
 
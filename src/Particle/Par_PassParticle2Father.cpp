@@ -69,6 +69,10 @@ void Par_PassParticle2Father( const int FaLv, const int FaPID )
    amr->patch[0][FaLv][FaPID]->AddParticle( NParSon, ParListSon, &amr->Par->NPar_Lv[FaLv], PType );
 #  endif
 
+#  ifdef BITWISE_REPRODUCIBILITY
+   Par_SortParList( FaLv, FaPID );
+#  endif
+
 
 // 4. remove particles in all sons
 //###NOTE: No OpenMP since RemoveParticle will modify amr->Par->NPar_Lv[]
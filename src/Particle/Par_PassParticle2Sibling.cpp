@@ -24,6 +24,8 @@ extern Timer_t *Timer_Par_MPI[NLEVEL][6];
 //                   into the simulation domain if periodic B.C. is assumed
 //                3. Particles transferred to buffer patches (at either lv or lv-1) will be resent to their
 //                   corresponding real patches by calling Par_LB_ExchangeParticleBetweenPatch()
+//                4. For BITWISE_REPRODUCIBILITY, the particle lists of all real patches at lv and lv-1 are sorted
+//                   by Par_SortParList() afterwards
 //
 // Parameter   :  lv            : Target refinement level
 //                TimingSendPar : Measure the elapsed time of Par_LB_SendParticleData(), which is called by
@@ -384,11 +386,22 @@ void Par_PassParticle2Sibling( const int lv, const bool TimingSendPar )
 #  endif // #ifdef LOAD_BALANCE
 
 
-// 8. get the total number of active particles in all MPI ranks
+// 8. sort particles in all real patches at lv and lv-1 for bitwise reproducibility
+//    --> particle position at lv has been updated and new particles may have been added to lv and lv-1
+#  ifdef BITWISE_REPRODUCIBILITY
+   for (int TLv=MAX(FaLv,0); TLv<=lv; TLv++)
+   {
+#     pragma omp parallel for schedule( PAR_OMP_SCHED, PAR_OMP_SCHED_CHUNK )
+      for (int PID=0; PID<amr->NPatchComma[TLv][1]; PID++)  Par_SortParList( TLv, PID );
+   }
+#  endif
+
+
+// 9. get the total number of active particles in all MPI ranks
    MPI_Allreduce( &amr->Par->NPar_Active, &amr->Par->NPar_Active_AllRank, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
 
 
-// 9. free memory
+// 10. free memory
    for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
    for (int s=0; s<26; s++)
    {
@@ -85,6 +85,11 @@ void Par_PassParticle2Son_SinglePatch( const int FaLv, const int FaPID )
 #     else
       amr->patch[0][SonLv][SonPID]->AddParticle( NNewForSon[LocalID], NewListForSon[LocalID], &amr->Par->NPar_Lv[SonLv], PType );
 #     endif
+
+//    sort particles for bitwise reproducibility
+#     ifdef BITWISE_REPRODUCIBILITY
+      Par_SortParList( SonLv, SonPID );
+#     endif
    }
 
 
@@ -0,0 +1,179 @@
+#include "GAMER.h"
+
+#ifdef PARTICLE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_ReorderRepository
+// Description :  Reorder the particle repository so that particles belonging to the same patch are stored
+//                contiguously
+//
+// Note        :  1. Particles are relabeled level by level, and patches on each level are visited in the order
+//                   of their space-filling-curve index (LB_Idx)
+//                   --> Particles in nearby patches are also nearby in the repository, which improves cache
+//                       locality when updating particles and depositing particle mass
+//                   --> The order of particles within each patch (i.e., ParList[]) is preserved, so it works with
+//                       Par_SortParList() for BITWISE_REPRODUCIBILITY
+//                2. Inactive particles are discarded from the repository
+//                   --> NPar_AcPlusInac = NPar_Active and NPar_Inactive = 0 afterwards
+//                   --> ParListSize is unchanged so that particles can still be added without reallocation
+//                3. Update ParList[] of all real patches and ParList_Copy[] of all patches (for SERIAL) consistently
+//                   --> ParAttFlt_Copy[] and ParAttInt_Copy[] (for LOAD_BALANCE) store particle attributes
+//                       instead of IDs and thus are unaffected
+//                   --> Mesh_Attr[] of tracer particles is recomputed before every output and thus is not reordered
+//                4. All active particles must belong to exactly one leaf real patch and ParList_Escp[] of all
+//                   patches must be empty
+//                   --> Invoked by main() when all particles are synchronized
+//                5. Particle IDs change after reordering
+//                   --> So as the order of particles in the output files
+//                6. Invoked every PAR_REORDER_STEP root-level steps and after redistributing patches for
+//                   LOAD_BALANCE
+//                7. Each MPI rank reorders its own particles independently
+//
+// Parameter   :  None
+//
+// Return      :  amr->Par->AttributeFlt/Int[], amr->Par->NPar_AcPlusInac,
+//                amr->Par->NPar_Inactive, amr->patch[0][lv][PID]->ParList[], amr->patch[0][lv][PID]->ParList_Copy[]
+//-------------------------------------------------------------------------------------------------------
+void Par_ReorderRepository()
+{
+
+   const long NPar_Old = amr->Par->NPar_AcPlusInac;
+   const long NPar_New = amr->Par->NPar_Active;
+
+   long *NewToOld = new long [ MAX(NPar_New, 1L) ];   // old particle ID of each new particle ID
+   long *OldToNew = new long [ MAX(NPar_Old, 1L) ];   // new particle ID of each old particle ID (-1 for inactive particles)
+   long  NewParID = 0;
+
+   for (long p=0; p<NPar_Old; p++)  OldToNew[p] = -1;
+
+
+// 1. relabel particles level by level in the order of LB_Idx
+   for (int lv=0; lv<NLEVEL; lv++)
+   {
+      const int NReal = amr->NPatchComma[lv][1];
+
+      if ( NReal == 0 )    continue;
+
+      long *LB_Idx   = new long [NReal];
+      int  *IdxTable = new int  [NReal];
+
+      for (int PID=0; PID<NReal; PID++)   LB_Idx[PID] = amr->patch[0][lv][PID]->LB_Idx;
+
+      Mis_Heapsort( NReal, LB_Idx, IdxTable );
+
+      for (int t=0; t<NReal; t++)
+      {
+         const int PID  = IdxTable[t];
+         long *ParList  = amr->patch[0][lv][PID]->ParList;
+
+#        ifdef DEBUG_PARTICLE
+         for (int s=0; s<26; s++)
+            if ( amr->patch[0][lv][PID]->NPar_Escp[s] > 0 )
+               Aux_Error( ERROR_INFO, "lv %d, PID %d, NPar_Escp[%d] = %d > 0 !!\n",
+                          lv, PID, s, amr->patch[0][lv][PID]->NPar_Escp[s] );
+#        endif
+
+         for (int p=0; p<amr->patch[0][lv][PID]->NPar; p++)
+         {
+            const long OldParID = ParList[p];
+
+#           ifdef DEBUG_PARTICLE
+            if ( OldParID < 0  ||  OldParID >= NPar_Old )
+               Aux_Error( ERROR_INFO, "incorrect particle ID (%ld) in lv %d, PID %d (NPar_AcPlusInac = %ld) !!\n",
+                          OldParID, lv, PID, NPar_Old );
+
+            if ( OldToNew[OldParID] != -1 )
+               Aux_Error( ERROR_INFO, "particle %ld is found in more than one patch !!\n", OldParID );
+
+            if ( amr->Par->Mass[OldParID] < (real_par)0.0 )
+               Aux_Error( ERROR_INFO, "inactive particle %ld (mass = %14.7e) is found in lv %d, PID %d !!\n",
+                          OldParID, amr->Par->Mass[OldParID], lv, PID );
+#           endif
+
+            if ( NewParID >= NPar_New )
+               Aux_Error( ERROR_INFO, "number of particles in patches > NPar_Active (%ld) !!\n", NPar_New );
+
+            NewToOld[NewParID] = OldParID;
+            OldToNew[OldParID] = NewParID;
+            ParList [p]        = NewParID;
+
+            NewParID ++;
+         }
+      } // for (int t=0; t<NReal; t++)
+
+      delete [] LB_Idx;
+      delete [] IdxTable;
+   } // for (int lv=0; lv<NLEVEL; lv++)
+
+   if ( NewParID != NPar_New )
+      Aux_Error( ERROR_INFO, "number of particles in patches (%ld) != NPar_Active (%ld) !!\n", NewParID, NPar_New );
+
+
+// 2. permute particle attributes
+   real_par *FltBuf = new real_par [ MAX(NPar_New, 1L) ];
+   long_par *IntBuf = new long_par [ MAX(NPar_New, 1L) ];
+
+   for (int v=0; v<PAR_NATT_FLT_TOTAL; v++)
+   {
+      const real_par *AttFlt = amr->Par->AttributeFlt[v];
+
+#     pragma omp parallel for schedule( static )
+      for (long p=0; p<NPar_New; p++)  FltBuf[p] = AttFlt[ NewToOld[p] ];
+
+      memcpy( amr->Par->AttributeFlt[v], FltBuf, NPar_New*sizeof(real_par) );
+   }
+
+   for (int v=0; v<PAR_NATT_INT_TOTAL; v++)
+   {
+      const long_par *AttInt = amr->Par->AttributeInt[v];
+
+#     pragma omp parallel for schedule( static )
+      for (long p=0; p<NPar_New; p++)  IntBuf[p] = AttInt[ NewToOld[p] ];
+
+      memcpy( amr->Par->AttributeInt[v], IntBuf, NPar_New*sizeof(long_par) );
+   }
+
+   delete [] FltBuf;
+   delete [] IntBuf;
+
+
+// 3. update the particle IDs collected by non-leaf patches
+//    --> particle IDs in ParList_Copy[] must refer to active particles
+#  ifndef LOAD_BALANCE
+   for (int lv=0; lv<NLEVEL; lv++)
+   for (int PID=0; PID<amr->num[lv]; PID++)
+   {
+      if ( amr->patch[0][lv][PID]->ParList_Copy == NULL )   continue;
+
+      long *ParList_Copy = amr->patch[0][lv][PID]->ParList_Copy;
+
+      for (int p=0; p<amr->patch[0][lv][PID]->NPar_Copy; p++)
+      {
+#        ifdef DEBUG_PARTICLE
+         if ( OldToNew[ ParList_Copy[p] ] == -1 )
+            Aux_Error( ERROR_INFO, "inactive particle %ld is found in ParList_Copy (lv %d, PID %d) !!\n",
+                       ParList_Copy[p], lv, PID );
+#        endif
+
+         ParList_Copy[p] = OldToNew[ ParList_Copy[p] ];
+      }
+   }
+#  endif
+
+
+// 4. discard inactive particles
+   amr->Par->NPar_AcPlusInac = NPar_New;
+   amr->Par->NPar_Inactive   = 0;
+
+
+   delete [] NewToOld;
+   delete [] OldToNew;
+
+} // FUNCTION : Par_ReorderRepository
+
+
+
+#endif // #ifdef PARTICLE
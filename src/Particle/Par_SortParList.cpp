@@ -0,0 +1,91 @@
+#include "GAMER.h"
+
+#ifdef PARTICLE
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Par_SortParList
+// Description :  Sort the particle list of the target patch by particle position
+//
+// Note        :  1. Particles are sorted by x first, then by y, and finally by z
+//                   --> Same as Mis_SortByRows() with SortOrder = { 0, 1, 2 }
+//                2. Used by BITWISE_REPRODUCIBILITY to keep ParList[] in a canonical order that is independent
+//                   of how particles arrived at the target patch (e.g., the number of MPI ranks and OpenMP threads)
+//                   --> Invoked after adding particles to a patch and after updating particle position
+//                   --> Par_MassAssignment() then deposits particles in the order of ParList[] directly without
+//                       copying and sorting them every time
+//                3. Sorted by the stored particle position (i.e., without position prediction)
+//                4. Do nothing if ParList[] is already sorted
+//                5. Thread-safe as long as different threads work on different patches
+//
+// Parameter   :  lv  : Target refinement level
+//                PID : Target patch index
+//
+// Return      :  amr->patch[0][lv][PID]->ParList[]
+//-------------------------------------------------------------------------------------------------------
+void Par_SortParList( const int lv, const int PID )
+{
+
+   const int       NPar      = amr->patch[0][lv][PID]->NPar;
+   long           *ParList   = amr->patch[0][lv][PID]->ParList;
+   const real_par *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
+
+
+// nothing to do if there are fewer than two particles
+   if ( NPar < 2 )   return;
+
+
+// 1. check whether the particle list is already sorted
+   bool Sorted = true;
+
+   for (int p=1; p<NPar; p++)
+   {
+      const long ParID0 = ParList[p-1];
+      const long ParID1 = ParList[p  ];
+      int d = 0;
+
+      while ( d < 3  &&  ParPos[d][ParID0] == ParPos[d][ParID1] )  d ++;
+
+      if ( d < 3  &&  ParPos[d][ParID0] > ParPos[d][ParID1] )
+      {
+         Sorted = false;
+         break;
+      }
+   }
+
+   if ( Sorted )  return;
+
+
+// 2. sort particles by position
+   real_par *Pos[3];
+   long     *ParList_Old   = new long [NPar];
+   long     *Sort_IdxTable = new long [NPar];
+   const int Sort_Order[3] = { 0, 1, 2 };
+
+   for (int d=0; d<3; d++)    Pos[d] = new real_par [NPar];
+
+   for (int p=0; p<NPar; p++)
+   {
+      const long ParID = ParList[p];
+
+      ParList_Old[p] = ParID;
+      for (int d=0; d<3; d++)    Pos[d][p] = ParPos[d][ParID];
+   }
+
+   Mis_SortByRows( Pos, Sort_IdxTable, (long)NPar, Sort_Order, 3 );
+
+   for (int p=0; p<NPar; p++)    ParList[p] = ParList_Old[ Sort_IdxTable[p] ];
+
+
+// 3. free memory
+   delete [] ParList_Old;
+   delete [] Sort_IdxTable;
+   for (int d=0; d<3; d++)    delete [] Pos[d];
+
+} // FUNCTION : Par_SortParList
+
+
+
+#endif // #ifdef PARTICLE
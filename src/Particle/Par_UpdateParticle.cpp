@@ -465,27 +465,29 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
                } // for (int d=0; d<3; d++)
 
 //             calculate acceleration
-               for (int d=0; d<3; d++)
+//             --> gather all three components in a single pass over the stencil
+#              ifdef STORE_PAR_ACC
+               if ( UseStoredAcc )
+                  for (int d=0; d<3; d++)    Acc_Temp[d] = (real)ParAcc[d][ParID];
+               else
+#              endif
                {
-#                 ifdef STORE_PAR_ACC
-                  if ( UseStoredAcc )
-                     Acc_Temp[d] = (real)ParAcc[d][ParID];
-                  else
-#                 endif
-                  {
-                     Acc_Temp[d] = (real)0.0;
+                  for (int d=0; d<3; d++)    Acc_Temp[d] = (real)0.0;
 
-                     for (int k=0; k<2; k++)
-                     for (int j=0; j<2; j++)
-                     for (int i=0; i<2; i++)
-                     Acc_Temp[d] += Acc3D[d][ idxLR[k][2] ][ idxLR[j][1] ][ idxLR[i][0] ]
-                                   *Frac[i][0]*Frac[j][1]*Frac[k][2];
-                  }
+                  for (int k=0; k<2; k++)  {  const int kk = idxLR[k][2];
+                  for (int j=0; j<2; j++)  {  const int jj = idxLR[j][1];
+                  for (int i=0; i<2; i++)  {  const int ii = idxLR[i][0];
 
-#                 ifdef STORE_PAR_ACC
-                  if ( StoreAcc )   ParAcc[d][ParID] = (real_par)Acc_Temp[d];
-#                 endif
+                     for (int d=0; d<3; d++)
+                     Acc_Temp[d] += Acc3D[d][kk][jj][ii]*Frac[i][0]*Frac[j][1]*Frac[k][2];
+
+                  }}}
                }
+
+#              ifdef STORE_PAR_ACC
+               if ( StoreAcc )
+                  for (int d=0; d<3; d++)    ParAcc[d][ParID] = (real_par)Acc_Temp[d];
+#              endif
             } // PAR_INTERP_CIC
             break;
 
@@ -541,27 +543,29 @@ void Par_UpdateParticle( const int lv, const double TimeNew, const double TimeOl
                } // for (int d=0; d<3; d++)
 
 //             calculate acceleration
-               for (int d=0; d<3; d++)
+//             --> gather all three components in a single pass over the stencil
+#              ifdef STORE_PAR_ACC
+               if ( UseStoredAcc )
+                  for (int d=0; d<3; d++)    Acc_Temp[d] = (real)ParAcc[d][ParID];
+               else
+#              endif
                {
-#                 ifdef STORE_PAR_ACC
-                  if ( UseStoredAcc )
-                     Acc_Temp[d] = (real)ParAcc[d][ParID];
-                  else
-#                 endif
-                  {
-                     Acc_Temp[d] = (real)0.0;
+                  for (int d=0; d<3; d++)    Acc_Temp[d] = (real)0.0;
 
-                     for (int k=0; k<3; k++)
-                     for (int j=0; j<3; j++)
-                     for (int i=0; i<3; i++)
-                     Acc_Temp[d] += Acc3D[d][ idxLCR[k][2] ][ idxLCR[j][1] ][ idxLCR[i][0] ]
-                                   *Frac[i][0]*Frac[j][1]*Frac[k][2];
-                  }
+                  for (int k=0; k<3; k++)  {  const int kk = idxLCR[k][2];
+                  for (int j=0; j<3; j++)  {  const int jj = idxLCR[j][1];
+                  for (int i=0; i<3; i++)  {  const int ii = idxLCR[i][0];
 
-#                 ifdef STORE_PAR_ACC
-                  if ( StoreAcc )   ParAcc[d][ParID] = (real_par)Acc_Temp[d];
-#                 endif
+                     for (int d=0; d<3; d++)
+                     Acc_Temp[d] += Acc3D[d][kk][jj][ii]*Frac[i][0]*Frac[j][1]*Frac[k][2];
+
+                  }}}
                }
+
+#              ifdef STORE_PAR_ACC
+               if ( StoreAcc )
+                  for (int d=0; d<3; d++)    ParAcc[d][ParID] = (real_par)Acc_Temp[d];
+#              endif
             } // PAR_INTERP_TSC
             break;
 
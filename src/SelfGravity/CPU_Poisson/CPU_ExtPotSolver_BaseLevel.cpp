@@ -13,6 +13,9 @@
 //                2. Set PotIsInit to false if the base-level potential has not been initialized
 //                   --> Useful when self-gravity is disabled
 //                3. Invoked by Gra_AdvanceDt()
+//                4. Use the cached external potential ext_pot_cache[] for OPT__EXT_POT == EXT_POT_TABLE
+//                   and EXT_POT_TABLE_CACHE (see Poi_UpdateExtPotCache())
+//                   --> Func() is invoked only for patches whose cache has not been set
 //
 // Parameter   :  Func             : Function pointer to the external potential routine
 //                AuxArray_Flt/Int : Auxiliary floating-point/integer arrays for adding external potential
@@ -50,9 +53,10 @@ void CPU_ExtPotSolver_BaseLevel( const ExtPot_t Func, const double AuxArray_Flt[
 #  endif
 
 
-   const int    lv   = 0;
-   const double dh   = amr->dh[lv];
-   const double dh_2 = 0.5*dh;
+   const int    lv       = 0;
+   const double dh       = amr->dh[lv];
+   const double dh_2     = 0.5*dh;
+   const bool   UseCache = Poi_UpdateExtPotCache( lv );
 
 #  pragma omp parallel
    {
@@ -63,6 +67,22 @@ void CPU_ExtPotSolver_BaseLevel( const ExtPot_t Func, const double AuxArray_Flt[
 #     pragma omp for schedule( runtime )
       for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
       {
+         if ( UseCache )
+         {
+            const real (*ExtPotCache)[PS1][PS1] = amr->patch[0][lv][PID]->ext_pot_cache;
+                  real (*Pot        )[PS1][PS1] = amr->patch[SaveSg][lv][PID]->pot;
+
+            for (int k=0; k<PS1; k++)
+            for (int j=0; j<PS1; j++)
+            for (int i=0; i<PS1; i++)
+            {
+               if ( PotIsInit )  Pot[k][j][i] += ExtPotCache[k][j][i];  // add
+               else              Pot[k][j][i]  = ExtPotCache[k][j][i];  // overwrite
+            }
+
+            continue;
+         }
+
          x0 = amr->patch[0][lv][PID]->EdgeL[0] + dh_2;
          y0 = amr->patch[0][lv][PID]->EdgeL[1] + dh_2;
          z0 = amr->patch[0][lv][PID]->EdgeL[2] + dh_2;
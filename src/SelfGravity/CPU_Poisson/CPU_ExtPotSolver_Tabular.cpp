@@ -0,0 +1,134 @@
+#include "CUPOT.h"
+
+#if ( defined GRAVITY  &&  !defined GPU )
+
+
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  CPU_ExtPotSolver_Tabular
+// Description :  Add the tabulated external potential (EXT_POT_TABLE) to the potential of a set of patch groups
+//
+// Note        :  1. Equivalent to CPU_ExtPotSolver() with ExtPot_Func = ExtPot_Tabular() but avoids
+//                   interpolating cell by cell
+//                   --> The table indices and the linear interpolation weights along x/y/z depend only on
+//                       the cell indices i/j/k, respectively
+//                   --> Compute them once per patch and direction, and then interpolate all cells along x
+//                       with a simple gather-and-multiply loop that the compiler can vectorize
+//                   --> The interpolation formula is kept the same as ExtPot_Tabular() so that the results
+//                       are bitwise identical
+//                2. OpenMP threads work on different patch groups
+//                3. Invoked by CPU_PoissonGravitySolver() only when CPUExtPot_Ptr == ExtPot_Tabular()
+//                   --> Not applicable to the routines replacing ExtPot_Tabular() in test problems
+//
+// Parameter   :  g_Pot_Array      : Array storing the input and output potential data of each target patch
+//                g_Corner_Array   : Array storing the physical corner coordinates of each patch
+//                g_ExtPotTable    : Array storing the external potential 3D table
+//                NPatchGroup      : Number of target patch groups
+//                dh               : Cell size
+//                AuxArray_Flt/Int : Auxiliary arrays set by SetExtPotAuxArray_Tabular()
+//                PotIsInit        : Whether the input potential has been initialized
+//                                   --> true : **add** external potential to the input data
+//                                       false: **overwrite** the input data
+//
+// Return      :  g_Pot_Array[]
+//-----------------------------------------------------------------------------------------
+void CPU_ExtPotSolver_Tabular( real g_Pot_Array[][ CUBE(GRA_NXT) ],
+                               const double g_Corner_Array[][3],
+                               const real g_ExtPotTable[],
+                               const int NPatchGroup, const real dh,
+                               const double AuxArray_Flt[], const int AuxArray_Int[],
+                               const bool PotIsInit )
+{
+
+   const double EdgeL[3] = { AuxArray_Flt[0], AuxArray_Flt[1], AuxArray_Flt[2] };
+   const double _dh  [3] = { AuxArray_Flt[3], AuxArray_Flt[4], AuxArray_Flt[5] };
+   const int    NPoint_x = AuxArray_Int[0];
+   const int    NPoint_y = AuxArray_Int[1];
+   const long   didx [3] = { 1, NPoint_x, (long)NPoint_x*NPoint_y };
+
+   const real   ONE      = (real)1.0;
+
+
+#  pragma omp parallel
+   {
+//    table offsets and interpolation weights along x/y/z
+      long Offset [3][GRA_NXT];
+      real WeightL[3][GRA_NXT], WeightR[3][GRA_NXT];
+
+#     pragma omp for schedule( runtime )
+      for (int PG=0; PG<NPatchGroup; PG++)
+      for (int LocalID=0; LocalID<8; LocalID++)
+      {
+         const int P = 8*PG + LocalID;
+
+//       1. get the lower corner table indices and the interpolation weights along each direction
+         for (int d=0; d<3; d++)
+         {
+            const double xyz0 = g_Corner_Array[P][d] - GRA_GHOST_SIZE*dh;
+
+            for (int t=0; t<GRA_NXT; t++)
+            {
+               const double xyz  = xyz0 + double(t*dh);
+               const real   dxyz = real( ( xyz - EdgeL[d] )*_dh[d] );
+               const int    idx  = int( dxyz );
+
+#              ifdef GAMER_DEBUG
+               if ( idx < 0  ||  idx+1 >= AuxArray_Int[d] )
+                  Aux_Error( ERROR_INFO, "%c index outside the table range (%c %14.7e, EdgeL %14.7e, _dh %13.7e, idx %d) !!\n",
+                             'x'+d, 'x'+d, xyz, EdgeL[d], _dh[d], idx );
+#              endif
+
+               Offset [d][t] = idx*didx[d];
+               WeightR[d][t] = dxyz - (real)idx;
+               WeightL[d][t] = ONE - WeightR[d][t];
+            }
+         }
+
+
+//       2. trilinear interpolation
+         real *Pot = g_Pot_Array[P];
+
+         for (int k=0; k<GRA_NXT; k++)
+         {
+            const real wzL = WeightL[2][k];
+            const real wzR = WeightR[2][k];
+
+            for (int j=0; j<GRA_NXT; j++)
+            {
+               const real  wyL = WeightL[1][j];
+               const real  wyR = WeightR[1][j];
+               const real *T00 = g_ExtPotTable + Offset[1][j] + Offset[2][k];
+               const real *T10 = T00 + didx[1];
+               const real *T01 = T00 + didx[2];
+               const real *T11 = T10 + didx[2];
+               real       *Out = Pot + IDX321( 0, j, k, GRA_NXT, GRA_NXT );
+
+               for (int i=0; i<GRA_NXT; i++)
+               {
+                  const long ox  = Offset [0][i];
+                  const real wxL = WeightL[0][i];
+                  const real wxR = WeightR[0][i];
+
+                  const real ExtPot = T00[ox  ] * wxL * wyL * wzL +
+                                      T00[ox+1] * wxR * wyL * wzL +
+                                      T10[ox  ] * wxL * wyR * wzL +
+                                      T01[ox  ] * wxL * wyL * wzR +
+                                      T10[ox+1] * wxR * wyR * wzL +
+                                      T11[ox  ] * wxL * wyR * wzR +
+                                      T01[ox+1] * wxR * wyL * wzR +
+                                      T11[ox+1] * wxR * wyR * wzR;
+
+                  if ( PotIsInit )  Out[i] += ExtPot;    // add to the input potential
+                  else              Out[i]  = ExtPot;    // overwrite the input potential
+               }
+            } // j
+         } // k
+      } // for PG, LocalID
+   } // OpenMP parallel region
+
+} // FUNCTION : CPU_ExtPotSolver_Tabular
+
+
+
+#endif // #if ( defined GRAVITY  &&  !defined GPU )
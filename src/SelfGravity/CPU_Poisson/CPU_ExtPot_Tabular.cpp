@@ -25,6 +25,7 @@
    III. Set initialization functions
         --> SetGPUExtPot_Tabular()
             SetCPUExtPot_Tabular()
+            IsCPUExtPot_Tabular()
             Init_ExtPot_Tabular()
 
 4. The external potential major routine, ExtPot_Tabular(),
@@ -220,6 +221,26 @@ void SetCPUExtPot_Tabular( ExtPot_t &CPUExtPot_Ptr )
    CPUExtPot_Ptr = ExtPot_Ptr;
 }
 
+
+
+//-----------------------------------------------------------------------------------------
+// Function    :  IsCPUExtPot_Tabular
+// Description :  Check whether the input CPU external potential routine is ExtPot_Tabular()
+//
+// Note        :  1. Test problems may replace ExtPot_Tabular() with their own routines for EXT_POT_TABLE
+//                   (e.g., the time-dependent potential of Hydro/CMZ)
+//                   --> Optimizations assuming a time-independent trilinear interpolation of the table
+//                       (i.e., Poi_UpdateExtPotCache() and CPU_ExtPotSolver_Tabular()) must check it first
+//
+// Parameter   :  CPUExtPot_Ptr : CPU external potential routine to be checked
+//
+// Return      :  true/false
+//-----------------------------------------------------------------------------------------
+bool IsCPUExtPot_Tabular( const ExtPot_t CPUExtPot_Ptr )
+{
+   return ( CPUExtPot_Ptr == ExtPot_Tabular );
+}
+
 #endif // #ifdef __CUDACC__ ... else ...
 
 
@@ -30,6 +30,13 @@ void CPU_ExtPotSolver( real g_Pot_Array[][ CUBE(GRA_NXT) ],
                        const double c_ExtPot_AuxArray_Flt[],
                        const int    c_ExtPot_AuxArray_Int[],
                        const double Time, const bool PotIsInit );
+void CPU_ExtPotSolver_Tabular( real g_Pot_Array[][ CUBE(GRA_NXT) ],
+                               const double g_Corner_Array[][3],
+                               const real g_ExtPotTable[],
+                               const int NPatchGroup, const real dh,
+                               const double AuxArray_Flt[], const int AuxArray_Int[],
+                               const bool PotIsInit );
+bool IsCPUExtPot_Tabular( const ExtPot_t CPUExtPot_Ptr );
 
 
 // Gravity solver prototypes
@@ -198,6 +205,12 @@ void CPU_PoissonGravitySolver( const real h_Rho_Array    [][RHO_NXT][RHO_NXT][RH
 
       if ( ExtPot )
       {
+//       use the batched interpolation routine for the tabulated external potential
+         if ( ExtPot == EXT_POT_TABLE  &&  IsCPUExtPot_Tabular(CPUExtPot_Ptr) )
+         CPU_ExtPotSolver_Tabular( (real(*)[ CUBE(GRA_NXT) ])h_Pot_Array_Out, h_Corner_Array, h_ExtPotTable,
+                                   NPatchGroup, dh, ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int, SelfGravity );
+
+         else
          CPU_ExtPotSolver( (real(*)[ CUBE(GRA_NXT) ])h_Pot_Array_Out, h_Corner_Array, h_ExtPotTable, h_ExtPotGenePtr,
                            NPatchGroup, dh, CPUExtPot_Ptr, ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
                            TimeNew, SelfGravity );
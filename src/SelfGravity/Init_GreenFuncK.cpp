@@ -4,6 +4,9 @@
 
 extern root_fftw::real_plan_nd FFTW_Plan_Poi;
 
+static bool LoadGreenFuncK( const char *FileName, const ulong Key, const long Size );
+static void SaveGreenFuncK( const char *FileName, const ulong Key, const long Size );
+
 
 
 
@@ -14,6 +17,10 @@ extern root_fftw::real_plan_nd FFTW_Plan_Poi;
 // Note        :  1. We only need to calculate it once during the initialization stage
 //                2. The zero-padding method is implemented
 //                3. Slab decomposition is assumed in FFTW
+//                4. For OPT__FFTW_CACHE, the local slab of each rank is stored in and loaded from the FFTW
+//                   cache directory
+//                   --> Validated by a hash key of all parameters the Green's function depends on
+//                   --> All ranks recompute it if any rank fails to load its slab since the FFT is collective
 //
 // Parameter   :  None
 //-------------------------------------------------------------------------------------------------------
@@ -66,35 +73,73 @@ void Init_GreenFuncK()
                  local_nx, local_ny, local_nz, local_nxyz, __INT_MAX__, total_local_size );
 
 
-// 2. calculate the Green's function in the real space
-   const double dh0   = amr->dh[0];
-   const double Coeff = -NEWTON_G*CUBE(dh0)/( (double)FFT_Size[0]*FFT_Size[1]*FFT_Size[2] );
-   double x, y, z, r;
-   int    kk;
-   long   idx;
+// 2. try loading the cached Green's function
+   const double dh0 = amr->dh[0];
+
+   char  FileName[MAX_STRING];
+   ulong Key            = 0UL;
+   int   Loaded         = false;
+   int   Loaded_AllRank = false;
 
    GreenFuncK = (real*) root_fftw::fft_malloc(sizeof(real) * total_local_size);
 
-   for (int k=0; k<local_nz; k++)   {  kk = k + local_z_start;
-                                       z  = ( kk <= NX0_TOT[2] ) ? kk*dh0 : (FFT_Size[2]-kk)*dh0;
-   for (int j=0; j<local_ny; j++)   {  y  = ( j  <= NX0_TOT[1] ) ? j *dh0 : (FFT_Size[1]-j )*dh0;
-   for (int i=0; i<local_nx; i++)   {  x  = ( i  <= NX0_TOT[0] ) ? i *dh0 : (FFT_Size[0]-i )*dh0;
+   if ( OPT__FFTW_CACHE )
+   {
+      const long   Para_Int[] = { NX0_TOT[0], NX0_TOT[1], NX0_TOT[2], MPI_NRank, MPI_Rank, (long)local_nz,
+                                  (long)local_z_start, (long)total_local_size, (long)sizeof(real), SUPPORT_FFTW };
+      const double Para_Flt[] = { dh0, NEWTON_G, GFUNC_COEFF0 };
+
+      Key = Aux_Hash( Para_Int, sizeof(Para_Int), AUX_HASH_INIT );
+      Key = Aux_Hash( Para_Flt, sizeof(Para_Flt), Key );
+#     if ( SUPPORT_FFTW == FFTW3 )
+      Key = Aux_Hash( fftw_version, strlen(fftw_version), Key );
+#     endif
+
+      FFTW_GetCacheFileName( FileName, "GreenFuncK", Key, MPI_Rank );
+
+      Loaded = LoadGreenFuncK( FileName, Key, total_local_size );
+
+//    all ranks must either load or recompute the Green's function since the FFT below is collective
+      MPI_Allreduce( &Loaded, &Loaded_AllRank, 1, MPI_INT, MPI_LAND, MPI_COMM_WORLD );
+
+      if ( Loaded_AllRank  &&  MPI_Rank == 0 )
+         Aux_Message( stdout, "   Load the Green's function from the FFTW cache\n" );
+   }
+
+
+   if ( !Loaded_AllRank )
+   {
+//    3. calculate the Green's function in the real space
+      const double Coeff = -NEWTON_G*CUBE(dh0)/( (double)FFT_Size[0]*FFT_Size[1]*FFT_Size[2] );
+      double x, y, z, r;
+      int    kk;
+      long   idx;
+
+      for (int k=0; k<local_nz; k++)   {  kk = k + local_z_start;
+                                          z  = ( kk <= NX0_TOT[2] ) ? kk*dh0 : (FFT_Size[2]-kk)*dh0;
+      for (int j=0; j<local_ny; j++)   {  y  = ( j  <= NX0_TOT[1] ) ? j *dh0 : (FFT_Size[1]-j )*dh0;
+      for (int i=0; i<local_nx; i++)   {  x  = ( i  <= NX0_TOT[0] ) ? i *dh0 : (FFT_Size[0]-i )*dh0;
+
+         r   = sqrt( x*x + y*y + z*z );
+         idx = ( (long)k*local_ny + j )*local_nx + i;
 
-      r   = sqrt( x*x + y*y + z*z );
-      idx = ( (long)k*local_ny + j )*local_nx + i;
+         GreenFuncK[idx] = real( Coeff / r );
 
-      GreenFuncK[idx] = real( Coeff / r );
+      }}}
 
-   }}}
 
+//    4. reset the Green's function at the origin
+//    ***by setting it equal to zero, we ignore the contribution from the mass within the same cell***
+      if ( MPI_Rank == 0 )    GreenFuncK[0] = GFUNC_COEFF0*Coeff/dh0;
 
-// 3. reset the Green's function at the origin
-// ***by setting it equal to zero, we ignore the contribution from the mass within the same cell***
-   if ( MPI_Rank == 0 )    GreenFuncK[0] = GFUNC_COEFF0*Coeff/dh0;
 
+//    5. convert the Green's function to the k space
+      root_fftw_r2c( FFTW_Plan_Poi, GreenFuncK );
 
-// 4. convert the Green's function to the k space
-   root_fftw_r2c( FFTW_Plan_Poi, GreenFuncK );
+
+//    6. store the result for future runs
+      if ( OPT__FFTW_CACHE )  SaveGreenFuncK( FileName, Key, total_local_size );
+   } // if ( !Loaded_AllRank )
 
 
    if ( MPI_Rank == 0 )    Aux_Message( stdout, "%s ... done\n", __FUNCTION__ );
@@ -103,4 +148,83 @@ void Init_GreenFuncK()
 
 
 
+//-------------------------------------------------------------------------------------------------------
+// Function    :  LoadGreenFuncK
+// Description :  Load the local slab of the k-space Green's function from the FFTW cache directory
+//
+// Note        :  1. File format: [Key][Size][sizeof(real)][GreenFuncK]
+//                2. Return false if the file does not exist or its header does not match
+//
+// Parameter   :  FileName : Target file name
+//                Key      : Expected hash key
+//                Size     : Expected number of elements in the local slab
+//
+// Return      :  true/false --> success/failure
+//-------------------------------------------------------------------------------------------------------
+bool LoadGreenFuncK( const char *FileName, const ulong Key, const long Size )
+{
+
+   if ( !Aux_CheckFileExist(FileName) )   return false;
+
+   FILE *File = fopen( FileName, "rb" );
+   if ( File == NULL )  return false;
+
+   ulong Key_File  = 0UL;
+   long  Size_File = -1L;
+   int   Real_File = -1;
+   bool  Match     = false;
+
+   if ( fread( &Key_File,  sizeof(ulong), 1, File ) == 1  &&
+        fread( &Size_File, sizeof(long),  1, File ) == 1  &&
+        fread( &Real_File, sizeof(int),   1, File ) == 1 )
+      Match = ( Key_File == Key  &&  Size_File == Size  &&  Real_File == (int)sizeof(real) );
+
+   if ( Match )
+      Match = ( fread( GreenFuncK, sizeof(real), Size, File ) == (size_t)Size );
+
+   fclose( File );
+
+   if ( !Match )  Aux_Message( stderr, "WARNING : cached Green's function \"%s\" is corrupted --> recompute it !!\n",
+                               FileName );
+
+   return Match;
+
+} // FUNCTION : LoadGreenFuncK
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SaveGreenFuncK
+// Description :  Store the local slab of the k-space Green's function in the FFTW cache directory
+//
+// Note        :  1. File format is described in LoadGreenFuncK()
+//
+// Parameter   :  FileName : Target file name
+//                Key      : Hash key
+//                Size     : Number of elements in the local slab
+//-------------------------------------------------------------------------------------------------------
+void SaveGreenFuncK( const char *FileName, const ulong Key, const long Size )
+{
+
+   FILE *File = fopen( FileName, "wb" );
+
+   if ( File == NULL )
+   {
+      Aux_Message( stderr, "WARNING : cannot create the Green's function cache \"%s\" !!\n", FileName );
+      return;
+   }
+
+   const int RealSize = sizeof(real);
+
+   fwrite( &Key,       sizeof(ulong), 1,    File );
+   fwrite( &Size,      sizeof(long),  1,    File );
+   fwrite( &RealSize,  sizeof(int),   1,    File );
+   fwrite( GreenFuncK, sizeof(real),  Size, File );
+
+   fclose( File );
+
+} // FUNCTION : SaveGreenFuncK
+
+
+
 #endif // #if ( defined GRAVITY  &&  defined SUPPORT_FFTW )
@@ -16,6 +16,10 @@
 //                       is NOT equal to the time of data stored previously (i.e., PotSgTime[0/1])
 //                3. Use extrapolation to obtain data outside the non-periodic boundaries
 //                4. h_Pot_Array_P_In[] must **exclude external potential** since it is for the Poisson solver
+//                5. Use the cached external potential ext_pot_cache[] for OPT__EXT_POT == EXT_POT_TABLE and
+//                   EXT_POT_TABLE_CACHE (see Poi_UpdateExtPotCache())
+//                   --> The tabulated external potential is time-independent and is thus the same for
+//                       EXT_POT_USAGE_SUB and EXT_POT_USAGE_SUB_TINT
 //
 // Parameter   :  lv               : Target refinement level
 //                PrepTime         : Target physical time to prepare the coarse-grid data
@@ -56,6 +60,11 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
    const double dh_2     = 0.5*dh;
 
 
+// set the cached external potential of all coarse-grid patches in advance since different OpenMP threads may
+// access the same coarse-grid patches
+   const bool   UseCache = Poi_UpdateExtPotCache( FaLv );
+
+
 
 // temporal interpolation parameters
    bool PotIntTime;
@@ -171,8 +180,9 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
 
 //          subtract external potential
             if ( OPT__EXT_POT )
-               CPot[ko][jo][io] -= CPUExtPot_Ptr( x, y, z, amr->PotSgTime[FaLv][PotSg], ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
-                                                  EXT_POT_USAGE_SUB, h_ExtPotTable, h_ExtPotGenePtr );
+               CPot[ko][jo][io] -= ( UseCache ) ? amr->patch[0][FaLv][FaPID]->ext_pot_cache[ki][ji][ii]
+                                              : CPUExtPot_Ptr( x, y, z, amr->PotSgTime[FaLv][PotSg], ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
+                                                               EXT_POT_USAGE_SUB, h_ExtPotTable, h_ExtPotGenePtr );
 
 //          temporal interpolation
             if ( PotIntTime )
@@ -181,8 +191,9 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
 
 //             subtract external potential
                if ( OPT__EXT_POT )
-                  CPot_IntT -= CPUExtPot_Ptr( x, y, z, amr->PotSgTime[FaLv][PotSg_IntT], ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
-                                              EXT_POT_USAGE_SUB_TINT, h_ExtPotTable, h_ExtPotGenePtr );
+                  CPot_IntT -= ( UseCache ) ? amr->patch[0][FaLv][FaPID]->ext_pot_cache[ki][ji][ii]
+                                          : CPUExtPot_Ptr( x, y, z, amr->PotSgTime[FaLv][PotSg_IntT], ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
+                                                           EXT_POT_USAGE_SUB_TINT, h_ExtPotTable, h_ExtPotGenePtr );
 
                CPot[ko][jo][io] =   PotWeighting     *CPot[ko][jo][io]
                                   + PotWeighting_IntT*CPot_IntT;
@@ -220,8 +231,9 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
 
 //                subtract external potential
                   if ( OPT__EXT_POT )
-                     CPot[ko][jo][io] -= CPUExtPot_Ptr( x, y, z, amr->PotSgTime[FaLv][PotSg], ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
-                                                        EXT_POT_USAGE_SUB, h_ExtPotTable, h_ExtPotGenePtr );
+                     CPot[ko][jo][io] -= ( UseCache ) ? amr->patch[0][FaLv][FaSibPID]->ext_pot_cache[ki][ji][ii]
+                                                    : CPUExtPot_Ptr( x, y, z, amr->PotSgTime[FaLv][PotSg], ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
+                                                                     EXT_POT_USAGE_SUB, h_ExtPotTable, h_ExtPotGenePtr );
 
 //                temporal interpolation
                   if ( PotIntTime )
@@ -230,8 +242,9 @@ void Poi_Prepare_Pot( const int lv, const double PrepTime, real h_Pot_Array_P_In
 
 //                   subtract external potential
                      if ( OPT__EXT_POT )
-                        CPot_IntT -= CPUExtPot_Ptr( x, y, z, amr->PotSgTime[FaLv][PotSg_IntT], ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
-                                                    EXT_POT_USAGE_SUB_TINT, h_ExtPotTable, h_ExtPotGenePtr );
+                        CPot_IntT -= ( UseCache ) ? amr->patch[0][FaLv][FaSibPID]->ext_pot_cache[ki][ji][ii]
+                                                : CPUExtPot_Ptr( x, y, z, amr->PotSgTime[FaLv][PotSg_IntT], ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
+                                                                 EXT_POT_USAGE_SUB_TINT, h_ExtPotTable, h_ExtPotGenePtr );
 
                      CPot[ko][jo][io] =   PotWeighting     *CPot[ko][jo][io]
                                         + PotWeighting_IntT*CPot_IntT;
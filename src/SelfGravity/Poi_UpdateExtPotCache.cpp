@@ -0,0 +1,81 @@
+#include "GAMER.h"
+
+#ifdef GRAVITY
+
+
+// external potential routine of EXT_POT_TABLE
+bool IsCPUExtPot_Tabular( const ExtPot_t CPUExtPot_Ptr );
+
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  Poi_UpdateExtPotCache
+// Description :  Fill up the cached external potential ext_pot_cache[] of all patches at the target level
+//
+// Note        :  1. Work only for OPT__EXT_POT == EXT_POT_TABLE and EXT_POT_TABLE_CACHE with the built-in
+//                   routine ExtPot_Tabular()
+//                   --> The tabulated external potential is time-independent, so ext_pot_cache[] only needs to
+//                       be recomputed for newly-allocated and reactivated patches
+//                   --> Disabled when a test problem replaces ExtPot_Tabular() (e.g., the time-dependent
+//                       potential of Hydro/CMZ)
+//                   --> ext_pot_cache[] is allocated on demand and is freed together with pot[] by
+//                       patch_t::gdelete()
+//                2. Invoked by CPU_ExtPotSolver_BaseLevel() and Poi_Prepare_Pot()
+//                   --> The latter also reads ext_pot_cache[] of buffer patches, so this function works on
+//                       both real and buffer patches
+//                3. Only patches with ext_pot_cache == NULL or ext_pot_cache[0][0][0] == EXT_POT_CACHE_NEED_INIT
+//                   are updated
+//                4. Cell-centered coordinates are computed in the same way as CPU_ExtPotSolver_BaseLevel()
+//                   and Poi_Prepare_Pot() to ensure that ext_pot_cache[] is bitwise identical to evaluating
+//                   the external potential on the fly
+//                5. Only the patches of Sg=0 store ext_pot_cache[]
+//                6. NOT thread-safe --> must be invoked outside OpenMP parallel regions
+//
+// Parameter   :  lv : Target refinement level
+//
+// Return      :  1. amr->patch[0][lv][PID]->ext_pot_cache[] of all patches at lv
+//                2. true  : ext_pot_cache[] is ready and should be used instead of CPUExtPot_Ptr()
+//                   false : ext_pot_cache[] is not applicable
+//-------------------------------------------------------------------------------------------------------
+bool Poi_UpdateExtPotCache( const int lv )
+{
+
+   if ( OPT__EXT_POT != EXT_POT_TABLE  ||  !EXT_POT_TABLE_CACHE  ||  !IsCPUExtPot_Tabular(CPUExtPot_Ptr) )
+      return false;
+
+
+   const double dh   = amr->dh[lv];
+   const double dh_2 = 0.5*dh;
+
+#  pragma omp parallel for schedule( runtime )
+   for (int PID=0; PID<amr->num[lv]; PID++)
+   {
+      patch_t *Patch = amr->patch[0][lv][PID];
+
+      if ( Patch->ext_pot_cache != NULL  &&  Patch->ext_pot_cache[0][0][0] != EXT_POT_CACHE_NEED_INIT )  continue;
+
+      if ( Patch->ext_pot_cache == NULL )    Patch->ext_pot_cache = new real [PS1][PS1][PS1];
+
+      const double x0 = Patch->EdgeL[0] + dh_2;
+      const double y0 = Patch->EdgeL[1] + dh_2;
+      const double z0 = Patch->EdgeL[2] + dh_2;
+
+      double x, y, z;
+
+      for (int k=0; k<PS1; k++)  {  z = z0 + k*dh;
+      for (int j=0; j<PS1; j++)  {  y = y0 + j*dh;
+      for (int i=0; i<PS1; i++)  {  x = x0 + i*dh;
+
+         Patch->ext_pot_cache[k][j][i] = CPUExtPot_Ptr( x, y, z, Time[lv], ExtPot_AuxArray_Flt, ExtPot_AuxArray_Int,
+                                                        EXT_POT_USAGE_ADD, h_ExtPotTable, h_ExtPotGenePtr );
+      }}}
+   } // for (int PID=0; PID<amr->num[lv]; PID++)
+
+   return true;
+
+} // FUNCTION : Poi_UpdateExtPotCache
+
+
+
+#endif // #ifdef GRAVITY
@@ -74,6 +74,17 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
    const real   Eff_times_dt   = Efficiency*dt;
 // const real   GraConst       = ( OPT__GRA_P5_GRADIENT ) ? -1.0/(12.0*dh) : -1.0/(2.0*dh);
    const real   GraConst       = ( false                ) ? -1.0/(12.0*dh) : -1.0/(2.0*dh); // P5 is NOT supported yet
+   const int    NReal          = amr->NPatchComma[lv][1];
+
+
+// new star particles are first staged in thread-local buffers and then added to the particle repository at once
+// in the order of patch and cell indices
+// --> avoid the OpenMP critical section for each patch and make particle IDs independent of thread scheduling
+   int       *NNewPar_EachPatch  = new int  [NReal];   // number of new particles in each patch
+   long      *StageIdx0          = new long [NReal];   // index of the first new particle of each patch in the thread-local buffer
+   long      *AllNewParIdx0      = new long [NReal];   // index of the first new particle of each patch in AllNewParAtt*[]
+   real_par (*AllNewParAttFlt)[PAR_NATT_FLT_TOTAL] = NULL;
+   long_par (*AllNewParAttInt)[PAR_NATT_INT_TOTAL] = NULL;
 
 
 // start of OpenMP parallel region
@@ -97,7 +108,11 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
    const int    MaxNewParPerPatch = CUBE(PS1);
    real_par   (*NewParAttFlt)[PAR_NATT_FLT_TOTAL] = new real_par [MaxNewParPerPatch][PAR_NATT_FLT_TOTAL];
    long_par   (*NewParAttInt)[PAR_NATT_INT_TOTAL] = new long_par [MaxNewParPerPatch][PAR_NATT_INT_TOTAL];
-   long        *NewParID                          = new long     [MaxNewParPerPatch];
+
+   long      StageSize = 0;   // capacity of the thread-local staging buffer
+   long      NStage    = 0;   // number of new particles in the thread-local staging buffer
+   real_par (*StageAttFlt)[PAR_NATT_FLT_TOTAL] = NULL;
+   long_par (*StageAttInt)[PAR_NATT_INT_TOTAL] = NULL;
 
    int NNewPar;
 
@@ -107,8 +122,11 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
 // --> bitwise reproducibility will still break when running with different numbers of OpenMP threads and/or MPI ranks
 //     unless both BITWISE_REPRODUCIBILITY and SF_CREATE_STAR_DET_RANDOM are enabled
 #  pragma omp for schedule( static )
-   for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+   for (int PID=0; PID<NReal; PID++)
    {
+      NNewPar_EachPatch[PID] = 0;
+      StageIdx0        [PID] = NStage;
+
 //    skip non-leaf patches
       if ( amr->patch[0][lv][PID]->son != -1 )  continue;
 
@@ -260,47 +278,77 @@ void SF_CreateStar_AGORA( const int lv, const real TimeNew, const real dt, Rando
 
 
 
-//    4. create new star particles
+//    4. append new star particles to the thread-local staging buffer
 //    ===========================================================================================================
-//    use OpenMP critical construct since both amr->Par->AddOneParticle() and amr->patch[0][lv][PID]->AddParticle()
-//    will modify some global variables
-//    --> note that the order of which thread calls amr->Par->AddOneParticle() is non-deterministic and may change from run to run
-//        --> order of particles stored in the particle repository (i.e., their particle ID) may change from run to run
-//        --> particle text file may change from run to run since it's dumped according to the order of particle ID
-//    --> but it's not an issue since the actual data of each particle will not be affected
-#     pragma omp critical
+      if ( NStage + NNewPar > StageSize )
       {
-//       4-1. add particles to the particle repository
-         for (int p=0; p<NNewPar; p++)
-            NewParID[p] = amr->Par->AddOneParticle( NewParAttFlt[p], NewParAttInt[p] );
-
-
-//       4-2. add particles to the patch
-         const long_par *PType = amr->Par->Type;
-#        ifdef DEBUG_PARTICLE
-//       do not set ParPos too early since pointers to the particle repository (e.g., amr->Par->PosX)
-//       may change after calling amr->Par->AddOneParticle()
-         const real_par *ParPos[3] = { amr->Par->PosX, amr->Par->PosY, amr->Par->PosZ };
-         char Comment[100];
-         sprintf( Comment, "%s", __FUNCTION__ );
-
-         amr->patch[0][lv][PID]->AddParticle( NNewPar, NewParID, &amr->Par->NPar_Lv[lv],
-                                              PType, ParPos, amr->Par->NPar_AcPlusInac, Comment );
-#        else
-         amr->patch[0][lv][PID]->AddParticle( NNewPar, NewParID, &amr->Par->NPar_Lv[lv], PType );
-#        endif
-      } // pragma omp critical
+         StageSize = MAX( NStage + NNewPar, (long)ceil( PARLIST_GROWTH_FACTOR*StageSize ) );
+
+         real_par (*StageAttFlt_New)[PAR_NATT_FLT_TOTAL] = new real_par [StageSize][PAR_NATT_FLT_TOTAL];
+         long_par (*StageAttInt_New)[PAR_NATT_INT_TOTAL] = new long_par [StageSize][PAR_NATT_INT_TOTAL];
+
+         memcpy( StageAttFlt_New, StageAttFlt, NStage*sizeof(*StageAttFlt) );
+         memcpy( StageAttInt_New, StageAttInt, NStage*sizeof(*StageAttInt) );
+
+         delete [] StageAttFlt;
+         delete [] StageAttInt;
+
+         StageAttFlt = StageAttFlt_New;
+         StageAttInt = StageAttInt_New;
+      }
+
+      memcpy( StageAttFlt+NStage, NewParAttFlt, NNewPar*sizeof(*NewParAttFlt) );
+      memcpy( StageAttInt+NStage, NewParAttInt, NNewPar*sizeof(*NewParAttInt) );
+
+      NStage                += NNewPar;
+      NNewPar_EachPatch[PID] = NNewPar;
+   } // for (int PID=0; PID<NReal; PID++)
 
-   } // for (int PID=0; PID<amr->NPatchComma[lv][1]; PID++)
+
+// 5. gather the staged particles of all threads in the order of patch indices
+// 5-1. prefix sum over the number of new particles in each patch
+#  pragma omp single
+   {
+      long NNewParAll = 0;
+
+      for (int PID=0; PID<NReal; PID++)
+      {
+         AllNewParIdx0[PID] = NNewParAll;
+         NNewParAll        += NNewPar_EachPatch[PID];
+      }
+
+      AllNewParAttFlt = new real_par [NNewParAll][PAR_NATT_FLT_TOTAL];
+      AllNewParAttInt = new long_par [NNewParAll][PAR_NATT_INT_TOTAL];
+   }
+
+// 5-2. copy data from the thread-local buffers
+// --> must adopt the same schedule as the patch loop above so that each thread accesses its own buffer
+#  pragma omp for schedule( static )
+   for (int PID=0; PID<NReal; PID++)
+   {
+      memcpy( AllNewParAttFlt+AllNewParIdx0[PID], StageAttFlt+StageIdx0[PID], NNewPar_EachPatch[PID]*sizeof(*StageAttFlt) );
+      memcpy( AllNewParAttInt+AllNewParIdx0[PID], StageAttInt+StageIdx0[PID], NNewPar_EachPatch[PID]*sizeof(*StageAttInt) );
+   }
 
 // free memory
    delete [] NewParAttFlt;
    delete [] NewParAttInt;
-   delete [] NewParID;
+   delete [] StageAttFlt;
+   delete [] StageAttInt;
 
    } // end of OpenMP parallel region
 
 
+// 6. add new star particles to the particle repository and their home patches at once
+   Par_AddNewParticleToPatch( lv, NNewPar_EachPatch, AllNewParAttFlt, AllNewParAttInt );
+
+   delete [] NNewPar_EachPatch;
+   delete [] StageIdx0;
+   delete [] AllNewParIdx0;
+   delete [] AllNewParAttFlt;
+   delete [] AllNewParAttInt;
+
+
 // get the total number of active particles in all MPI ranks
    MPI_Allreduce( &amr->Par->NPar_Active, &amr->Par->NPar_Active_AllRank, 1, MPI_LONG, MPI_SUM, MPI_COMM_WORLD );
 
@@ -7,6 +7,7 @@
 // =======================================================================================
 static double   ParEqmIC_SmallGas;                                // negligibly small uniform density and energy
        int      ParEqmIC_NumCloud;                                // number of clouds
+       bool     ParEqmIC_ParallelIC;                              // construct particles in parallel with per-particle random numbers
        char   (*ParEqmIC_Cloud_ParaFilenames)[MAX_STRING] = NULL; // filenames of the parameters for each cloud
 
        double (*ParEqmIC_Cloud_Center)[3]                 = NULL; // center coordinates of each cloud
@@ -140,6 +141,7 @@ void LoadInputTestProb( const LoadParaMode_t load_mode, ReadPara_t *ReadPara, HD
 // ******************************************************************************************************************************
    LOAD_PARA( load_mode, "ParEqmIC_SmallGas",            &ParEqmIC_SmallGas,                 1e-3,          0.,            NoMax_double      );
    LOAD_PARA( load_mode, "ParEqmIC_NumCloud",            &ParEqmIC_NumCloud,                 1,             1,             NoMax_int         );
+   LOAD_PARA( load_mode, "ParEqmIC_ParallelIC",          &ParEqmIC_ParallelIC,               false,         Useless_bool,  Useless_bool      );
    for (int i=0; i<ParEqmIC_NumCloud; i++) {
    char ParEqmIC_Cloud_ParaFilename_i[MAX_STRING];
    sprintf( ParEqmIC_Cloud_ParaFilename_i, "ParEqmIC_Cloud_ParaFilename_%d", i+1 );
@@ -301,6 +303,7 @@ void SetParameter()
       Aux_Message( stdout, "  test problem ID                              = %d\n",     TESTPROB_ID                          );
       Aux_Message( stdout, "  small gas                                    = %13.7e\n", ParEqmIC_SmallGas                    );
       Aux_Message( stdout, "  number of clouds                             = %d\n",     ParEqmIC_NumCloud                    );
+      Aux_Message( stdout, "  construct particles in parallel              = %d\n",     ParEqmIC_ParallelIC                  );
 
       for (int i=0; i<ParEqmIC_NumCloud; i++)
       {
@@ -4,6 +4,7 @@
 #ifdef MASSIVE_PARTICLES
 
 extern int      ParEqmIC_NumCloud;
+extern bool     ParEqmIC_ParallelIC;
 extern char   (*ParEqmIC_Cloud_ParaFilenames)[MAX_STRING];
 
 extern double (*ParEqmIC_Cloud_Center)[3];
@@ -21,6 +22,10 @@ extern int     *ParEqmIC_Cloud_AddExtPotAnaly;
 extern int     *ParEqmIC_Cloud_AddExtPotTable;
 extern char   (*ParEqmIC_Cloud_ExtPotTable)[MAX_STRING];
 
+static void SetCloudParameters( Par_EquilibriumIC &Cloud_Constructor, const int CloudID );
+static void ConstructParticle_ThisRank( const long NPar_ThisRank, const long NPar_AllRank, real_par *ParMass,
+                                        real_par *ParPos[3], real_par *ParVel[3] );
+
 
 
 
@@ -41,6 +46,9 @@ extern char   (*ParEqmIC_Cloud_ExtPotTable)[MAX_STRING];
 //                   --> They will later be redistributed when calling Par_FindHomePatch_UniformGrid()
 //                       and LB_Init_LoadBalance()
 //                   --> Therefore, there is no constraint on which particles should be set by this function
+//                4. By default, the master rank constructs all particles and then scatters them to all ranks
+//                   --> When ParEqmIC_ParallelIC is enabled, each rank instead constructs only its own particles
+//                       in parallel by calling ConstructParticle_ThisRank()
 //
 // Parameter   :  NPar_ThisRank   : Number of particles to be set by this MPI rank
 //                NPar_AllRank    : Total Number of particles in all MPI ranks
@@ -77,7 +85,7 @@ void Par_Init_ByFunction_ParEqmIC( const long NPar_ThisRank, const long NPar_All
 
 
 // only the master rank will construct the initial condition
-   if ( MPI_Rank == 0 )
+   if ( !ParEqmIC_ParallelIC  &&  MPI_Rank == 0 )
    {
 
 //    allocate memory for particle attribute arrays
@@ -105,29 +113,7 @@ void Par_Init_ByFunction_ParEqmIC( const long NPar_ThisRank, const long NPar_All
          Par_EquilibriumIC Cloud_Constructor( ParEqmIC_Cloud_Type[i] );
 
 //       set the parameters for each particle cloud
-         Cloud_Constructor.setCenterAndBulkVel( ParEqmIC_Cloud_Center [i][0], ParEqmIC_Cloud_Center [i][1], ParEqmIC_Cloud_Center [i][2],
-                                                ParEqmIC_Cloud_BulkVel[i][0], ParEqmIC_Cloud_BulkVel[i][1], ParEqmIC_Cloud_BulkVel[i][2] );
-
-         Cloud_Constructor.setParticleParameters( ParEqmIC_Cloud_ParNum[i], ParEqmIC_Cloud_MaxR[i], ParEqmIC_Cloud_NBin[i], ParEqmIC_Cloud_RSeed[i] );
-
-         if ( strcmp( ParEqmIC_Cloud_Type[i], "Table" ) == 0 )
-         {
-            Cloud_Constructor.setDensProfTableFilename( ParEqmIC_Cloud_DensityTable[i] );
-         }
-         else
-         {
-            Cloud_Constructor.setModelParameters( ParEqmIC_Cloud_Rho0[i], ParEqmIC_Cloud_R0[i] );
-         }
-
-         if ( strcmp( ParEqmIC_Cloud_Type[i], "Einasto" ) == 0 )
-         {
-            Cloud_Constructor.setEinastoPowerFactor( ParEqmIC_Cloud_EinastoPowerFactor[i] );
-         }
-
-         if ( ParEqmIC_Cloud_AddExtPotAnaly[i]  ||  ParEqmIC_Cloud_AddExtPotTable[i] )
-         {
-            Cloud_Constructor.setExtPotParameters( ParEqmIC_Cloud_AddExtPotAnaly[i], ParEqmIC_Cloud_AddExtPotTable[i], ParEqmIC_Cloud_ExtPotTable[i] );
-         }
+         SetCloudParameters( Cloud_Constructor, i );
 
 //       construct the distribution for the particle cloud
          Cloud_Constructor.constructDistribution();
@@ -150,13 +136,23 @@ void Par_Init_ByFunction_ParEqmIC( const long NPar_ThisRank, const long NPar_All
          Aux_Error( ERROR_INFO, "total particle number doesn't match (total = %ld != NPar_AllRank = %ld) !!\n", Par_Idx0, NPar_AllRank );
       }
 
-   } // if ( MPI_Rank == 0 )
+   } // if ( !ParEqmIC_ParallelIC  &&  MPI_Rank == 0 )
 
 
 // send particle attributes from the master rank to all ranks
+   if ( !ParEqmIC_ParallelIC )
    Par_ScatterParticleData( NPar_ThisRank, NPar_AllRank, _PAR_MASS|_PAR_POS|_PAR_VEL, _NONE,
                             ParFltData_AllRank, ParIntData_AllRank, AllAttributeFlt, AllAttributeInt );
 
+// or construct the particles of this rank directly
+   else
+   {
+      real_par *ParPos[3] = { ParPosX, ParPosY, ParPosZ };
+      real_par *ParVel[3] = { ParVelX, ParVelY, ParVelZ };
+
+      ConstructParticle_ThisRank( NPar_ThisRank, NPar_AllRank, ParMass, ParPos, ParVel );
+   }
+
 
 // synchronize all particles to the physical time on the base level and assign particle type
    for (long p=0; p<NPar_ThisRank; p++)
@@ -178,4 +174,120 @@ void Par_Init_ByFunction_ParEqmIC( const long NPar_ThisRank, const long NPar_All
 
 } // FUNCTION : Par_Init_ByFunction_ParEqmIC
 
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  SetCloudParameters
+// Description :  Set the parameters of the target particle cloud
+//
+// Parameter   :  Cloud_Constructor : Par_EquilibriumIC object of the target cloud
+//                CloudID           : Index of the target cloud
+//
+// Return      :  Cloud_Constructor
+//-------------------------------------------------------------------------------------------------------
+void SetCloudParameters( Par_EquilibriumIC &Cloud_Constructor, const int CloudID )
+{
+
+   const int i = CloudID;
+
+   Cloud_Constructor.setCenterAndBulkVel( ParEqmIC_Cloud_Center [i][0], ParEqmIC_Cloud_Center [i][1], ParEqmIC_Cloud_Center [i][2],
+                                          ParEqmIC_Cloud_BulkVel[i][0], ParEqmIC_Cloud_BulkVel[i][1], ParEqmIC_Cloud_BulkVel[i][2] );
+
+   Cloud_Constructor.setParticleParameters( ParEqmIC_Cloud_ParNum[i], ParEqmIC_Cloud_MaxR[i], ParEqmIC_Cloud_NBin[i], ParEqmIC_Cloud_RSeed[i] );
+
+   if ( strcmp( ParEqmIC_Cloud_Type[i], "Table" ) == 0 )
+   {
+      Cloud_Constructor.setDensProfTableFilename( ParEqmIC_Cloud_DensityTable[i] );
+   }
+   else
+   {
+      Cloud_Constructor.setModelParameters( ParEqmIC_Cloud_Rho0[i], ParEqmIC_Cloud_R0[i] );
+   }
+
+   if ( strcmp( ParEqmIC_Cloud_Type[i], "Einasto" ) == 0 )
+   {
+      Cloud_Constructor.setEinastoPowerFactor( ParEqmIC_Cloud_EinastoPowerFactor[i] );
+   }
+
+   if ( ParEqmIC_Cloud_AddExtPotAnaly[i]  ||  ParEqmIC_Cloud_AddExtPotTable[i] )
+   {
+      Cloud_Constructor.setExtPotParameters( ParEqmIC_Cloud_AddExtPotAnaly[i], ParEqmIC_Cloud_AddExtPotTable[i], ParEqmIC_Cloud_ExtPotTable[i] );
+   }
+
+} // FUNCTION : SetCloudParameters
+
+
+
+//-------------------------------------------------------------------------------------------------------
+// Function    :  ConstructParticle_ThisRank
+// Description :  Construct the particles owned by this rank
+//
+// Note        :  1. Invoked by Par_Init_ByFunction_ParEqmIC() when ParEqmIC_ParallelIC is enabled
+//                2. This rank owns the same range of global particle indices as Par_ScatterParticleData()
+//                   --> Particles are bitwise identical regardless of the numbers of MPI ranks and OpenMP threads
+//                       since Par_EquilibriumIC::constructParticlesInRange() draws random numbers per particle
+//
+// Parameter   :  NPar_ThisRank : Number of particles to be set by this MPI rank
+//                NPar_AllRank  : Total Number of particles in all MPI ranks
+//                ParMass       : Particle mass     array with the size of NPar_ThisRank
+//                ParPos        : Particle position arrays with the size of NPar_ThisRank
+//                ParVel        : Particle velocity arrays with the size of NPar_ThisRank
+//
+// Return      :  ParMass, ParPos, ParVel
+//-------------------------------------------------------------------------------------------------------
+void ConstructParticle_ThisRank( const long NPar_ThisRank, const long NPar_AllRank, real_par *ParMass,
+                                 real_par *ParPos[3], real_par *ParVel[3] )
+{
+
+// get the range of global particle indices of this rank
+   long *NPar_EachRank = new long [MPI_NRank];
+   long  Par_IdxStart  = 0;
+
+   MPI_Allgather( &NPar_ThisRank, 1, MPI_LONG, NPar_EachRank, 1, MPI_LONG, MPI_COMM_WORLD );
+
+   for (int r=0; r<MPI_Rank; r++)   Par_IdxStart += NPar_EachRank[r];
+
+   const long Par_IdxEnd = Par_IdxStart + NPar_ThisRank;
+
+   delete [] NPar_EachRank;
+
+
+   long Par_Idx0 = 0;
+
+   for (int i=0; i<ParEqmIC_NumCloud; i++)
+   {
+//    initialize Par_EquilibriumIC for each particle cloud
+      Par_EquilibriumIC Cloud_Constructor( ParEqmIC_Cloud_Type[i] );
+
+//    set the parameters for each particle cloud
+      SetCloudParameters( Cloud_Constructor, i );
+
+//    construct the distribution for the particle cloud on all ranks
+      Cloud_Constructor.constructDistribution();
+
+//    construct the particles of this cloud owned by this rank
+//    --> [Cloud_IdxStart, Cloud_IdxEnd) may be empty
+      const long Cloud_IdxStart = MIN( MAX( Par_IdxStart-Par_Idx0, 0L ), ParEqmIC_Cloud_ParNum[i] );
+      const long Cloud_IdxEnd   = MIN( MAX( Par_IdxEnd  -Par_Idx0, 0L ), ParEqmIC_Cloud_ParNum[i] );
+
+      Cloud_Constructor.constructParticlesInRange( ParMass, ParPos, ParVel, Par_Idx0+Cloud_IdxStart-Par_IdxStart,
+                                                   Cloud_IdxStart, Cloud_IdxEnd );
+
+      if ( MPI_Rank == 0 )
+      {
+         Aux_Message( stdout, "   Total enclosed mass within MaxR    = % 13.7e\n",  Cloud_Constructor.TotCloudMass      );
+         Aux_Message( stdout, "   Particle mass                      = % 13.7e\n",  Cloud_Constructor.ParticleMass      );
+         Aux_Message( stdout, "   Total enclosed mass relative error = % 13.7e\n",  Cloud_Constructor.TotCloudMassError );
+      }
+
+//    update the particle index offset for the next particle cloud
+      Par_Idx0 += ParEqmIC_Cloud_ParNum[i];
+   } // for (int i=0; i<ParEqmIC_NumCloud; i++)
+
+// check whether the total particle number is reasonable
+   if ( Par_Idx0 != NPar_AllRank )
+      Aux_Error( ERROR_INFO, "total particle number doesn't match (total = %ld != NPar_AllRank = %ld) !!\n", Par_Idx0, NPar_AllRank );
+
+} // FUNCTION : ConstructParticle_ThisRank
+
 #endif // #ifdef MASSIVE_PARTICLES
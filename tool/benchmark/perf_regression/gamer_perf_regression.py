@@ -0,0 +1,374 @@
+#!/bin/python3
+"""
+An end-to-end performance regression suite for GAMER built on the example test problems.
+
+How to use it:
+  1. Select the test problems to be benchmarked in a suite file (see `perf_suite.json`).
+     Each entry specifies
+       - the test problem directory under `example/test_problem/`
+       - the extra arguments passed to its `generate_make.sh`
+       - the runtime parameters overwritten in the `Input__*` files to obtain a reduced-size run
+         with a fixed number of steps and fixed random seeds
+  2. Run the suite from any directory, for example,
+       python3 gamer_perf_regression.py --machine eureka_gnu --mpi_nrank 2 --omp_nthread 4
+  3. Save the result as a baseline with `--save_baseline`, and compare later runs against it with `--baseline`.
+     Regressions beyond the given tolerances are reported and make the script return a non-zero exit code.
+
+Notes:
+  1. Each configure variant is compiled only once in a private copy of the source tree under `<work_dir>/build/`,
+     so the working tree of the user is never touched
+  2. The collected metrics are
+       - Perf_Overall / ParPerf_Overall averaged over all recorded steps (Record__Performance)
+       - Phy_Peak (Record__MemInfo)
+       - the time of each code section summed over all levels and steps ("Sum" rows of the
+         "Integration Loop" table in Record__Timing)
+  3. OPT__RECORD_PERFORMANCE and OPT__RECORD_MEMORY are always enabled and snapshot outputs are always
+     disabled, regardless of the suite file
+-----------------------------------------------------------------------------------------------------
+For developer:
+1. Metrics with `higher_is_better=True` regress when they drop by more than the tolerance; the others
+   regress when they grow by more than the tolerance.
+2. Parsing relies on the output format of Aux_Record_Performance(), Aux_GetMemInfo(), and Aux_Record_Timing().
+   Please update `parse_*()` accordingly when changing those routines.
+"""
+#====================================================================================================
+# Import packages
+#====================================================================================================
+import argparse
+import copy
+import datetime
+import hashlib
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+
+
+
+#====================================================================================================
+# Global variables
+#====================================================================================================
+GAMER_ROOT     = os.path.abspath( os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "..") )
+TEST_PROB_DIR  = os.path.join( GAMER_ROOT, "example", "test_problem" )
+DEFAULT_SUITE  = os.path.join( os.path.dirname(os.path.abspath(__file__)), "perf_suite.json" )
+RETURN_FAIL    = 1
+RETURN_SUCCESS = 0
+
+# runtime parameters enforced for all test problems
+FORCED_PARAMETERS = { "OPT__RECORD_PERFORMANCE" : 1,
+                      "OPT__RECORD_MEMORY"      : 1,
+                      "OPT__OUTPUT_TOTAL"       : 0,
+                      "OPT__OUTPUT_PART"        : 0,
+                      "OPT__OUTPUT_USER"        : 0,
+                      "OPT__OUTPUT_BASEPS"      : 0,
+                      "OPT__OUTPUT_RESTART"     : 0,
+                      "OPT__TIMING_BARRIER"     : 1 }
+
+# metrics : [higher_is_better, default tolerance]
+METRICS = { "Perf_Overall"    : [ True,  0.05 ],
+            "ParPerf_Overall" : [ True,  0.05 ],
+            "Phy_Peak_MB"     : [ False, 0.10 ],
+            "Time_Total"      : [ False, 0.05 ] }
+
+
+
+#====================================================================================================
+# Functions
+#====================================================================================================
+def log( msg, quiet=False ):
+    if not quiet: print( msg, flush=True )
+
+def replace_parameter( file_name, para_name, val ):
+    """
+    Replace the value of <para_name> in <file_name>, or append a new line if it does not exist.
+    """
+    with open( file_name, 'r' ) as f:
+        content = f.read()
+
+    content_new, Nsub = re.subn( r"^(%s\s+)([^\s]+)"%para_name, r"\g<1>%s"%str(val), content, flags=re.M )
+    if Nsub == 0:
+        if not content_new.endswith( "\n" ): content_new += "\n"
+        content_new += "%-29s %-11s # added by gamer_perf_regression.py\n"%(para_name, str(val))
+
+    with open( file_name, 'w' ) as f:
+        f.write( content_new )
+    return
+
+def variant_key( prob ):
+    """
+    Key identifying a configure variant so that identical builds are shared among test problems.
+    """
+    args = " ".join( [prob["generate_make"]] + prob.get("configure_args", []) )
+    return hashlib.md5( args.encode() ).hexdigest()[:12]
+
+def build_variant( prob, args ):
+    """
+    Compile GAMER for the configure variant of <prob> and return the path of the executable.
+    """
+    key       = variant_key( prob )
+    build_dir = os.path.join( args["work_dir"], "build", key )
+    exe       = os.path.join( build_dir, "bin", "gamer" )
+
+    if os.path.isfile( exe ) and not args["rebuild"]:
+        log( "   Reuse build %s"%key, args["quiet"] )
+        return exe
+
+    log( "   Build %s (%s)"%(key, " ".join(prob.get("configure_args", []))), args["quiet"] )
+
+    if os.path.isdir( build_dir ): shutil.rmtree( build_dir )
+    for d in [ "src", "include", "configs" ]:
+        shutil.copytree( os.path.join(GAMER_ROOT, d), os.path.join(build_dir, d), symlinks=True,
+                         ignore=shutil.ignore_patterns("Object", "Makefile", "Makefile.log", "gamer") )
+    os.makedirs( os.path.join(build_dir, "bin") )
+    os.makedirs( os.path.join(build_dir, "src", "Object"), exist_ok=True )
+
+    src_dir  = os.path.join( build_dir, "src" )
+    gen_make = os.path.join( TEST_PROB_DIR, prob["path"], prob["generate_make"] )
+    cmd_conf = [ "sh", gen_make, "--machine=%s"%args["machine"] ] + prob.get( "configure_args", [] ) \
+                                                                 + args["extra_configure_args"]
+    cmd_make = [ "make", "-j%d"%args["make_nproc"] ]
+
+    with open( os.path.join(build_dir, "build.log"), "w" ) as f:
+        for cmd in [ cmd_conf, cmd_make ]:
+            ret = subprocess.run( cmd, cwd=src_dir, stdout=f, stderr=subprocess.STDOUT )
+            if ret.returncode != 0 or cmd is cmd_make and not os.path.isfile( exe ):
+                log( "   ERROR : build failed (see %s)"%os.path.join(build_dir, "build.log") )
+                return None
+    return exe
+
+def run_problem( name, prob, exe, args ):
+    """
+    Prepare the run directory of <prob>, apply the parameter overrides, and run it.
+    """
+    run_dir = os.path.join( args["work_dir"], "run", name )
+
+    if os.path.isdir( run_dir ): shutil.rmtree( run_dir )
+    shutil.copytree( os.path.join(TEST_PROB_DIR, prob["path"]), run_dir, symlinks=True )
+    shutil.copy( exe, run_dir )
+
+    for cmd in prob.get( "prepare", [] ):
+        log( "   Prepare : %s"%cmd, args["quiet"] )
+        if subprocess.run( cmd, shell=True, cwd=run_dir ).returncode != 0:
+            log( "   ERROR : preparation <%s> failed"%cmd )
+            return None
+
+    overrides = copy.deepcopy( prob.get("parameters", {}) )
+    overrides.setdefault( "Input__Parameter", {} )
+    overrides["Input__Parameter"].update( FORCED_PARAMETERS )
+    overrides["Input__Parameter"]["END_STEP"] = args["nstep"] if args["nstep"] > 0 else prob.get( "nstep", 10 )
+    if args["omp_nthread"] > 0: overrides["Input__Parameter"]["OMP_NTHREAD"] = args["omp_nthread"]
+
+    for file_name, paras in overrides.items():
+        for key, val in paras.items():
+            replace_parameter( os.path.join(run_dir, file_name), key, val )
+
+    if args["mpi_nrank"] > 0: cmd = "%s %d ./gamer"%( args["mpirun"], args["mpi_nrank"] )
+    else:                     cmd = "./gamer"
+
+    log( "   Run     : %s"%cmd, args["quiet"] )
+    with open( os.path.join(run_dir, "log"), "w" ) as f:
+        ret = subprocess.run( cmd, shell=True, cwd=run_dir, stdout=f, stderr=subprocess.STDOUT )
+    if ret.returncode != 0:
+        log( "   ERROR : run failed (see %s)"%os.path.join(run_dir, "log") )
+        return None
+    return run_dir
+
+def parse_performance( file_name ):
+    """
+    Average Perf_Overall and ParPerf_Overall over all steps recorded in Record__Performance.
+    """
+    if not os.path.isfile( file_name ): return {}
+
+    header, rows = None, []
+    with open( file_name, "r" ) as f:
+        for line in f:
+            if line.startswith( "#" ): header = line[1:].split()
+            elif line.strip():         rows.append( line.split() )
+
+    if header is None or len(rows) == 0: return {}
+
+    result = {}
+    for key in [ "Perf_Overall", "ParPerf_Overall" ]:
+        if key not in header: continue
+        col  = header.index( key )
+        vals = [ float(r[col]) for r in rows ]
+        result[key] = sum(vals)/len(vals)
+    return result
+
+def parse_meminfo( file_name ):
+    """
+    Return the maximum Phy_Peak in Record__MemInfo in MB.
+    """
+    if not os.path.isfile( file_name ): return {}
+
+    peak = None
+    with open( file_name, "r" ) as f:
+        for line in f:
+            if line.startswith( "#" ) or not line.strip(): continue
+            val  = float( line.split()[-1] )
+            peak = val if peak is None else max( peak, val )
+    return {} if peak is None else { "Phy_Peak_MB" : peak }
+
+def parse_timing( file_name ):
+    """
+    Sum the "Sum" rows of the "Integration Loop" tables in Record__Timing over all steps.
+    --> Only the average row is used when OPT__TIMING_BALANCE is enabled
+    """
+    if not os.path.isfile( file_name ): return {}
+
+    header, breakdown = None, {}
+    with open( file_name, "r" ) as f:
+        for line in f:
+            tokens = line.split()
+            if len(tokens) == 0: continue
+
+            if tokens[0] == "Lv":
+#              make the duplicate column names (e.g., -MPI_Sib) unique
+               header = []
+               for h in tokens[1:]:
+                   header.append( h if h not in header else header[-1].lstrip("-") + h )
+            elif header is not None and "Sum" in tokens[:2] and ( tokens[0] == "Sum" or tokens[0] == "Ave" ):
+                vals = tokens[-len(header):]
+                for h, v in zip( header, vals ):
+                    breakdown[h] = breakdown.get( h, 0.0 ) + float(v)
+                header = None
+
+    if len(breakdown) == 0: return {}
+    return { "Time_Total" : breakdown["Total"], "Timing" : breakdown }
+
+def compare( results, baseline, tolerances ):
+    """
+    Return a list of regressions of <results> with respect to <baseline>.
+    """
+    regressions = []
+    for name, res in results.items():
+        if name not in baseline: continue
+        for metric, (higher_is_better, _) in METRICS.items():
+            if metric not in res or metric not in baseline[name]: continue
+            new, ref = res[metric], baseline[name][metric]
+            if ref == 0.0: continue
+            change = ( new - ref )/ref
+            if ( higher_is_better and change < -tolerances[metric] ) or \
+               ( not higher_is_better and change > tolerances[metric] ):
+                regressions.append( (name, metric, ref, new, change) )
+    return regressions
+
+def write_report( results, regressions, args ):
+    report = os.path.join( args["work_dir"], "perf_report.txt" )
+    with open( report, "w" ) as f:
+        f.write( "# GAMER performance regression report (%s)\n"%datetime.datetime.now().isoformat(timespec="seconds") )
+        f.write( "# MPI ranks = %d, OpenMP threads = %d, steps = %d\n\n"%(args["mpi_nrank"], args["omp_nthread"], args["nstep"]) )
+        f.write( "%-30s%16s%16s%16s%16s\n"%("Problem", "Perf_Overall", "ParPerf_Overall", "Phy_Peak (MB)", "Time_Total (s)") )
+        for name, res in results.items():
+            f.write( "%-30s"%name )
+            for key, fmt in [ ("Perf_Overall", "%16.4e"), ("ParPerf_Overall", "%16.4e"), ("Phy_Peak_MB", "%16.2f"), ("Time_Total", "%16.4f") ]:
+                f.write( fmt%res[key] if key in res else "%16s"%"-" )
+            f.write( "\n" )
+
+        f.write( "\n# Timing breakdown summed over all levels and steps (s)\n" )
+        for name, res in results.items():
+            f.write( "%s\n"%name )
+            for key, val in res.get( "Timing", {} ).items():
+                if val > 0.0: f.write( "   %-12s%12.4f\n"%(key, val) )
+
+        f.write( "\n# Regressions\n" )
+        if len(regressions) == 0: f.write( "None\n" )
+        for name, metric, ref, new, change in regressions:
+            f.write( "%-30s%-18s%14.4e -> %14.4e (%+.2f%%)\n"%(name, metric, ref, new, 100.0*change) )
+
+    with open( os.path.join(args["work_dir"], "perf_result.json"), "w" ) as f:
+        json.dump( results, f, indent=2 )
+
+    with open( report, "r" ) as f:
+        log( f.read(), args["quiet"] )
+    return
+
+
+
+#====================================================================================================
+# Main
+#====================================================================================================
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser( description = "End-to-end performance regression suite for GAMER.",
+                                      formatter_class = argparse.RawTextHelpFormatter )
+
+    parser.add_argument( "--suite",                type=str,   default=DEFAULT_SUITE,
+                         help="suite file in JSON [%(default)s]\n" )
+    parser.add_argument( "--problems",             type=str,   nargs="+", default=None,
+                         help="run only the given problems in the suite [all enabled problems]\n" )
+    parser.add_argument( "--machine",              type=str,   required=True,
+                         help="machine config file under configs/ passed to configure.py\n" )
+    parser.add_argument( "--extra_configure_args", type=str,   nargs="*", default=[],
+                         help="extra arguments appended to all configure commands (e.g., --gpu=false)\n" )
+    parser.add_argument( "--work_dir",             type=str,   default="gamer_perf",
+                         help="directory for builds, runs, and reports [%(default)s]\n" )
+    parser.add_argument( "--nstep",                type=int,   default=-1,
+                         help="number of root-level steps of each run (<=0: use the suite value) [%(default)d]\n" )
+    parser.add_argument( "--mpi_nrank",            type=int,   default=0,
+                         help="number of MPI ranks (<=0: run without mpirun) [%(default)d]\n" )
+    parser.add_argument( "--mpirun",               type=str,   default="mpirun -np",
+                         help="MPI launcher followed by the number of ranks [%(default)s]\n" )
+    parser.add_argument( "--omp_nthread",          type=int,   default=0,
+                         help="number of OpenMP threads (<=0: use the Input__Parameter value) [%(default)d]\n" )
+    parser.add_argument( "--make_nproc",           type=int,   default=8,
+                         help="number of processes for make [%(default)d]\n" )
+    parser.add_argument( "--rebuild",              action="store_true",
+                         help="recompile even if the executable of a configure variant exists\n" )
+    parser.add_argument( "--baseline",             type=str,   default=None,
+                         help="baseline JSON file to compare with\n" )
+    parser.add_argument( "--save_baseline",        type=str,   default=None,
+                         help="store the results as a new baseline JSON file\n" )
+    for metric, (_, tol) in METRICS.items():
+        parser.add_argument( "--tol_%s"%metric,    type=float, default=tol,
+                             help="relative tolerance of %s [%%(default).2f]\n"%metric )
+    parser.add_argument( "-q", "--quiet",          action="store_true",
+                         help="enable silent mode\n" )
+
+    args = vars( parser.parse_args() )
+    args["work_dir"] = os.path.abspath( args["work_dir"] )
+    os.makedirs( args["work_dir"], exist_ok=True )
+
+    with open( args["suite"], "r" ) as f:
+        suite = json.load( f )
+
+    names = args["problems"] if args["problems"] is not None else \
+            [ name for name, prob in suite.items() if prob.get("enabled", True) ]
+
+    results, failed = {}, []
+    for name in names:
+        if name not in suite:
+            log( "ERROR : problem <%s> is not in %s"%(name, args["suite"]) )
+            failed.append( name )
+            continue
+
+        log( "Problem %s"%name, args["quiet"] )
+        prob = suite[name]
+        exe  = build_variant( prob, args )
+        run  = None if exe is None else run_problem( name, prob, exe, args )
+        if run is None:
+            failed.append( name )
+            continue
+
+        res = {}
+        res.update( parse_performance(os.path.join(run, "Record__Performance")) )
+        res.update( parse_meminfo    (os.path.join(run, "Record__MemInfo"    )) )
+        res.update( parse_timing     (os.path.join(run, "Record__Timing"     )) )
+        results[name] = res
+
+    tolerances  = { metric : args["tol_%s"%metric] for metric in METRICS }
+    regressions = []
+    if args["baseline"] is not None:
+        with open( args["baseline"], "r" ) as f:
+            regressions = compare( results, json.load(f), tolerances )
+
+    write_report( results, regressions, args )
+
+    if args["save_baseline"] is not None:
+        with open( args["save_baseline"], "w" ) as f:
+            json.dump( results, f, indent=2 )
+
+    if len(failed) > 0: log( "Failed problems : %s"%" ".join(failed) )
+
+    sys.exit( RETURN_FAIL if len(failed) > 0 or len(regressions) > 0 else RETURN_SUCCESS )